@@ -0,0 +1,213 @@
+
+Module: /root/repo/benchmarks/matrices.um
+
+000000000     35                         GOTO 185
+
+
+Function: test
+
+000000001     31                  ENTER_FRAME 0x558b0fb4c988
+000000002      5               PUSH_LOCAL_PTR -1280016
+000000003      5                         ZERO 1280000
+000000004      5               PUSH_LOCAL_PTR -2560016
+000000005      5                         ZERO 1280000
+000000006      5               PUSH_LOCAL_PTR -3840016
+000000007      5                         ZERO 1280000
+000000008      8               PUSH_LOCAL_PTR -1280016
+000000009      8                         PUSH int 400
+000000010      8               PUSH_LOCAL_PTR -3840024
+000000011      8                  SWAP_ASSIGN int 8
+000000012      8          PUSH_LOCAL_PTR_ZERO -3840032 8
+000000013      8          SWAP_REF_CNT_ASSIGN ^[400][400]real
+000000014      8               PUSH_LOCAL_PTR -3840040
+000000015      8                         ZERO 8
+000000016      8               PUSH_LOCAL_PTR -3843240
+000000017      8                         ZERO 3200
+
+000000018      8                   PUSH_LOCAL int -3840040
+000000019      8                   PUSH_LOCAL int -3840024
+000000020     13       GOTO_IF_GREATER_EQ_INT int 64
+000000021      8                   PUSH_LOCAL ^ -3840032
+000000022      8                   PUSH_LOCAL int -3840040
+000000023      8                    GET_ARRAY [...] 3200 400
+000000024      8               PUSH_LOCAL_PTR -3843240
+000000025      8                  SWAP_ASSIGN [...] 3200
+000000026      9               PUSH_LOCAL_PTR -3843240
+000000027      9                         PUSH int 400
+000000028      9               PUSH_LOCAL_PTR -3843248
+000000029      9                  SWAP_ASSIGN int 8
+000000030      9                          POP 1
+000000031      9               PUSH_LOCAL_PTR -3843256
+000000032      9                         ZERO 8
+
+000000033      9                   PUSH_LOCAL int -3843256
+000000034      9                   PUSH_LOCAL int -3843248
+000000035     12       GOTO_IF_GREATER_EQ_INT int 62
+000000036     10               PUSH_LOCAL_PTR -1280016
+000000037     10                   PUSH_LOCAL int -3840040
+000000038     10                GET_ARRAY_PTR 3200 400
+000000039     10                   PUSH_LOCAL int -3843256
+000000040     10                GET_ARRAY_PTR 8 400
+000000041     10                         PUSH int 3
+000000042     10                   PUSH_LOCAL int -3840040
+000000043     10                      MUL_INT int
+000000044     10                   PUSH_LOCAL int -3843256
+000000045     10                      ADD_INT int
+000000046     10                 CALL_BUILTIN int makereal
+000000047     10                       ASSIGN real 8
+000000048     11               PUSH_LOCAL_PTR -2560016
+000000049     11                   PUSH_LOCAL int -3840040
+000000050     11                GET_ARRAY_PTR 3200 400
+000000051     11                   PUSH_LOCAL int -3843256
+000000052     11                GET_ARRAY_PTR 8 400
+000000053     11                   PUSH_LOCAL int -3840040
+000000054     11                         PUSH int 3
+000000055     11                   PUSH_LOCAL int -3843256
+000000056     11                      MUL_INT int
+000000057     11                      SUB_INT int
+000000058     11                 CALL_BUILTIN int makereal
+000000059     11                       ASSIGN real 8
+000000060     12                INC_LOCAL_INT -3843256
+000000061     12                         GOTO 33
+
+000000062     13                INC_LOCAL_INT -3840040
+000000063     13                         GOTO 18
+
+000000064     13                REF_CNT_LOCAL -- ^[400][400]real -3840032
+000000065     16                         PUSH int 0
+000000066     16               PUSH_LOCAL_PTR -3843264
+000000067     16                  SWAP_ASSIGN int 8
+
+000000068     16                   PUSH_LOCAL int -3843264
+000000069     16                         PUSH int 400
+000000070     22       GOTO_IF_GREATER_EQ_INT int 115
+000000071     17                         PUSH int 0
+000000072     17               PUSH_LOCAL_PTR -3843272
+000000073     17                  SWAP_ASSIGN int 8
+
+000000074     17                   PUSH_LOCAL int -3843272
+000000075     17                         PUSH int 400
+000000076     21       GOTO_IF_GREATER_EQ_INT int 113
+000000077     18                         PUSH real 0
+000000078     18               PUSH_LOCAL_PTR -3843280
+000000079     18                  SWAP_ASSIGN real 8
+000000080     19                         PUSH int 0
+000000081     19               PUSH_LOCAL_PTR -3843288
+000000082     19                  SWAP_ASSIGN int 8
+
+000000083     19                   PUSH_LOCAL int -3843288
+000000084     19                         PUSH int 400
+000000085     19       GOTO_IF_GREATER_EQ_INT int 104
+000000086     19               PUSH_LOCAL_PTR -3843280
+000000087     19                          DUP
+000000088     19                        DEREF real
+000000089     19               PUSH_LOCAL_PTR -1280016
+000000090     19                   PUSH_LOCAL int -3843264
+000000091     19                GET_ARRAY_PTR 3200 400
+000000092     19                   PUSH_LOCAL int -3843288
+000000093     19                    GET_ARRAY real 8 400
+000000094     19               PUSH_LOCAL_PTR -2560016
+000000095     19                   PUSH_LOCAL int -3843288
+000000096     19                GET_ARRAY_PTR 3200 400
+000000097     19                   PUSH_LOCAL int -3843272
+000000098     19                    GET_ARRAY real 8 400
+000000099     19                     MUL_REAL real
+000000100     19                     ADD_REAL real
+000000101     19                       ASSIGN real 8
+000000102     19                INC_LOCAL_INT -3843288
+000000103     19                         GOTO 83
+
+000000104     20               PUSH_LOCAL_PTR -3840016
+000000105     20                   PUSH_LOCAL int -3843264
+000000106     20                GET_ARRAY_PTR 3200 400
+000000107     20                   PUSH_LOCAL int -3843272
+000000108     20                GET_ARRAY_PTR 8 400
+000000109     20                   PUSH_LOCAL real -3843280
+000000110     20                       ASSIGN real 8
+000000111     21                INC_LOCAL_INT -3843272
+000000112     21                         GOTO 74
+
+000000113     22                INC_LOCAL_INT -3843264
+000000114     22                         GOTO 68
+
+000000115     25                         PUSH real 0
+000000116     25               PUSH_LOCAL_PTR -3843296
+000000117     25                  SWAP_ASSIGN real 8
+000000118     26               PUSH_LOCAL_PTR -3840016
+000000119     26                         PUSH int 400
+000000120     26               PUSH_LOCAL_PTR -3843304
+000000121     26                  SWAP_ASSIGN int 8
+000000122     26          PUSH_LOCAL_PTR_ZERO -3843312 8
+000000123     26          SWAP_REF_CNT_ASSIGN ^[400][400]real
+000000124     26               PUSH_LOCAL_PTR -3843320
+000000125     26                         ZERO 8
+000000126     26               PUSH_LOCAL_PTR -3846520
+000000127     26                         ZERO 3200
+
+000000128     26                   PUSH_LOCAL int -3843320
+000000129     26                   PUSH_LOCAL int -3843304
+000000130     28       GOTO_IF_GREATER_EQ_INT int 165
+000000131     26                   PUSH_LOCAL ^ -3843312
+000000132     26                   PUSH_LOCAL int -3843320
+000000133     26                    GET_ARRAY [...] 3200 400
+000000134     26               PUSH_LOCAL_PTR -3846520
+000000135     26                  SWAP_ASSIGN [...] 3200
+000000136     27               PUSH_LOCAL_PTR -3846520
+000000137     27                         PUSH int 400
+000000138     27               PUSH_LOCAL_PTR -3846528
+000000139     27                  SWAP_ASSIGN int 8
+000000140     27          PUSH_LOCAL_PTR_ZERO -3846536 8
+000000141     27          SWAP_REF_CNT_ASSIGN ^[400]real
+000000142     27               PUSH_LOCAL_PTR -3846544
+000000143     27                         ZERO 8
+000000144     27               PUSH_LOCAL_PTR -3846552
+000000145     27                         ZERO 8
+
+000000146     27                   PUSH_LOCAL int -3846544
+000000147     27                   PUSH_LOCAL int -3846528
+000000148     27       GOTO_IF_GREATER_EQ_INT int 162
+000000149     27                   PUSH_LOCAL ^ -3846536
+000000150     27                   PUSH_LOCAL int -3846544
+000000151     27                    GET_ARRAY real 8 400
+000000152     27               PUSH_LOCAL_PTR -3846552
+000000153     27                  SWAP_ASSIGN real 8
+000000154     27               PUSH_LOCAL_PTR -3843296
+000000155     27                          DUP
+000000156     27                        DEREF real
+000000157     27                   PUSH_LOCAL real -3846552
+000000158     27                     ADD_REAL real
+000000159     27                       ASSIGN real 8
+000000160     27                INC_LOCAL_INT -3846544
+000000161     27                         GOTO 146
+
+000000162     27                REF_CNT_LOCAL -- ^[400]real -3846536
+000000163     28                INC_LOCAL_INT -3843320
+000000164     28                         GOTO 128
+
+000000165     28                REF_CNT_LOCAL -- ^[400][400]real -3843312
+000000166     30                         PUSH int 0
+000000167     30                         PUSH ^ (nil)
+000000168     30                         PUSH ^ 0x558b0fb397d8
+000000169     30                   PUSH_LOCAL real -3843296
+000000170     30                         PUSH real 400
+000000171     30                     DIV_REAL real
+000000172     30                         PUSH real 400
+000000173     30                     DIV_REAL real
+000000174     30                 CALL_BUILTIN real printf
+000000175     30                         PUSH int 0
+000000176     30                 CALL_BUILTIN void printf
+000000177     30                          POP 3
+000000178     31                  LEAVE_FRAME
+000000179     31                       RETURN 2
+
+
+Function: main
+
+000000180     35                  ENTER_FRAME 0x558b0fb4c158
+000000181     34                    PUSH_ZERO 2
+000000182     34                         CALL test (1)
+000000183     35                  LEAVE_FRAME
+000000184     35                       RETURN 2
+
+000000185     35               REF_CNT_GLOBAL -- [1]str rtlargv
+000000186     35                         HALT
\ No newline at end of file
@@ -0,0 +1,2974 @@
+
+Module: /root/repo/benchmarks/nbody.um
+
+000000000    139                         GOTO 2495
+
+
+Module: /root/repo/benchmarks/std.um
+
+000000001    426                         GOTO 1927
+
+
+Function: error
+
+000000002     49                  ENTER_FRAME 0x55a2cce2a518
+000000003     41          PUSH_LOCAL_PTR_ZERO -72 56
+000000004     41                   PUSH_LOCAL int 48
+000000005     41                       ASSIGN int 8
+000000006     41               PUSH_LOCAL_PTR -64
+000000007     41                   PUSH_LOCAL str 40
+000000008     41               REF_CNT_ASSIGN str
+000000009     41               PUSH_LOCAL_PTR -56
+000000010     41               PUSH_LOCAL_PTR 24
+000000011     41               REF_CNT_ASSIGN interface
+000000012     41               PUSH_LOCAL_PTR -40
+000000013     41          PUSH_LOCAL_PTR_ZERO -96 24
+000000014     41               REF_CNT_ASSIGN []ErrPos
+000000015     41               PUSH_LOCAL_PTR -72
+000000016     41                      REF_CNT ++ Err
+000000017     41               PUSH_LOCAL_PTR -152
+000000018     41                  SWAP_ASSIGN struct 56
+000000019     42                   PUSH_LOCAL int 48
+000000020     42                         PUSH int 0
+000000021     47               GOTO_IF_EQ_INT int 52
+000000022     43               PUSH_LOCAL_PTR -176
+000000023     43                         ZERO 24
+000000024     44                         PUSH int 2
+000000025     44               PUSH_LOCAL_PTR -184
+000000026     44                  SWAP_ASSIGN int 8
+
+000000027     44                   PUSH_LOCAL int -184
+000000028     44                         PUSH int 10
+000000029     44                     LESS_INT int
+000000030     44                          DUP
+000000031     44                  GOTO_IF_NOT 41
+
+000000032     44                          POP 1
+000000033     44                    PUSH_ZERO 2
+000000034     44                   PUSH_LOCAL int -184
+000000035     44               PUSH_LOCAL_PTR -176
+000000036     44                      REF_CNT ++ ^ErrPos
+000000037     44                         CALL <unknown> (1)
+000000038     44                     PUSH_REG RESULT
+000000039     44                         PUSH int 0
+000000040     44                       EQ_INT int
+
+000000041     46                  GOTO_IF_NOT 51
+
+000000042     45               PUSH_LOCAL_PTR -120
+000000043     45               PUSH_LOCAL_PTR -120
+000000044     45               PUSH_LOCAL_PTR -176
+000000045     45                         PUSH int 1
+000000046     45               PUSH_LOCAL_PTR -208
+000000047     45                 CALL_BUILTIN []ErrPos append
+000000048     45               REF_CNT_ASSIGN -- []ErrPos
+000000049     46                INC_LOCAL_INT -184
+000000050     46                         GOTO 27
+
+000000051     47                REF_CNT_LOCAL -- ErrPos -176
+000000052     48               PUSH_LOCAL_PTR -152
+000000053     48                   PUSH_LOCAL ^ 16
+000000054     48                  SWAP_ASSIGN struct 56
+000000055     48                   PUSH_LOCAL ^ 16
+000000056     48                      REF_CNT ++ Err
+000000057     48                      POP_REG RESULT
+000000058     48                REF_CNT_LOCAL -- Err -152
+000000059     48                REF_CNT_LOCAL -- Err -72
+000000060     49                         GOTO 63
+
+000000061     49                REF_CNT_LOCAL -- Err -152
+000000062     49                REF_CNT_LOCAL -- Err -72
+
+000000063     49                REF_CNT_LOCAL -- interface 24
+000000064     49                REF_CNT_LOCAL -- str 40
+000000065     49                  LEAVE_FRAME
+000000066     49                       RETURN 7
+
+
+Function: stderror
+
+000000067     53                  ENTER_FRAME 0x55a2cce2ba88
+000000068     52                    PUSH_ZERO 2
+000000069     52                   PUSH_LOCAL int 24
+000000070     52                 ASSERT_RANGE StdErr int
+000000071     52                         PUSH ^ stdErrMsg
+000000072     52                   PUSH_LOCAL int 24
+000000073     52                 ASSERT_RANGE StdErr int
+000000074     52                 GET_DYNARRAY str
+000000075     52                      REF_CNT ++ str
+000000076     52                         PUSH ^ 0x55a2cce2b998
+000000077     52                 CALL_BUILTIN str new
+000000078     52                          DUP
+000000079     52                      POP_REG HEAP_COPY
+000000080     52          SWAP_REF_CNT_ASSIGN str
+000000081     52                     PUSH_REG HEAP_COPY
+000000082     52               PUSH_LOCAL_PTR -32
+000000083     52                  SWAP_ASSIGN ^ 0
+000000084     52                         PUSH ^ 0x55a2cce2ba28
+000000085     52               PUSH_LOCAL_PTR -24
+000000086     52                  SWAP_ASSIGN ^ 0
+000000087     52               PUSH_LOCAL_PTR -32
+000000088     52                 ASSIGN_PARAM interface 16
+000000089     52          PUSH_LOCAL_PTR_ZERO -104 56
+000000090     52                         CALL error (2)
+000000091     52                     PUSH_REG RESULT
+000000092     52                          DUP
+000000093     52               PUSH_LOCAL_PTR -160
+000000094     52                  SWAP_ASSIGN struct 56
+000000095     52                   PUSH_LOCAL ^ 16
+000000096     52                  SWAP_ASSIGN struct 56
+000000097     52                   PUSH_LOCAL ^ 16
+000000098     52                      REF_CNT ++ Err
+000000099     52                      POP_REG RESULT
+000000100     52                REF_CNT_LOCAL -- Err -160
+000000101     53                         GOTO 103
+
+000000102     53                REF_CNT_LOCAL -- Err -160
+
+000000103     53                  LEAVE_FRAME
+000000104     53                       RETURN 4
+
+
+Function: exitif
+
+000000105     64                  ENTER_FRAME 0x55a2cce2b568
+000000106     56                   PUSH_LOCAL int 16
+000000107     56                         PUSH int 0
+000000108     63               GOTO_IF_EQ_INT int 200
+000000109     57                         PUSH int 0
+000000110     57                         PUSH ^ (nil)
+000000111     57                         PUSH ^ 0x55a2cce2bf58
+000000112     57                   PUSH_LOCAL str 24
+000000113     57                 CALL_BUILTIN str sprintf
+000000114     57                   PUSH_LOCAL int 16
+000000115     57                 CALL_BUILTIN int sprintf
+000000116     57               PUSH_LOCAL_PTR 32
+000000117     57                 CALL_BUILTIN interface sprintf
+000000118     57                         PUSH int 0
+000000119     57                 CALL_BUILTIN void sprintf
+000000120     57                          POP 1
+000000121     57                         SWAP
+000000122     57                          POP 1
+000000123     57               PUSH_LOCAL_PTR -32
+000000124     57                  SWAP_ASSIGN str 8
+000000125     58               PUSH_LOCAL_PTR -32
+000000126     58                          DUP
+000000127     58                        DEREF str
+000000128     58                         PUSH int 0
+000000129     58                         PUSH ^ (nil)
+000000130     58                         PUSH ^ 0x55a2cce2c248
+000000131     58                         PUSH int 0
+000000132     58                 CALL_BUILTIN void sprintf
+000000133     58                          POP 1
+000000134     58                         SWAP
+000000135     58                          POP 1
+000000136     58                          DUP
+000000137     58               PUSH_LOCAL_PTR -40
+000000138     58                  SWAP_ASSIGN str 8
+000000139     58                       BINARY += str
+000000140     58                          DUP
+000000141     58               PUSH_LOCAL_PTR -48
+000000142     58                  SWAP_ASSIGN str 8
+000000143     58               REF_CNT_ASSIGN str
+000000144     59               PUSH_LOCAL_PTR 48
+000000145     59                          DUP
+000000146     59                 CALL_BUILTIN [] len
+000000147     59               PUSH_LOCAL_PTR -56
+000000148     59                  SWAP_ASSIGN int 8
+000000149     59          PUSH_LOCAL_PTR_ZERO -80 24
+000000150     59          SWAP_REF_CNT_ASSIGN []ErrPos
+000000151     59               PUSH_LOCAL_PTR -88
+000000152     59                         ZERO 8
+000000153     59               PUSH_LOCAL_PTR -112
+000000154     59                         ZERO 24
+
+000000155     59                   PUSH_LOCAL int -88
+000000156     59                   PUSH_LOCAL int -56
+000000157     61       GOTO_IF_GREATER_EQ_INT int 192
+000000158     59                   PUSH_LOCAL [] -80
+000000159     59                   PUSH_LOCAL int -88
+000000160     59                 GET_DYNARRAY struct
+000000161     59               PUSH_LOCAL_PTR -112
+000000162     59          SWAP_REF_CNT_ASSIGN ErrPos
+000000163     60               PUSH_LOCAL_PTR -32
+000000164     60                          DUP
+000000165     60                        DEREF str
+000000166     60                         PUSH int 0
+000000167     60                         PUSH ^ (nil)
+000000168     60                         PUSH ^ 0x55a2cce2cad8
+000000169     60                   PUSH_LOCAL str -104
+000000170     60                 CALL_BUILTIN str sprintf
+000000171     60                   PUSH_LOCAL str -112
+000000172     60                 CALL_BUILTIN str sprintf
+000000173     60                   PUSH_LOCAL int -96
+000000174     60                 CALL_BUILTIN int sprintf
+000000175     60                         PUSH int 0
+000000176     60                 CALL_BUILTIN void sprintf
+000000177     60                          POP 1
+000000178     60                         SWAP
+000000179     60                          POP 1
+000000180     60                          DUP
+000000181     60               PUSH_LOCAL_PTR -120
+000000182     60                  SWAP_ASSIGN str 8
+000000183     60                       BINARY += str
+000000184     60                          DUP
+000000185     60               PUSH_LOCAL_PTR -128
+000000186     60                  SWAP_ASSIGN str 8
+000000187     60               REF_CNT_ASSIGN str
+000000188     61                REF_CNT_LOCAL -- str -128
+000000189     61                REF_CNT_LOCAL -- str -120
+000000190     61                INC_LOCAL_INT -88
+000000191     61                         GOTO 155
+
+000000192     61                REF_CNT_LOCAL -- ErrPos -112
+000000193     61                REF_CNT_LOCAL -- []ErrPos -80
+000000194     62                   PUSH_LOCAL int 16
+000000195     62                   PUSH_LOCAL str -32
+000000196     62                 CALL_BUILTIN void exit
+000000197     63                REF_CNT_LOCAL -- str -48
+000000198     63                REF_CNT_LOCAL -- str -40
+000000199     63                REF_CNT_LOCAL -- str -32
+000000200     64                REF_CNT_LOCAL -- Err 16
+000000201     64                  LEAVE_FRAME
+000000202     64                       RETURN 9
+
+
+Function: assert
+
+000000203     74                  ENTER_FRAME 0x55a2cce2d508
+000000204     67                   PUSH_LOCAL bool 24
+000000205     67                        UNARY ! bool
+000000206     73                  GOTO_IF_NOT 240
+
+000000207     68                    PUSH_ZERO 2
+000000208     68                         PUSH int 1
+000000209     68          PUSH_LOCAL_PTR_ZERO -72 56
+000000210     68                         CALL stderror (67)
+000000211     68                     PUSH_REG RESULT
+000000212     68               PUSH_LOCAL_PTR -184
+000000213     68                  SWAP_ASSIGN struct 56
+000000214     69                   PUSH_LOCAL str 16
+000000215     69                         PUSH ^ 0x55a2cce2b6a8
+000000216     69                       BINARY != str
+000000217     71                  GOTO_IF_NOT 234
+
+000000218     70               PUSH_LOCAL_PTR -176
+000000219     70                          DUP
+000000220     70                        DEREF str
+000000221     70                         PUSH ^ 0x55a2cce2b008
+000000222     70                   PUSH_LOCAL str 16
+000000223     70                       BINARY + str
+000000224     70                          DUP
+000000225     70               PUSH_LOCAL_PTR -192
+000000226     70                  SWAP_ASSIGN str 8
+000000227     70                       BINARY += str
+000000228     70                          DUP
+000000229     70               PUSH_LOCAL_PTR -200
+000000230     70                  SWAP_ASSIGN str 8
+000000231     70               REF_CNT_ASSIGN str
+000000232     71                REF_CNT_LOCAL -- str -200
+000000233     71                REF_CNT_LOCAL -- str -192
+
+000000234     72                    PUSH_ZERO 2
+000000235     72               PUSH_LOCAL_PTR -184
+000000236     72                      REF_CNT ++ Err
+000000237     72                 ASSIGN_PARAM struct 56
+000000238     72                         CALL exitif (105)
+000000239     73                REF_CNT_LOCAL -- Err -184
+
+000000240     74                REF_CNT_LOCAL -- str 16
+000000241     74                  LEAVE_FRAME
+000000242     74                       RETURN 4
+
+000000243    426                         GOTO 1921
+
+
+Function: tobytes
+
+000000244     87                  ENTER_FRAME 0x55a2cce2e258
+000000245     81               PUSH_LOCAL_PTR 24
+000000246     81                 CALL_BUILTIN interface valid
+000000247     81                        UNARY ! bool
+000000248     83                  GOTO_IF_NOT 256
+
+000000249     82          PUSH_LOCAL_PTR_ZERO -40 24
+000000250     82                   PUSH_LOCAL ^ 16
+000000251     82                  SWAP_ASSIGN [] 24
+000000252     82                   PUSH_LOCAL ^ 16
+000000253     82                      REF_CNT ++ []uint8
+000000254     82                      POP_REG RESULT
+000000255     87                         GOTO 282
+
+000000256     84               PUSH_LOCAL_PTR 24
+000000257     84                 CALL_BUILTIN interface sizeofself
+000000258     84               PUSH_LOCAL_PTR -64
+000000259     84                 CALL_BUILTIN []uint8 make
+000000260     84               PUSH_LOCAL_PTR -112
+000000261     84                  SWAP_ASSIGN [] 24
+000000262     85                    PUSH_ZERO 2
+000000263     85               PUSH_LOCAL_PTR -112
+000000264     85                         PUSH int 0
+000000265     85             GET_DYNARRAY_PTR
+000000266     85                      REF_CNT ++ ^void
+000000267     85               PUSH_LOCAL_PTR 24
+000000268     85                 CALL_BUILTIN interface selfptr
+000000269     85                      REF_CNT ++ ^void
+000000270     85               PUSH_LOCAL_PTR 24
+000000271     85                 CALL_BUILTIN interface sizeofself
+000000272     85                         CALL <unknown> (243)
+000000273     86               PUSH_LOCAL_PTR -112
+000000274     86                   PUSH_LOCAL ^ 16
+000000275     86                  SWAP_ASSIGN [] 24
+000000276     86                   PUSH_LOCAL ^ 16
+000000277     86                      REF_CNT ++ []uint8
+000000278     86                      POP_REG RESULT
+000000279     86                REF_CNT_LOCAL -- []uint8 -112
+000000280     87                         GOTO 282
+
+000000281     87                REF_CNT_LOCAL -- []uint8 -112
+
+000000282     87                REF_CNT_LOCAL -- interface 24
+000000283     87                  LEAVE_FRAME
+000000284     87                       RETURN 5
+
+
+Function: frombytes
+
+000000285     98                  ENTER_FRAME 0x55a2cce2eb48
+000000286     90               PUSH_LOCAL_PTR 48
+000000287     90                 CALL_BUILTIN interface valid
+000000288     90                        UNARY ! bool
+000000289     90                          DUP
+000000290     90                      GOTO_IF 297
+
+000000291     90                          POP 1
+000000292     90               PUSH_LOCAL_PTR 48
+000000293     90                 CALL_BUILTIN interface sizeofself
+000000294     90               PUSH_LOCAL_PTR 24
+000000295     90                 CALL_BUILTIN [] len
+000000296     90                   NOT_EQ_INT int
+
+000000297     92                  GOTO_IF_NOT 314
+
+000000298     91                    PUSH_ZERO 2
+000000299     91                         PUSH int 2
+000000300     91          PUSH_LOCAL_PTR_ZERO -72 56
+000000301     91                         CALL stderror (67)
+000000302     91                     PUSH_REG RESULT
+000000303     91                          DUP
+000000304     91               PUSH_LOCAL_PTR -128
+000000305     91                  SWAP_ASSIGN struct 56
+000000306     91                   PUSH_LOCAL ^ 16
+000000307     91                  SWAP_ASSIGN struct 56
+000000308     91                   PUSH_LOCAL ^ 16
+000000309     91                      REF_CNT ++ Err
+000000310     91                      POP_REG RESULT
+000000311     91                REF_CNT_LOCAL -- Err -128
+000000312     98                         GOTO 353
+
+000000313     92                REF_CNT_LOCAL -- Err -128
+
+000000314     93               PUSH_LOCAL_PTR 48
+000000315     93                 CALL_BUILTIN interface selfhasptr
+000000316     95                  GOTO_IF_NOT 333
+
+000000317     94                    PUSH_ZERO 2
+000000318     94                         PUSH int 3
+000000319     94          PUSH_LOCAL_PTR_ZERO -184 56
+000000320     94                         CALL stderror (67)
+000000321     94                     PUSH_REG RESULT
+000000322     94                          DUP
+000000323     94               PUSH_LOCAL_PTR -240
+000000324     94                  SWAP_ASSIGN struct 56
+000000325     94                   PUSH_LOCAL ^ 16
+000000326     94                  SWAP_ASSIGN struct 56
+000000327     94                   PUSH_LOCAL ^ 16
+000000328     94                      REF_CNT ++ Err
+000000329     94                      POP_REG RESULT
+000000330     94                REF_CNT_LOCAL -- Err -240
+000000331     98                         GOTO 353
+
+000000332     95                REF_CNT_LOCAL -- Err -240
+
+000000333     96                    PUSH_ZERO 2
+000000334     96               PUSH_LOCAL_PTR 48
+000000335     96                 CALL_BUILTIN interface selfptr
+000000336     96                      REF_CNT ++ ^void
+000000337     96               PUSH_LOCAL_PTR 24
+000000338     96                         PUSH int 0
+000000339     96             GET_DYNARRAY_PTR
+000000340     96                      REF_CNT ++ ^void
+000000341     96               PUSH_LOCAL_PTR 48
+000000342     96                 CALL_BUILTIN interface sizeofself
+000000343     96                         CALL <unknown> (243)
+000000344     97          PUSH_LOCAL_PTR_ZERO -296 56
+000000345     97                   PUSH_LOCAL ^ 16
+000000346     97                  SWAP_ASSIGN struct 56
+000000347     97                   PUSH_LOCAL ^ 16
+000000348     97                      REF_CNT ++ Err
+000000349     97                      POP_REG RESULT
+000000350     97                REF_CNT_LOCAL -- Err -296
+000000351     98                         GOTO 353
+
+000000352     98                REF_CNT_LOCAL -- Err -296
+
+000000353     98                REF_CNT_LOCAL -- []uint8 24
+000000354     98                REF_CNT_LOCAL -- interface 48
+000000355     98                  LEAVE_FRAME
+000000356     98                       RETURN 8
+
+000000357    426                         GOTO 1917
+
+
+Function: stdin
+
+000000358    116                  ENTER_FRAME 0x55a2cce2fad8
+000000359    115                    PUSH_ZERO 2
+000000360    115                         CALL <unknown> (357)
+000000361    116                         GOTO 362
+
+000000362    116                  LEAVE_FRAME
+000000363    116                       RETURN 2
+
+000000364    426                         GOTO 1913
+
+
+Function: stdout
+
+000000365    122                  ENTER_FRAME 0x55a2cce302b8
+000000366    121                    PUSH_ZERO 2
+000000367    121                         CALL <unknown> (364)
+000000368    122                         GOTO 369
+
+000000369    122                  LEAVE_FRAME
+000000370    122                       RETURN 2
+
+000000371    426                         GOTO 1909
+
+
+Function: stderr
+
+000000372    128                  ENTER_FRAME 0x55a2cce30a98
+000000373    127                    PUSH_ZERO 2
+000000374    127                         CALL <unknown> (371)
+000000375    128                         GOTO 376
+
+000000376    128                  LEAVE_FRAME
+000000377    128                       RETURN 2
+
+000000378    426                         GOTO 1903
+
+
+Function: fopen
+
+000000379    147                  ENTER_FRAME 0x55a2cce32b68
+000000380    140                         PUSH ^ fopenModes
+000000381    140                         PUSH int 15
+000000382    140               PUSH_LOCAL_PTR -24
+000000383    140                  SWAP_ASSIGN int 8
+000000384    140          PUSH_LOCAL_PTR_ZERO -32 8
+000000385    140          SWAP_REF_CNT_ASSIGN ^[15]str
+000000386    140               PUSH_LOCAL_PTR -40
+000000387    140                         ZERO 8
+000000388    140               PUSH_LOCAL_PTR -48
+000000389    140                         ZERO 8
+
+000000390    140                   PUSH_LOCAL int -40
+000000391    140                   PUSH_LOCAL int -24
+000000392    145       GOTO_IF_GREATER_EQ_INT int 466
+000000393    140                   PUSH_LOCAL ^ -32
+000000394    140                   PUSH_LOCAL int -40
+000000395    140                    GET_ARRAY str 8 15
+000000396    140               PUSH_LOCAL_PTR -48
+000000397    140          SWAP_REF_CNT_ASSIGN str
+000000398    141                   PUSH_LOCAL str 24
+000000399    141                   PUSH_LOCAL str -48
+000000400    141                       BINARY == str
+000000401    144                  GOTO_IF_NOT 464
+
+000000402    142                    PUSH_ZERO 2
+000000403    142                   PUSH_LOCAL str 32
+000000404    142                      REF_CNT ++ str
+000000405    142                   PUSH_LOCAL str 24
+000000406    142                      REF_CNT ++ str
+000000407    142                         CALL <unknown> (378)
+000000408    142                     PUSH_REG RESULT
+000000409    142               PUSH_LOCAL_PTR -64
+000000410    142                  SWAP_ASSIGN ^ 8
+000000411    143                   PUSH_LOCAL ^ -64
+000000412    143                   PUSH_LOCAL ^ -64
+000000413    143                         PUSH ^ (nil)
+000000414    143                       BINARY != File
+000000415    143                  GOTO_IF_NOT 430
+
+000000416    143                    PUSH_ZERO 2
+000000417    143                         PUSH int 0
+000000418    143          PUSH_LOCAL_PTR_ZERO -120 56
+000000419    143                         CALL stderror (67)
+000000420    143                     PUSH_REG RESULT
+000000421    143                          DUP
+000000422    143               PUSH_LOCAL_PTR -176
+000000423    143                  SWAP_ASSIGN struct 56
+000000424    143                          DUP
+000000425    143                      REF_CNT ++ Err
+000000426    143               PUSH_LOCAL_PTR -232
+000000427    143                  SWAP_ASSIGN struct 56
+000000428    143                REF_CNT_LOCAL -- Err -176
+000000429    143                         GOTO 443
+
+000000430    143                    PUSH_ZERO 2
+000000431    143                         PUSH int 4
+000000432    143          PUSH_LOCAL_PTR_ZERO -288 56
+000000433    143                         CALL stderror (67)
+000000434    143                     PUSH_REG RESULT
+000000435    143                          DUP
+000000436    143               PUSH_LOCAL_PTR -344
+000000437    143                  SWAP_ASSIGN struct 56
+000000438    143                          DUP
+000000439    143                      REF_CNT ++ Err
+000000440    143               PUSH_LOCAL_PTR -232
+000000441    143                  SWAP_ASSIGN struct 56
+000000442    143                REF_CNT_LOCAL -- Err -344
+
+000000443    143               PUSH_LOCAL_PTR -408
+000000444    143                         ZERO 64
+000000445    143               PUSH_LOCAL_PTR -400
+000000446    143          SWAP_REF_CNT_ASSIGN Err
+000000447    143               PUSH_LOCAL_PTR -408
+000000448    143          SWAP_REF_CNT_ASSIGN File
+000000449    143               PUSH_LOCAL_PTR -408
+000000450    143                   PUSH_LOCAL ^ 16
+000000451    143                  SWAP_ASSIGN struct 64
+000000452    143                   PUSH_LOCAL ^ 16
+000000453    143                      REF_CNT ++ { File Err }
+000000454    143                      POP_REG RESULT
+000000455    143                REF_CNT_LOCAL -- { File Err } -408
+000000456    143                REF_CNT_LOCAL -- Err -232
+000000457    143                REF_CNT_LOCAL -- File -64
+000000458    143                REF_CNT_LOCAL -- str -48
+000000459    143                REF_CNT_LOCAL -- ^[15]str -32
+000000460    147                         GOTO 494
+
+000000461    144                REF_CNT_LOCAL -- { File Err } -408
+000000462    144                REF_CNT_LOCAL -- Err -232
+000000463    144                REF_CNT_LOCAL -- File -64
+
+000000464    145                INC_LOCAL_INT -40
+000000465    145                         GOTO 390
+
+000000466    145                REF_CNT_LOCAL -- str -48
+000000467    145                REF_CNT_LOCAL -- ^[15]str -32
+000000468    146                         PUSH ^ (nil)
+000000469    146                    PUSH_ZERO 2
+000000470    146                         PUSH int 4
+000000471    146          PUSH_LOCAL_PTR_ZERO -464 56
+000000472    146                         CALL stderror (67)
+000000473    146                     PUSH_REG RESULT
+000000474    146                          DUP
+000000475    146               PUSH_LOCAL_PTR -520
+000000476    146                  SWAP_ASSIGN struct 56
+000000477    146               PUSH_LOCAL_PTR -584
+000000478    146                         ZERO 64
+000000479    146               PUSH_LOCAL_PTR -576
+000000480    146          SWAP_REF_CNT_ASSIGN Err
+000000481    146               PUSH_LOCAL_PTR -584
+000000482    146          SWAP_REF_CNT_ASSIGN File
+000000483    146               PUSH_LOCAL_PTR -584
+000000484    146                   PUSH_LOCAL ^ 16
+000000485    146                  SWAP_ASSIGN struct 64
+000000486    146                   PUSH_LOCAL ^ 16
+000000487    146                      REF_CNT ++ { File Err }
+000000488    146                      POP_REG RESULT
+000000489    146                REF_CNT_LOCAL -- { File Err } -584
+000000490    146                REF_CNT_LOCAL -- Err -520
+000000491    147                         GOTO 494
+
+000000492    147                REF_CNT_LOCAL -- { File Err } -584
+000000493    147                REF_CNT_LOCAL -- Err -520
+
+000000494    147                REF_CNT_LOCAL -- str 24
+000000495    147                REF_CNT_LOCAL -- str 32
+000000496    147                  LEAVE_FRAME
+000000497    147                       RETURN 5
+
+000000498    426                         GOTO 1898
+
+
+Function: fclose
+
+000000499    156                  ENTER_FRAME 0x55a2cce341d8
+000000500    152                   PUSH_LOCAL ^ 24
+000000501    152                         PUSH ^ (nil)
+000000502    152                       BINARY == File
+000000503    154                  GOTO_IF_NOT 520
+
+000000504    153                    PUSH_ZERO 2
+000000505    153                         PUSH int 4
+000000506    153          PUSH_LOCAL_PTR_ZERO -72 56
+000000507    153                         CALL stderror (67)
+000000508    153                     PUSH_REG RESULT
+000000509    153                          DUP
+000000510    153               PUSH_LOCAL_PTR -128
+000000511    153                  SWAP_ASSIGN struct 56
+000000512    153                   PUSH_LOCAL ^ 16
+000000513    153                  SWAP_ASSIGN struct 56
+000000514    153                   PUSH_LOCAL ^ 16
+000000515    153                      REF_CNT ++ Err
+000000516    153                      POP_REG RESULT
+000000517    153                REF_CNT_LOCAL -- Err -128
+000000518    156                         GOTO 562
+
+000000519    154                REF_CNT_LOCAL -- Err -128
+
+000000520    155                    PUSH_ZERO 2
+000000521    155                   PUSH_LOCAL ^ 24
+000000522    155                      REF_CNT ++ File
+000000523    155                         CALL <unknown> (498)
+000000524    155                     PUSH_REG RESULT
+000000525    155                         PUSH int 0
+000000526    155           GOTO_IF_NOT_EQ_INT int 541
+000000527    155                    PUSH_ZERO 2
+000000528    155                         PUSH int 0
+000000529    155          PUSH_LOCAL_PTR_ZERO -184 56
+000000530    155                         CALL stderror (67)
+000000531    155                     PUSH_REG RESULT
+000000532    155                          DUP
+000000533    155               PUSH_LOCAL_PTR -240
+000000534    155                  SWAP_ASSIGN struct 56
+000000535    155                          DUP
+000000536    155                      REF_CNT ++ Err
+000000537    155               PUSH_LOCAL_PTR -296
+000000538    155                  SWAP_ASSIGN struct 56
+000000539    155                REF_CNT_LOCAL -- Err -240
+000000540    155                         GOTO 554
+
+000000541    155                    PUSH_ZERO 2
+000000542    155                         PUSH int 5
+000000543    155          PUSH_LOCAL_PTR_ZERO -352 56
+000000544    155                         CALL stderror (67)
+000000545    155                     PUSH_REG RESULT
+000000546    155                          DUP
+000000547    155               PUSH_LOCAL_PTR -408
+000000548    155                  SWAP_ASSIGN struct 56
+000000549    155                          DUP
+000000550    155                      REF_CNT ++ Err
+000000551    155               PUSH_LOCAL_PTR -296
+000000552    155                  SWAP_ASSIGN struct 56
+000000553    155                REF_CNT_LOCAL -- Err -408
+
+000000554    155                   PUSH_LOCAL ^ 16
+000000555    155                  SWAP_ASSIGN struct 56
+000000556    155                   PUSH_LOCAL ^ 16
+000000557    155                      REF_CNT ++ Err
+000000558    155                      POP_REG RESULT
+000000559    155                REF_CNT_LOCAL -- Err -296
+000000560    156                         GOTO 562
+
+000000561    156                REF_CNT_LOCAL -- Err -296
+
+000000562    156                REF_CNT_LOCAL -- File 24
+000000563    156                  LEAVE_FRAME
+000000564    156                       RETURN 4
+
+000000565    426                         GOTO 1893
+
+
+Function: fseek
+
+000000566    165                  ENTER_FRAME 0x55a2cce356e8
+000000567    161                   PUSH_LOCAL ^ 40
+000000568    161                         PUSH ^ (nil)
+000000569    161                       BINARY == File
+000000570    163                  GOTO_IF_NOT 587
+
+000000571    162                    PUSH_ZERO 2
+000000572    162                         PUSH int 4
+000000573    162          PUSH_LOCAL_PTR_ZERO -72 56
+000000574    162                         CALL stderror (67)
+000000575    162                     PUSH_REG RESULT
+000000576    162                          DUP
+000000577    162               PUSH_LOCAL_PTR -128
+000000578    162                  SWAP_ASSIGN struct 56
+000000579    162                   PUSH_LOCAL ^ 16
+000000580    162                  SWAP_ASSIGN struct 56
+000000581    162                   PUSH_LOCAL ^ 16
+000000582    162                      REF_CNT ++ Err
+000000583    162                      POP_REG RESULT
+000000584    162                REF_CNT_LOCAL -- Err -128
+000000585    165                         GOTO 631
+
+000000586    163                REF_CNT_LOCAL -- Err -128
+
+000000587    164                    PUSH_ZERO 2
+000000588    164                   PUSH_LOCAL ^ 40
+000000589    164                      REF_CNT ++ File
+000000590    164                   PUSH_LOCAL int 32
+000000591    164                   PUSH_LOCAL int 24
+000000592    164                         CALL <unknown> (565)
+000000593    164                     PUSH_REG RESULT
+000000594    164                         PUSH int 0
+000000595    164           GOTO_IF_NOT_EQ_INT int 610
+000000596    164                    PUSH_ZERO 2
+000000597    164                         PUSH int 0
+000000598    164          PUSH_LOCAL_PTR_ZERO -184 56
+000000599    164                         CALL stderror (67)
+000000600    164                     PUSH_REG RESULT
+000000601    164                          DUP
+000000602    164               PUSH_LOCAL_PTR -240
+000000603    164                  SWAP_ASSIGN struct 56
+000000604    164                          DUP
+000000605    164                      REF_CNT ++ Err
+000000606    164               PUSH_LOCAL_PTR -296
+000000607    164                  SWAP_ASSIGN struct 56
+000000608    164                REF_CNT_LOCAL -- Err -240
+000000609    164                         GOTO 623
+
+000000610    164                    PUSH_ZERO 2
+000000611    164                         PUSH int 5
+000000612    164          PUSH_LOCAL_PTR_ZERO -352 56
+000000613    164                         CALL stderror (67)
+000000614    164                     PUSH_REG RESULT
+000000615    164                          DUP
+000000616    164               PUSH_LOCAL_PTR -408
+000000617    164                  SWAP_ASSIGN struct 56
+000000618    164                          DUP
+000000619    164                      REF_CNT ++ Err
+000000620    164               PUSH_LOCAL_PTR -296
+000000621    164                  SWAP_ASSIGN struct 56
+000000622    164                REF_CNT_LOCAL -- Err -408
+
+000000623    164                   PUSH_LOCAL ^ 16
+000000624    164                  SWAP_ASSIGN struct 56
+000000625    164                   PUSH_LOCAL ^ 16
+000000626    164                      REF_CNT ++ Err
+000000627    164                      POP_REG RESULT
+000000628    164                REF_CNT_LOCAL -- Err -296
+000000629    165                         GOTO 631
+
+000000630    165                REF_CNT_LOCAL -- Err -296
+
+000000631    165                REF_CNT_LOCAL -- File 40
+000000632    165                  LEAVE_FRAME
+000000633    165                       RETURN 6
+
+000000634    426                         GOTO 1888
+
+
+Function: ftell
+
+000000635    175                  ENTER_FRAME 0x55a2cce36ba8
+000000636    170                   PUSH_LOCAL ^ 24
+000000637    170                         PUSH ^ (nil)
+000000638    170                       BINARY == File
+000000639    172                  GOTO_IF_NOT 666
+
+000000640    171                         PUSH int 0
+000000641    171                    PUSH_ZERO 2
+000000642    171                         PUSH int 4
+000000643    171          PUSH_LOCAL_PTR_ZERO -72 56
+000000644    171                         CALL stderror (67)
+000000645    171                     PUSH_REG RESULT
+000000646    171                          DUP
+000000647    171               PUSH_LOCAL_PTR -128
+000000648    171                  SWAP_ASSIGN struct 56
+000000649    171               PUSH_LOCAL_PTR -192
+000000650    171                         ZERO 64
+000000651    171               PUSH_LOCAL_PTR -184
+000000652    171          SWAP_REF_CNT_ASSIGN Err
+000000653    171               PUSH_LOCAL_PTR -192
+000000654    171                  SWAP_ASSIGN int 8
+000000655    171               PUSH_LOCAL_PTR -192
+000000656    171                   PUSH_LOCAL ^ 16
+000000657    171                  SWAP_ASSIGN struct 64
+000000658    171                   PUSH_LOCAL ^ 16
+000000659    171                      REF_CNT ++ { int Err }
+000000660    171                      POP_REG RESULT
+000000661    171                REF_CNT_LOCAL -- { int Err } -192
+000000662    171                REF_CNT_LOCAL -- Err -128
+000000663    175                         GOTO 721
+
+000000664    172                REF_CNT_LOCAL -- { int Err } -192
+000000665    172                REF_CNT_LOCAL -- Err -128
+
+000000666    173                    PUSH_ZERO 2
+000000667    173                   PUSH_LOCAL ^ 24
+000000668    173                      REF_CNT ++ File
+000000669    173                         CALL <unknown> (634)
+000000670    173                     PUSH_REG RESULT
+000000671    173               PUSH_LOCAL_PTR -200
+000000672    173                  SWAP_ASSIGN int 8
+000000673    174                   PUSH_LOCAL int -200
+000000674    174                   PUSH_LOCAL int -200
+000000675    174                         PUSH int 0
+000000676    174             GOTO_IF_LESS_INT int 691
+000000677    174                    PUSH_ZERO 2
+000000678    174                         PUSH int 0
+000000679    174          PUSH_LOCAL_PTR_ZERO -256 56
+000000680    174                         CALL stderror (67)
+000000681    174                     PUSH_REG RESULT
+000000682    174                          DUP
+000000683    174               PUSH_LOCAL_PTR -312
+000000684    174                  SWAP_ASSIGN struct 56
+000000685    174                          DUP
+000000686    174                      REF_CNT ++ Err
+000000687    174               PUSH_LOCAL_PTR -368
+000000688    174                  SWAP_ASSIGN struct 56
+000000689    174                REF_CNT_LOCAL -- Err -312
+000000690    174                         GOTO 704
+
+000000691    174                    PUSH_ZERO 2
+000000692    174                         PUSH int 5
+000000693    174          PUSH_LOCAL_PTR_ZERO -424 56
+000000694    174                         CALL stderror (67)
+000000695    174                     PUSH_REG RESULT
+000000696    174                          DUP
+000000697    174               PUSH_LOCAL_PTR -480
+000000698    174                  SWAP_ASSIGN struct 56
+000000699    174                          DUP
+000000700    174                      REF_CNT ++ Err
+000000701    174               PUSH_LOCAL_PTR -368
+000000702    174                  SWAP_ASSIGN struct 56
+000000703    174                REF_CNT_LOCAL -- Err -480
+
+000000704    174               PUSH_LOCAL_PTR -544
+000000705    174                         ZERO 64
+000000706    174               PUSH_LOCAL_PTR -536
+000000707    174          SWAP_REF_CNT_ASSIGN Err
+000000708    174               PUSH_LOCAL_PTR -544
+000000709    174                  SWAP_ASSIGN int 8
+000000710    174               PUSH_LOCAL_PTR -544
+000000711    174                   PUSH_LOCAL ^ 16
+000000712    174                  SWAP_ASSIGN struct 64
+000000713    174                   PUSH_LOCAL ^ 16
+000000714    174                      REF_CNT ++ { int Err }
+000000715    174                      POP_REG RESULT
+000000716    174                REF_CNT_LOCAL -- { int Err } -544
+000000717    174                REF_CNT_LOCAL -- Err -368
+000000718    175                         GOTO 721
+
+000000719    175                REF_CNT_LOCAL -- { int Err } -544
+000000720    175                REF_CNT_LOCAL -- Err -368
+
+000000721    175                REF_CNT_LOCAL -- File 24
+000000722    175                  LEAVE_FRAME
+000000723    175                       RETURN 4
+
+000000724    426                         GOTO 1883
+
+
+Function: remove
+
+000000725    181                  ENTER_FRAME 0x55a2cce37688
+000000726    180                    PUSH_ZERO 2
+000000727    180                   PUSH_LOCAL str 24
+000000728    180                      REF_CNT ++ str
+000000729    180                         CALL <unknown> (724)
+000000730    180                     PUSH_REG RESULT
+000000731    180                         PUSH int 0
+000000732    180           GOTO_IF_NOT_EQ_INT int 747
+000000733    180                    PUSH_ZERO 2
+000000734    180                         PUSH int 0
+000000735    180          PUSH_LOCAL_PTR_ZERO -72 56
+000000736    180                         CALL stderror (67)
+000000737    180                     PUSH_REG RESULT
+000000738    180                          DUP
+000000739    180               PUSH_LOCAL_PTR -128
+000000740    180                  SWAP_ASSIGN struct 56
+000000741    180                          DUP
+000000742    180                      REF_CNT ++ Err
+000000743    180               PUSH_LOCAL_PTR -184
+000000744    180                  SWAP_ASSIGN struct 56
+000000745    180                REF_CNT_LOCAL -- Err -128
+000000746    180                         GOTO 760
+
+000000747    180                    PUSH_ZERO 2
+000000748    180                         PUSH int 5
+000000749    180          PUSH_LOCAL_PTR_ZERO -240 56
+000000750    180                         CALL stderror (67)
+000000751    180                     PUSH_REG RESULT
+000000752    180                          DUP
+000000753    180               PUSH_LOCAL_PTR -296
+000000754    180                  SWAP_ASSIGN struct 56
+000000755    180                          DUP
+000000756    180                      REF_CNT ++ Err
+000000757    180               PUSH_LOCAL_PTR -184
+000000758    180                  SWAP_ASSIGN struct 56
+000000759    180                REF_CNT_LOCAL -- Err -296
+
+000000760    180                   PUSH_LOCAL ^ 16
+000000761    180                  SWAP_ASSIGN struct 56
+000000762    180                   PUSH_LOCAL ^ 16
+000000763    180                      REF_CNT ++ Err
+000000764    180                      POP_REG RESULT
+000000765    180                REF_CNT_LOCAL -- Err -184
+000000766    181                         GOTO 768
+
+000000767    181                REF_CNT_LOCAL -- Err -184
+
+000000768    181                REF_CNT_LOCAL -- str 24
+000000769    181                  LEAVE_FRAME
+000000770    181                       RETURN 4
+
+000000771    426                         GOTO 1878
+
+
+Function: feof
+
+000000772    190                  ENTER_FRAME 0x55a2cce37ec8
+000000773    186                   PUSH_LOCAL ^ 16
+000000774    186                         PUSH ^ (nil)
+000000775    186                       BINARY == File
+000000776    188                  GOTO_IF_NOT 780
+
+000000777    187                         PUSH int 1
+000000778    187                      POP_REG RESULT
+000000779    190                         GOTO 789
+
+000000780    189                    PUSH_ZERO 2
+000000781    189                   PUSH_LOCAL ^ 16
+000000782    189                      REF_CNT ++ File
+000000783    189                         CALL <unknown> (771)
+000000784    189                     PUSH_REG RESULT
+000000785    189                         PUSH int 0
+000000786    189                   NOT_EQ_INT int
+000000787    189                      POP_REG RESULT
+000000788    190                         GOTO 789
+
+000000789    190                REF_CNT_LOCAL -- File 16
+000000790    190                  LEAVE_FRAME
+000000791    190                       RETURN 3
+
+000000792    426                         GOTO 1873
+
+
+Function: fflush
+
+000000793    199                  ENTER_FRAME 0x55a2cce38e48
+000000794    195                   PUSH_LOCAL ^ 24
+000000795    195                         PUSH ^ (nil)
+000000796    195                       BINARY == File
+000000797    197                  GOTO_IF_NOT 814
+
+000000798    196                    PUSH_ZERO 2
+000000799    196                         PUSH int 4
+000000800    196          PUSH_LOCAL_PTR_ZERO -72 56
+000000801    196                         CALL stderror (67)
+000000802    196                     PUSH_REG RESULT
+000000803    196                          DUP
+000000804    196               PUSH_LOCAL_PTR -128
+000000805    196                  SWAP_ASSIGN struct 56
+000000806    196                   PUSH_LOCAL ^ 16
+000000807    196                  SWAP_ASSIGN struct 56
+000000808    196                   PUSH_LOCAL ^ 16
+000000809    196                      REF_CNT ++ Err
+000000810    196                      POP_REG RESULT
+000000811    196                REF_CNT_LOCAL -- Err -128
+000000812    199                         GOTO 856
+
+000000813    197                REF_CNT_LOCAL -- Err -128
+
+000000814    198                    PUSH_ZERO 2
+000000815    198                   PUSH_LOCAL ^ 24
+000000816    198                      REF_CNT ++ File
+000000817    198                         CALL <unknown> (792)
+000000818    198                     PUSH_REG RESULT
+000000819    198                         PUSH int 0
+000000820    198           GOTO_IF_NOT_EQ_INT int 835
+000000821    198                    PUSH_ZERO 2
+000000822    198                         PUSH int 0
+000000823    198          PUSH_LOCAL_PTR_ZERO -184 56
+000000824    198                         CALL stderror (67)
+000000825    198                     PUSH_REG RESULT
+000000826    198                          DUP
+000000827    198               PUSH_LOCAL_PTR -240
+000000828    198                  SWAP_ASSIGN struct 56
+000000829    198                          DUP
+000000830    198                      REF_CNT ++ Err
+000000831    198               PUSH_LOCAL_PTR -296
+000000832    198                  SWAP_ASSIGN struct 56
+000000833    198                REF_CNT_LOCAL -- Err -240
+000000834    198                         GOTO 848
+
+000000835    198                    PUSH_ZERO 2
+000000836    198                         PUSH int 5
+000000837    198          PUSH_LOCAL_PTR_ZERO -352 56
+000000838    198                         CALL stderror (67)
+000000839    198                     PUSH_REG RESULT
+000000840    198                          DUP
+000000841    198               PUSH_LOCAL_PTR -408
+000000842    198                  SWAP_ASSIGN struct 56
+000000843    198                          DUP
+000000844    198                      REF_CNT ++ Err
+000000845    198               PUSH_LOCAL_PTR -296
+000000846    198                  SWAP_ASSIGN struct 56
+000000847    198                REF_CNT_LOCAL -- Err -408
+
+000000848    198                   PUSH_LOCAL ^ 16
+000000849    198                  SWAP_ASSIGN struct 56
+000000850    198                   PUSH_LOCAL ^ 16
+000000851    198                      REF_CNT ++ Err
+000000852    198                      POP_REG RESULT
+000000853    198                REF_CNT_LOCAL -- Err -296
+000000854    199                         GOTO 856
+
+000000855    199                REF_CNT_LOCAL -- Err -296
+
+000000856    199                REF_CNT_LOCAL -- File 24
+000000857    199                  LEAVE_FRAME
+000000858    199                       RETURN 4
+
+000000859    426                         GOTO 1867
+
+000000860    426                         GOTO 1861
+
+
+Function: freadwrite
+
+000000861    226                  ENTER_FRAME 0x55a2cce38b08
+000000862    205                   PUSH_LOCAL ^ 48
+000000863    205                         PUSH ^ (nil)
+000000864    205                       BINARY == File
+000000865    207                  GOTO_IF_NOT 892
+
+000000866    206                         PUSH int 0
+000000867    206                    PUSH_ZERO 2
+000000868    206                         PUSH int 4
+000000869    206          PUSH_LOCAL_PTR_ZERO -72 56
+000000870    206                         CALL stderror (67)
+000000871    206                     PUSH_REG RESULT
+000000872    206                          DUP
+000000873    206               PUSH_LOCAL_PTR -128
+000000874    206                  SWAP_ASSIGN struct 56
+000000875    206               PUSH_LOCAL_PTR -192
+000000876    206                         ZERO 64
+000000877    206               PUSH_LOCAL_PTR -184
+000000878    206          SWAP_REF_CNT_ASSIGN Err
+000000879    206               PUSH_LOCAL_PTR -192
+000000880    206                  SWAP_ASSIGN int 8
+000000881    206               PUSH_LOCAL_PTR -192
+000000882    206                   PUSH_LOCAL ^ 16
+000000883    206                  SWAP_ASSIGN struct 64
+000000884    206                   PUSH_LOCAL ^ 16
+000000885    206                      REF_CNT ++ { int Err }
+000000886    206                      POP_REG RESULT
+000000887    206                REF_CNT_LOCAL -- { int Err } -192
+000000888    206                REF_CNT_LOCAL -- Err -128
+000000889    226                         GOTO 1141
+
+000000890    207                REF_CNT_LOCAL -- { int Err } -192
+000000891    207                REF_CNT_LOCAL -- Err -128
+
+000000892    208               PUSH_LOCAL_PTR -200
+000000893    208                         ZERO 8
+000000894    209               PUSH_LOCAL_PTR -208
+000000895    209                         ZERO 8
+000000896    210               PUSH_LOCAL_PTR 32
+000000897    211                          DUP
+000000898    211                  ASSERT_TYPE ^[]int8
+000000899    211                          DUP
+000000900    211                         PUSH ^ (nil)
+000000901    211                       BINARY != ^[]int8
+000000902    212                  GOTO_IF_NOT 920
+
+000000903    211          PUSH_LOCAL_PTR_ZERO -216 8
+000000904    211          SWAP_REF_CNT_ASSIGN ^[]int8
+000000905    211               PUSH_LOCAL_PTR -208
+000000906    211                   PUSH_LOCAL ^ -216
+000000907    211                        DEREF []
+000000908    211                 CALL_BUILTIN [] len
+000000909    211                       ASSIGN int 8
+000000910    211                   PUSH_LOCAL int -208
+000000911    211                         PUSH int 0
+000000912    211          GOTO_IF_LESS_EQ_INT int 918
+000000913    211               PUSH_LOCAL_PTR -200
+000000914    211                   PUSH_LOCAL ^ -216
+000000915    211                         PUSH int 0
+000000916    211             GET_DYNARRAY_PTR
+000000917    211               REF_CNT_ASSIGN ^void
+000000918    212                REF_CNT_LOCAL -- ^[]int8 -216
+000000919    219                         GOTO 1024
+
+000000920    212                          POP 1
+000000921    212                          DUP
+000000922    212                  ASSERT_TYPE ^[]uint8
+000000923    212                          DUP
+000000924    212                         PUSH ^ (nil)
+000000925    212                       BINARY != ^[]uint8
+000000926    213                  GOTO_IF_NOT 944
+
+000000927    212          PUSH_LOCAL_PTR_ZERO -224 8
+000000928    212          SWAP_REF_CNT_ASSIGN ^[]uint8
+000000929    212               PUSH_LOCAL_PTR -208
+000000930    212                   PUSH_LOCAL ^ -224
+000000931    212                        DEREF []
+000000932    212                 CALL_BUILTIN [] len
+000000933    212                       ASSIGN int 8
+000000934    212                   PUSH_LOCAL int -208
+000000935    212                         PUSH int 0
+000000936    212          GOTO_IF_LESS_EQ_INT int 942
+000000937    212               PUSH_LOCAL_PTR -200
+000000938    212                   PUSH_LOCAL ^ -224
+000000939    212                         PUSH int 0
+000000940    212             GET_DYNARRAY_PTR
+000000941    212               REF_CNT_ASSIGN ^void
+000000942    213                REF_CNT_LOCAL -- ^[]uint8 -224
+000000943    219                         GOTO 1024
+
+000000944    213                          POP 1
+000000945    213                          DUP
+000000946    213                  ASSERT_TYPE ^[]char
+000000947    213                          DUP
+000000948    213                         PUSH ^ (nil)
+000000949    213                       BINARY != ^[]char
+000000950    214                  GOTO_IF_NOT 968
+
+000000951    213          PUSH_LOCAL_PTR_ZERO -232 8
+000000952    213          SWAP_REF_CNT_ASSIGN ^[]char
+000000953    213               PUSH_LOCAL_PTR -208
+000000954    213                   PUSH_LOCAL ^ -232
+000000955    213                        DEREF []
+000000956    213                 CALL_BUILTIN [] len
+000000957    213                       ASSIGN int 8
+000000958    213                   PUSH_LOCAL int -208
+000000959    213                         PUSH int 0
+000000960    213          GOTO_IF_LESS_EQ_INT int 966
+000000961    213               PUSH_LOCAL_PTR -200
+000000962    213                   PUSH_LOCAL ^ -232
+000000963    213                         PUSH int 0
+000000964    213             GET_DYNARRAY_PTR
+000000965    213               REF_CNT_ASSIGN ^void
+000000966    214                REF_CNT_LOCAL -- ^[]char -232
+000000967    219                         GOTO 1024
+
+000000968    214                          POP 1
+000000969    215               PUSH_LOCAL_PTR 32
+000000970    215                 CALL_BUILTIN interface selfhasptr
+000000971    217                  GOTO_IF_NOT 999
+
+000000972    216                         PUSH int 0
+000000973    216                    PUSH_ZERO 2
+000000974    216                         PUSH int 3
+000000975    216          PUSH_LOCAL_PTR_ZERO -288 56
+000000976    216                         CALL stderror (67)
+000000977    216                     PUSH_REG RESULT
+000000978    216                          DUP
+000000979    216               PUSH_LOCAL_PTR -344
+000000980    216                  SWAP_ASSIGN struct 56
+000000981    216               PUSH_LOCAL_PTR -408
+000000982    216                         ZERO 64
+000000983    216               PUSH_LOCAL_PTR -400
+000000984    216          SWAP_REF_CNT_ASSIGN Err
+000000985    216               PUSH_LOCAL_PTR -408
+000000986    216                  SWAP_ASSIGN int 8
+000000987    216               PUSH_LOCAL_PTR -408
+000000988    216                   PUSH_LOCAL ^ 16
+000000989    216                  SWAP_ASSIGN struct 64
+000000990    216                   PUSH_LOCAL ^ 16
+000000991    216                      REF_CNT ++ { int Err }
+000000992    216                      POP_REG RESULT
+000000993    216                REF_CNT_LOCAL -- { int Err } -408
+000000994    216                REF_CNT_LOCAL -- Err -344
+000000995    216                REF_CNT_LOCAL -- ^void -200
+000000996    226                         GOTO 1141
+
+000000997    217                REF_CNT_LOCAL -- { int Err } -408
+000000998    217                REF_CNT_LOCAL -- Err -344
+
+000000999    218               PUSH_LOCAL_PTR -208
+000001000    218               PUSH_LOCAL_PTR -200
+000001001    218               PUSH_LOCAL_PTR 32
+000001002    218                 CALL_BUILTIN interface sizeofself
+000001003    218               PUSH_LOCAL_PTR 32
+000001004    218                 CALL_BUILTIN interface selfptr
+000001005    218               PUSH_LOCAL_PTR -424
+000001006    218                         ZERO 16
+000001007    218               PUSH_LOCAL_PTR -416
+000001008    218          SWAP_REF_CNT_ASSIGN ^void
+000001009    218               PUSH_LOCAL_PTR -424
+000001010    218                  SWAP_ASSIGN int 8
+000001011    218               PUSH_LOCAL_PTR -424
+000001012    218                          DUP
+000001013    218                      POP_REG EXPR_LIST
+000001014    218                    GET_FIELD ^ 8
+000001015    218               REF_CNT_ASSIGN ^void
+000001016    218                     PUSH_REG EXPR_LIST
+000001017    218                          DUP
+000001018    218                      POP_REG EXPR_LIST
+000001019    218                        DEREF int
+000001020    218                       ASSIGN int 8
+000001021    218                     PUSH_REG EXPR_LIST
+000001022    218                          POP 1
+000001023    219                REF_CNT_LOCAL -- { int ^void } -424
+
+000001024    219                          POP 1
+000001025    220                   PUSH_LOCAL int -208
+000001026    220                         PUSH int 0
+000001027    220                       EQ_INT int
+000001028    220                          DUP
+000001029    220                      GOTO_IF 1034
+
+000001030    220                          POP 1
+000001031    220                   PUSH_LOCAL ^ -200
+000001032    220                         PUSH ^ (nil)
+000001033    220                       BINARY == ^void
+
+000001034    222                  GOTO_IF_NOT 1062
+
+000001035    221                         PUSH int 0
+000001036    221                    PUSH_ZERO 2
+000001037    221                         PUSH int 0
+000001038    221          PUSH_LOCAL_PTR_ZERO -480 56
+000001039    221                         CALL stderror (67)
+000001040    221                     PUSH_REG RESULT
+000001041    221                          DUP
+000001042    221               PUSH_LOCAL_PTR -536
+000001043    221                  SWAP_ASSIGN struct 56
+000001044    221               PUSH_LOCAL_PTR -600
+000001045    221                         ZERO 64
+000001046    221               PUSH_LOCAL_PTR -592
+000001047    221          SWAP_REF_CNT_ASSIGN Err
+000001048    221               PUSH_LOCAL_PTR -600
+000001049    221                  SWAP_ASSIGN int 8
+000001050    221               PUSH_LOCAL_PTR -600
+000001051    221                   PUSH_LOCAL ^ 16
+000001052    221                  SWAP_ASSIGN struct 64
+000001053    221                   PUSH_LOCAL ^ 16
+000001054    221                      REF_CNT ++ { int Err }
+000001055    221                      POP_REG RESULT
+000001056    221                REF_CNT_LOCAL -- { int Err } -600
+000001057    221                REF_CNT_LOCAL -- Err -536
+000001058    221                REF_CNT_LOCAL -- ^void -200
+000001059    226                         GOTO 1141
+
+000001060    222                REF_CNT_LOCAL -- { int Err } -600
+000001061    222                REF_CNT_LOCAL -- Err -536
+
+000001062    223                   PUSH_LOCAL bool 24
+000001063    223                  GOTO_IF_NOT 1074
+
+000001064    223                    PUSH_ZERO 2
+000001065    223                   PUSH_LOCAL ^ -200
+000001066    223                      REF_CNT ++ ^void
+000001067    223                         PUSH int 1
+000001068    223                   PUSH_LOCAL int -208
+000001069    223                   PUSH_LOCAL ^ 48
+000001070    223                      REF_CNT ++ File
+000001071    223                         CALL <unknown> (859)
+000001072    223                     PUSH_REG RESULT
+000001073    223                         GOTO 1083
+
+000001074    223                    PUSH_ZERO 2
+000001075    223                   PUSH_LOCAL ^ -200
+000001076    223                      REF_CNT ++ ^void
+000001077    223                         PUSH int 1
+000001078    223                   PUSH_LOCAL int -208
+000001079    223                   PUSH_LOCAL ^ 48
+000001080    223                      REF_CNT ++ File
+000001081    223                         CALL <unknown> (860)
+000001082    223                     PUSH_REG RESULT
+
+000001083    223               PUSH_LOCAL_PTR -608
+000001084    223                  SWAP_ASSIGN int 8
+000001085    224                   PUSH_LOCAL int -608
+000001086    224                   PUSH_LOCAL int -208
+000001087    224           GOTO_IF_NOT_EQ_INT int 1102
+000001088    224                    PUSH_ZERO 2
+000001089    224                         PUSH int 0
+000001090    224          PUSH_LOCAL_PTR_ZERO -664 56
+000001091    224                         CALL stderror (67)
+000001092    224                     PUSH_REG RESULT
+000001093    224                          DUP
+000001094    224               PUSH_LOCAL_PTR -720
+000001095    224                  SWAP_ASSIGN struct 56
+000001096    224                          DUP
+000001097    224                      REF_CNT ++ Err
+000001098    224               PUSH_LOCAL_PTR -776
+000001099    224                  SWAP_ASSIGN struct 56
+000001100    224                REF_CNT_LOCAL -- Err -720
+000001101    224                         GOTO 1115
+
+000001102    224                    PUSH_ZERO 2
+000001103    224                         PUSH int 5
+000001104    224          PUSH_LOCAL_PTR_ZERO -832 56
+000001105    224                         CALL stderror (67)
+000001106    224                     PUSH_REG RESULT
+000001107    224                          DUP
+000001108    224               PUSH_LOCAL_PTR -888
+000001109    224                  SWAP_ASSIGN struct 56
+000001110    224                          DUP
+000001111    224                      REF_CNT ++ Err
+000001112    224               PUSH_LOCAL_PTR -776
+000001113    224                  SWAP_ASSIGN struct 56
+000001114    224                REF_CNT_LOCAL -- Err -888
+
+000001115    224                      REF_CNT ++ Err
+000001116    224               PUSH_LOCAL_PTR -944
+000001117    224                  SWAP_ASSIGN struct 56
+000001118    225                   PUSH_LOCAL int -608
+000001119    225               PUSH_LOCAL_PTR -944
+000001120    225               PUSH_LOCAL_PTR -1008
+000001121    225                         ZERO 64
+000001122    225               PUSH_LOCAL_PTR -1000
+000001123    225          SWAP_REF_CNT_ASSIGN Err
+000001124    225               PUSH_LOCAL_PTR -1008
+000001125    225                  SWAP_ASSIGN int 8
+000001126    225               PUSH_LOCAL_PTR -1008
+000001127    225                   PUSH_LOCAL ^ 16
+000001128    225                  SWAP_ASSIGN struct 64
+000001129    225                   PUSH_LOCAL ^ 16
+000001130    225                      REF_CNT ++ { int Err }
+000001131    225                      POP_REG RESULT
+000001132    225                REF_CNT_LOCAL -- { int Err } -1008
+000001133    225                REF_CNT_LOCAL -- Err -944
+000001134    225                REF_CNT_LOCAL -- Err -776
+000001135    225                REF_CNT_LOCAL -- ^void -200
+000001136    226                         GOTO 1141
+
+000001137    226                REF_CNT_LOCAL -- { int Err } -1008
+000001138    226                REF_CNT_LOCAL -- Err -944
+000001139    226                REF_CNT_LOCAL -- Err -776
+000001140    226                REF_CNT_LOCAL -- ^void -200
+
+000001141    226                REF_CNT_LOCAL -- interface 32
+000001142    226                REF_CNT_LOCAL -- File 48
+000001143    226                  LEAVE_FRAME
+000001144    226                       RETURN 7
+
+
+Function: fread
+
+000001145    230                  ENTER_FRAME 0x55a2cce01208
+000001146    229                    PUSH_ZERO 2
+000001147    229                   PUSH_LOCAL ^ 40
+000001148    229                      REF_CNT ++ File
+000001149    229               PUSH_LOCAL_PTR 24
+000001150    229                      REF_CNT ++ interface
+000001151    229                 ASSIGN_PARAM interface 16
+000001152    229                         PUSH int 1
+000001153    229                 ASSIGN_PARAM bool 1
+000001154    229          PUSH_LOCAL_PTR_ZERO -80 64
+000001155    229                         CALL freadwrite (861)
+000001156    229                     PUSH_REG RESULT
+000001157    229                          DUP
+000001158    229               PUSH_LOCAL_PTR -144
+000001159    229                  SWAP_ASSIGN struct 64
+000001160    229                   PUSH_LOCAL ^ 16
+000001161    229                  SWAP_ASSIGN struct 64
+000001162    229                   PUSH_LOCAL ^ 16
+000001163    229                      REF_CNT ++ { int Err }
+000001164    229                      POP_REG RESULT
+000001165    229                REF_CNT_LOCAL -- { int Err } -144
+000001166    230                         GOTO 1168
+
+000001167    230                REF_CNT_LOCAL -- { int Err } -144
+
+000001168    230                REF_CNT_LOCAL -- interface 24
+000001169    230                REF_CNT_LOCAL -- File 40
+000001170    230                  LEAVE_FRAME
+000001171    230                       RETURN 6
+
+
+Function: freadall
+
+000001172    254                  ENTER_FRAME 0x55a2cce3aa68
+000001173    233                    PUSH_ZERO 2
+000001174    233                   PUSH_LOCAL ^ 24
+000001175    233                      REF_CNT ++ File
+000001176    233                         PUSH int 0
+000001177    233                         PUSH int 2
+000001178    233          PUSH_LOCAL_PTR_ZERO -72 56
+000001179    233                         CALL fseek (566)
+000001180    233                     PUSH_REG RESULT
+000001181    233               PUSH_LOCAL_PTR -184
+000001182    233                  SWAP_ASSIGN struct 56
+000001183    234                   PUSH_LOCAL int -184
+000001184    234                         PUSH int 0
+000001185    236               GOTO_IF_EQ_INT int 1204
+000001186    235          PUSH_LOCAL_PTR_ZERO -208 24
+000001187    235               PUSH_LOCAL_PTR -184
+000001188    235               PUSH_LOCAL_PTR -288
+000001189    235                         ZERO 80
+000001190    235               PUSH_LOCAL_PTR -264
+000001191    235          SWAP_REF_CNT_ASSIGN Err
+000001192    235               PUSH_LOCAL_PTR -288
+000001193    235          SWAP_REF_CNT_ASSIGN []char
+000001194    235               PUSH_LOCAL_PTR -288
+000001195    235                   PUSH_LOCAL ^ 16
+000001196    235                  SWAP_ASSIGN struct 80
+000001197    235                   PUSH_LOCAL ^ 16
+000001198    235                      REF_CNT ++ { []char Err }
+000001199    235                      POP_REG RESULT
+000001200    235                REF_CNT_LOCAL -- { []char Err } -288
+000001201    235                REF_CNT_LOCAL -- Err -184
+000001202    254                         GOTO 1397
+
+000001203    236                REF_CNT_LOCAL -- { []char Err } -288
+000001204    237                    PUSH_ZERO 2
+000001205    237                   PUSH_LOCAL ^ 24
+000001206    237                      REF_CNT ++ File
+000001207    237          PUSH_LOCAL_PTR_ZERO -352 64
+000001208    237                         CALL ftell (635)
+000001209    237                     PUSH_REG RESULT
+000001210    237                          DUP
+000001211    237               PUSH_LOCAL_PTR -416
+000001212    237                  SWAP_ASSIGN struct 64
+000001213    237                          DUP
+000001214    237                        DEREF int
+000001215    237               PUSH_LOCAL_PTR -424
+000001216    237                  SWAP_ASSIGN int 8
+000001217    237                          DUP
+000001218    237                    GET_FIELD struct 8
+000001219    237               PUSH_LOCAL_PTR -184
+000001220    237          SWAP_REF_CNT_ASSIGN Err
+000001221    237                          POP 1
+000001222    238                   PUSH_LOCAL int -184
+000001223    238                         PUSH int 0
+000001224    240               GOTO_IF_EQ_INT int 1244
+000001225    239          PUSH_LOCAL_PTR_ZERO -448 24
+000001226    239               PUSH_LOCAL_PTR -184
+000001227    239               PUSH_LOCAL_PTR -528
+000001228    239                         ZERO 80
+000001229    239               PUSH_LOCAL_PTR -504
+000001230    239          SWAP_REF_CNT_ASSIGN Err
+000001231    239               PUSH_LOCAL_PTR -528
+000001232    239          SWAP_REF_CNT_ASSIGN []char
+000001233    239               PUSH_LOCAL_PTR -528
+000001234    239                   PUSH_LOCAL ^ 16
+000001235    239                  SWAP_ASSIGN struct 80
+000001236    239                   PUSH_LOCAL ^ 16
+000001237    239                      REF_CNT ++ { []char Err }
+000001238    239                      POP_REG RESULT
+000001239    239                REF_CNT_LOCAL -- { []char Err } -528
+000001240    239                REF_CNT_LOCAL -- { int Err } -416
+000001241    239                REF_CNT_LOCAL -- Err -184
+000001242    254                         GOTO 1397
+
+000001243    240                REF_CNT_LOCAL -- { []char Err } -528
+000001244    241                   PUSH_LOCAL int -424
+000001245    241                         PUSH int 2147483392
+000001246    243          GOTO_IF_LESS_EQ_INT int 1275
+000001247    242          PUSH_LOCAL_PTR_ZERO -552 24
+000001248    242                    PUSH_ZERO 2
+000001249    242                         PUSH int 5
+000001250    242          PUSH_LOCAL_PTR_ZERO -608 56
+000001251    242                         CALL stderror (67)
+000001252    242                     PUSH_REG RESULT
+000001253    242                          DUP
+000001254    242               PUSH_LOCAL_PTR -664
+000001255    242                  SWAP_ASSIGN struct 56
+000001256    242               PUSH_LOCAL_PTR -744
+000001257    242                         ZERO 80
+000001258    242               PUSH_LOCAL_PTR -720
+000001259    242          SWAP_REF_CNT_ASSIGN Err
+000001260    242               PUSH_LOCAL_PTR -744
+000001261    242          SWAP_REF_CNT_ASSIGN []char
+000001262    242               PUSH_LOCAL_PTR -744
+000001263    242                   PUSH_LOCAL ^ 16
+000001264    242                  SWAP_ASSIGN struct 80
+000001265    242                   PUSH_LOCAL ^ 16
+000001266    242                      REF_CNT ++ { []char Err }
+000001267    242                      POP_REG RESULT
+000001268    242                REF_CNT_LOCAL -- { []char Err } -744
+000001269    242                REF_CNT_LOCAL -- Err -664
+000001270    242                REF_CNT_LOCAL -- { int Err } -416
+000001271    242                REF_CNT_LOCAL -- Err -184
+000001272    254                         GOTO 1397
+
+000001273    243                REF_CNT_LOCAL -- { []char Err } -744
+000001274    243                REF_CNT_LOCAL -- Err -664
+000001275    244               PUSH_LOCAL_PTR -184
+000001276    244                    PUSH_ZERO 2
+000001277    244                   PUSH_LOCAL ^ 24
+000001278    244                      REF_CNT ++ File
+000001279    244                         PUSH int 0
+000001280    244                         PUSH int 0
+000001281    244          PUSH_LOCAL_PTR_ZERO -800 56
+000001282    244                         CALL fseek (566)
+000001283    244                     PUSH_REG RESULT
+000001284    244               REF_CNT_ASSIGN -- Err
+000001285    245                   PUSH_LOCAL int -184
+000001286    245                         PUSH int 0
+000001287    247               GOTO_IF_EQ_INT int 1307
+000001288    246          PUSH_LOCAL_PTR_ZERO -880 24
+000001289    246               PUSH_LOCAL_PTR -184
+000001290    246               PUSH_LOCAL_PTR -960
+000001291    246                         ZERO 80
+000001292    246               PUSH_LOCAL_PTR -936
+000001293    246          SWAP_REF_CNT_ASSIGN Err
+000001294    246               PUSH_LOCAL_PTR -960
+000001295    246          SWAP_REF_CNT_ASSIGN []char
+000001296    246               PUSH_LOCAL_PTR -960
+000001297    246                   PUSH_LOCAL ^ 16
+000001298    246                  SWAP_ASSIGN struct 80
+000001299    246                   PUSH_LOCAL ^ 16
+000001300    246                      REF_CNT ++ { []char Err }
+000001301    246                      POP_REG RESULT
+000001302    246                REF_CNT_LOCAL -- { []char Err } -960
+000001303    246                REF_CNT_LOCAL -- { int Err } -416
+000001304    246                REF_CNT_LOCAL -- Err -184
+000001305    254                         GOTO 1397
+
+000001306    247                REF_CNT_LOCAL -- { []char Err } -960
+000001307    248                   PUSH_LOCAL int -424
+000001308    248               PUSH_LOCAL_PTR -984
+000001309    248                 CALL_BUILTIN []char make
+000001310    248               PUSH_LOCAL_PTR -1032
+000001311    248                  SWAP_ASSIGN [] 24
+000001312    249                    PUSH_ZERO 2
+000001313    249                   PUSH_LOCAL ^ 24
+000001314    249                      REF_CNT ++ File
+000001315    249               PUSH_LOCAL_PTR -1032
+000001316    249               PUSH_LOCAL_PTR -1048
+000001317    249                  SWAP_ASSIGN ^ 0
+000001318    249                         PUSH ^ 0x55a2cce03448
+000001319    249               PUSH_LOCAL_PTR -1040
+000001320    249                  SWAP_ASSIGN ^ 0
+000001321    249               PUSH_LOCAL_PTR -1048
+000001322    249                      REF_CNT ++ interface
+000001323    249                 ASSIGN_PARAM interface 16
+000001324    249          PUSH_LOCAL_PTR_ZERO -1112 64
+000001325    249                         CALL fread (1145)
+000001326    249                     PUSH_REG RESULT
+000001327    249                          DUP
+000001328    249               PUSH_LOCAL_PTR -1176
+000001329    249                  SWAP_ASSIGN struct 64
+000001330    249                          DUP
+000001331    249                        DEREF int
+000001332    249               PUSH_LOCAL_PTR -1184
+000001333    249                  SWAP_ASSIGN int 8
+000001334    249                          DUP
+000001335    249                    GET_FIELD struct 8
+000001336    249               PUSH_LOCAL_PTR -184
+000001337    249          SWAP_REF_CNT_ASSIGN Err
+000001338    249                          POP 1
+000001339    250                   PUSH_LOCAL int -184
+000001340    250                         PUSH int 0
+000001341    252               GOTO_IF_EQ_INT int 1363
+000001342    251               PUSH_LOCAL_PTR -1032
+000001343    251               PUSH_LOCAL_PTR -184
+000001344    251               PUSH_LOCAL_PTR -1264
+000001345    251                         ZERO 80
+000001346    251               PUSH_LOCAL_PTR -1240
+000001347    251          SWAP_REF_CNT_ASSIGN Err
+000001348    251               PUSH_LOCAL_PTR -1264
+000001349    251          SWAP_REF_CNT_ASSIGN []char
+000001350    251               PUSH_LOCAL_PTR -1264
+000001351    251                   PUSH_LOCAL ^ 16
+000001352    251                  SWAP_ASSIGN struct 80
+000001353    251                   PUSH_LOCAL ^ 16
+000001354    251                      REF_CNT ++ { []char Err }
+000001355    251                      POP_REG RESULT
+000001356    251                REF_CNT_LOCAL -- { []char Err } -1264
+000001357    251                REF_CNT_LOCAL -- { int Err } -1176
+000001358    251                REF_CNT_LOCAL -- []char -1032
+000001359    251                REF_CNT_LOCAL -- { int Err } -416
+000001360    251                REF_CNT_LOCAL -- Err -184
+000001361    254                         GOTO 1397
+
+000001362    252                REF_CNT_LOCAL -- { []char Err } -1264
+000001363    253               PUSH_LOCAL_PTR -1032
+000001364    253                    PUSH_ZERO 2
+000001365    253                         PUSH int 0
+000001366    253          PUSH_LOCAL_PTR_ZERO -1320 56
+000001367    253                         CALL stderror (67)
+000001368    253                     PUSH_REG RESULT
+000001369    253                          DUP
+000001370    253               PUSH_LOCAL_PTR -1376
+000001371    253                  SWAP_ASSIGN struct 56
+000001372    253               PUSH_LOCAL_PTR -1456
+000001373    253                         ZERO 80
+000001374    253               PUSH_LOCAL_PTR -1432
+000001375    253          SWAP_REF_CNT_ASSIGN Err
+000001376    253               PUSH_LOCAL_PTR -1456
+000001377    253          SWAP_REF_CNT_ASSIGN []char
+000001378    253               PUSH_LOCAL_PTR -1456
+000001379    253                   PUSH_LOCAL ^ 16
+000001380    253                  SWAP_ASSIGN struct 80
+000001381    253                   PUSH_LOCAL ^ 16
+000001382    253                      REF_CNT ++ { []char Err }
+000001383    253                      POP_REG RESULT
+000001384    253                REF_CNT_LOCAL -- { []char Err } -1456
+000001385    253                REF_CNT_LOCAL -- Err -1376
+000001386    253                REF_CNT_LOCAL -- { int Err } -1176
+000001387    253                REF_CNT_LOCAL -- []char -1032
+000001388    253                REF_CNT_LOCAL -- { int Err } -416
+000001389    253                REF_CNT_LOCAL -- Err -184
+000001390    254                         GOTO 1397
+
+000001391    254                REF_CNT_LOCAL -- { []char Err } -1456
+000001392    254                REF_CNT_LOCAL -- Err -1376
+000001393    254                REF_CNT_LOCAL -- { int Err } -1176
+000001394    254                REF_CNT_LOCAL -- []char -1032
+000001395    254                REF_CNT_LOCAL -- { int Err } -416
+000001396    254                REF_CNT_LOCAL -- Err -184
+
+000001397    254                REF_CNT_LOCAL -- File 24
+000001398    254                  LEAVE_FRAME
+000001399    254                       RETURN 4
+
+
+Function: fwrite
+
+000001400    258                  ENTER_FRAME 0x55a2cce04168
+000001401    257                    PUSH_ZERO 2
+000001402    257                   PUSH_LOCAL ^ 40
+000001403    257                      REF_CNT ++ File
+000001404    257               PUSH_LOCAL_PTR 24
+000001405    257                      REF_CNT ++ interface
+000001406    257                 ASSIGN_PARAM interface 16
+000001407    257                         PUSH int 0
+000001408    257                 ASSIGN_PARAM bool 1
+000001409    257          PUSH_LOCAL_PTR_ZERO -80 64
+000001410    257                         CALL freadwrite (861)
+000001411    257                     PUSH_REG RESULT
+000001412    257                          DUP
+000001413    257               PUSH_LOCAL_PTR -144
+000001414    257                  SWAP_ASSIGN struct 64
+000001415    257                   PUSH_LOCAL ^ 16
+000001416    257                  SWAP_ASSIGN struct 64
+000001417    257                   PUSH_LOCAL ^ 16
+000001418    257                      REF_CNT ++ { int Err }
+000001419    257                      POP_REG RESULT
+000001420    257                REF_CNT_LOCAL -- { int Err } -144
+000001421    258                         GOTO 1423
+
+000001422    258                REF_CNT_LOCAL -- { int Err } -144
+
+000001423    258                REF_CNT_LOCAL -- interface 24
+000001424    258                REF_CNT_LOCAL -- File 40
+000001425    258                  LEAVE_FRAME
+000001426    258                       RETURN 6
+
+
+Function: println
+
+000001427    262                  ENTER_FRAME 0x55a2cce04638
+000001428    261                         PUSH int 0
+000001429    261                         PUSH ^ (nil)
+000001430    261                         PUSH ^ 0x55a2cce3b2f8
+000001431    261                   PUSH_LOCAL str 16
+000001432    261                 CALL_BUILTIN str printf
+000001433    261                         PUSH int 0
+000001434    261                 CALL_BUILTIN void printf
+000001435    261                          POP 2
+000001436    261                      POP_REG RESULT
+000001437    262                         GOTO 1438
+
+000001438    262                REF_CNT_LOCAL -- str 16
+000001439    262                  LEAVE_FRAME
+000001440    262                       RETURN 3
+
+
+Function: fprintln
+
+000001441    266                  ENTER_FRAME 0x55a2cce04c78
+000001442    265                         PUSH int 0
+000001443    265                   PUSH_LOCAL ^ 24
+000001444    265                         PUSH ^ 0x55a2cce00bc8
+000001445    265                   PUSH_LOCAL str 16
+000001446    265                 CALL_BUILTIN str fprintf
+000001447    265                         PUSH int 0
+000001448    265                 CALL_BUILTIN void fprintf
+000001449    265                          POP 2
+000001450    265                      POP_REG RESULT
+000001451    266                         GOTO 1452
+
+000001452    266                REF_CNT_LOCAL -- str 16
+000001453    266                REF_CNT_LOCAL -- File 24
+000001454    266                  LEAVE_FRAME
+000001455    266                       RETURN 4
+
+
+Function: getchar
+
+000001456    272                  ENTER_FRAME 0x55a2cce05068
+000001457    269               PUSH_LOCAL_PTR -17
+000001458    269                         ZERO 1
+000001459    270                         PUSH int 0
+000001460    270                         PUSH ^ (nil)
+000001461    270                         PUSH ^ 0x55a2cce3b258
+000001462    270               PUSH_LOCAL_PTR -17
+000001463    270                 CALL_BUILTIN char scanf
+000001464    270                         PUSH int 0
+000001465    270                 CALL_BUILTIN void scanf
+000001466    270                          POP 3
+000001467    271                   PUSH_LOCAL char -17
+000001468    271                      POP_REG RESULT
+000001469    272                         GOTO 1470
+
+000001470    272                  LEAVE_FRAME
+000001471    272                       RETURN 2
+
+
+Function: ltrim
+
+000001472    287                  ENTER_FRAME 0x55a2cce05cb8
+000001473    277                         PUSH int -1
+000001474    277               PUSH_LOCAL_PTR -24
+000001475    277                  SWAP_ASSIGN int 8
+000001476    278                   PUSH_LOCAL str 16
+000001477    278                 CALL_BUILTIN str len
+000001478    278               PUSH_LOCAL_PTR -32
+000001479    278                  SWAP_ASSIGN int 8
+000001480    279                         PUSH int 0
+000001481    279               PUSH_LOCAL_PTR -40
+000001482    279                  SWAP_ASSIGN int 8
+
+000001483    279                   PUSH_LOCAL int -40
+000001484    279                   PUSH_LOCAL int -32
+000001485    284       GOTO_IF_GREATER_EQ_INT int 1497
+000001486    280                   PUSH_LOCAL str 16
+000001487    280                   PUSH_LOCAL int -40
+000001488    280                    GET_ARRAY char 1 -1
+000001489    280                         PUSH int 32
+000001490    283          GOTO_IF_LESS_EQ_INT char 1495
+000001491    281               PUSH_LOCAL_PTR -24
+000001492    281                   PUSH_LOCAL int -40
+000001493    281                       ASSIGN int 8
+000001494    284                         GOTO 1497
+
+000001495    284                INC_LOCAL_INT -40
+000001496    284                         GOTO 1483
+
+000001497    285                   PUSH_LOCAL int -24
+000001498    285                         PUSH int -1
+000001499    285           GOTO_IF_NOT_EQ_INT int 1503
+000001500    285                         PUSH ^ 0x55a2cce3b528
+000001501    285                      POP_REG RESULT
+000001502    287                         GOTO 1510
+
+000001503    286                   PUSH_LOCAL str 16
+000001504    286                   PUSH_LOCAL int -24
+000001505    286                         PUSH int -2147483648
+000001506    286                         PUSH ^ (nil)
+000001507    286                 CALL_BUILTIN str slice
+000001508    286                      POP_REG RESULT
+000001509    287                         GOTO 1510
+
+000001510    287                REF_CNT_LOCAL -- str 16
+000001511    287                  LEAVE_FRAME
+000001512    287                       RETURN 3
+
+
+Function: rtrim
+
+000001513    300                  ENTER_FRAME 0x55a2cce06638
+000001514    290                         PUSH int -1
+000001515    290               PUSH_LOCAL_PTR -24
+000001516    290                  SWAP_ASSIGN int 8
+000001517    291                   PUSH_LOCAL str 16
+000001518    291                 CALL_BUILTIN str len
+000001519    291               PUSH_LOCAL_PTR -32
+000001520    291                  SWAP_ASSIGN int 8
+000001521    292                   PUSH_LOCAL int -32
+000001522    292                         PUSH int 1
+000001523    292                      SUB_INT int
+000001524    292               PUSH_LOCAL_PTR -40
+000001525    292                  SWAP_ASSIGN int 8
+
+000001526    292                   PUSH_LOCAL int -40
+000001527    292                         PUSH int 0
+000001528    297             GOTO_IF_LESS_INT int 1540
+000001529    293                   PUSH_LOCAL str 16
+000001530    293                   PUSH_LOCAL int -40
+000001531    293                    GET_ARRAY char 1 -1
+000001532    293                         PUSH int 32
+000001533    296          GOTO_IF_LESS_EQ_INT char 1538
+000001534    294               PUSH_LOCAL_PTR -24
+000001535    294                   PUSH_LOCAL int -40
+000001536    294                       ASSIGN int 8
+000001537    297                         GOTO 1540
+
+000001538    297                DEC_LOCAL_INT -40
+000001539    297                         GOTO 1526
+
+000001540    298                   PUSH_LOCAL int -24
+000001541    298                         PUSH int -1
+000001542    298           GOTO_IF_NOT_EQ_INT int 1546
+000001543    298                         PUSH ^ 0x55a2cce00708
+000001544    298                      POP_REG RESULT
+000001545    300                         GOTO 1555
+
+000001546    299                   PUSH_LOCAL str 16
+000001547    299                         PUSH int 0
+000001548    299                   PUSH_LOCAL int -24
+000001549    299                         PUSH int 1
+000001550    299                      ADD_INT int
+000001551    299                         PUSH ^ (nil)
+000001552    299                 CALL_BUILTIN str slice
+000001553    299                      POP_REG RESULT
+000001554    300                         GOTO 1555
+
+000001555    300                REF_CNT_LOCAL -- str 16
+000001556    300                  LEAVE_FRAME
+000001557    300                       RETURN 3
+
+
+Function: trim
+
+000001558    304                  ENTER_FRAME 0x55a2cce06a88
+000001559    303                    PUSH_ZERO 4
+000001560    303                   PUSH_LOCAL str 16
+000001561    303                      REF_CNT ++ str
+000001562    303                         CALL rtrim (1513)
+000001563    303                     PUSH_REG RESULT
+000001564    303                         CALL ltrim (1472)
+000001565    304                         GOTO 1566
+
+000001566    304                REF_CNT_LOCAL -- str 16
+000001567    304                  LEAVE_FRAME
+000001568    304                       RETURN 3
+
+
+Function: atoi
+
+000001569    312                  ENTER_FRAME 0x55a2cce06ff8
+000001570    309               PUSH_LOCAL_PTR -24
+000001571    309                         ZERO 8
+000001572    310                         PUSH int 0
+000001573    310                   PUSH_LOCAL str 16
+000001574    310                         PUSH ^ 0x55a2cce3c1c8
+000001575    310               PUSH_LOCAL_PTR -24
+000001576    310                 CALL_BUILTIN int sscanf
+000001577    310                         PUSH int 0
+000001578    310                 CALL_BUILTIN void sscanf
+000001579    310                          POP 3
+000001580    311                   PUSH_LOCAL int -24
+000001581    311                      POP_REG RESULT
+000001582    312                         GOTO 1583
+
+000001583    312                REF_CNT_LOCAL -- str 16
+000001584    312                  LEAVE_FRAME
+000001585    312                       RETURN 3
+
+
+Function: atof
+
+000001586    318                  ENTER_FRAME 0x55a2cce07718
+000001587    315               PUSH_LOCAL_PTR -24
+000001588    315                         ZERO 8
+000001589    316                         PUSH int 0
+000001590    316                   PUSH_LOCAL str 16
+000001591    316                         PUSH ^ 0x55a2cce075c8
+000001592    316               PUSH_LOCAL_PTR -24
+000001593    316                 CALL_BUILTIN real sscanf
+000001594    316                         PUSH int 0
+000001595    316                 CALL_BUILTIN void sscanf
+000001596    316                          POP 3
+000001597    317                   PUSH_LOCAL real -24
+000001598    317                      POP_REG RESULT
+000001599    318                         GOTO 1600
+
+000001600    318                REF_CNT_LOCAL -- str 16
+000001601    318                  LEAVE_FRAME
+000001602    318                       RETURN 3
+
+
+Function: itoa
+
+000001603    323                  ENTER_FRAME 0x55a2cce07f48
+000001604    321                         PUSH int 0
+000001605    321                         PUSH ^ (nil)
+000001606    321                         PUSH ^ 0x55a2cce07b18
+000001607    321                   PUSH_LOCAL int 16
+000001608    321                 CALL_BUILTIN int sprintf
+000001609    321                         PUSH int 0
+000001610    321                 CALL_BUILTIN void sprintf
+000001611    321                          POP 1
+000001612    321                         SWAP
+000001613    321                          POP 1
+000001614    321               PUSH_LOCAL_PTR -32
+000001615    321                  SWAP_ASSIGN str 8
+000001616    322                   PUSH_LOCAL str -32
+000001617    322                      REF_CNT ++ str
+000001618    322                      POP_REG RESULT
+000001619    322                REF_CNT_LOCAL -- str -32
+000001620    323                         GOTO 1622
+
+000001621    323                REF_CNT_LOCAL -- str -32
+
+000001622    323                  LEAVE_FRAME
+000001623    323                       RETURN 3
+
+
+Function: ftoa
+
+000001624    329                  ENTER_FRAME 0x55a2cce08c48
+000001625    326                         PUSH int 0
+000001626    326                         PUSH ^ (nil)
+000001627    326                         PUSH ^ 0x55a2cce08478
+000001628    326                   PUSH_LOCAL int 16
+000001629    326                 CALL_BUILTIN int sprintf
+000001630    326                         PUSH int 0
+000001631    326                 CALL_BUILTIN void sprintf
+000001632    326                          POP 1
+000001633    326                         SWAP
+000001634    326                          POP 1
+000001635    326               PUSH_LOCAL_PTR -32
+000001636    326                  SWAP_ASSIGN str 8
+000001637    327                         PUSH int 0
+000001638    327                         PUSH ^ (nil)
+000001639    327                   PUSH_LOCAL str -32
+000001640    327                   PUSH_LOCAL real 24
+000001641    327                 CALL_BUILTIN real sprintf
+000001642    327                         PUSH int 0
+000001643    327                 CALL_BUILTIN void sprintf
+000001644    327                          POP 1
+000001645    327                         SWAP
+000001646    327                          POP 1
+000001647    327               PUSH_LOCAL_PTR -48
+000001648    327                  SWAP_ASSIGN str 8
+000001649    328                   PUSH_LOCAL str -48
+000001650    328                      REF_CNT ++ str
+000001651    328                      POP_REG RESULT
+000001652    328                REF_CNT_LOCAL -- str -48
+000001653    328                REF_CNT_LOCAL -- str -32
+000001654    329                         GOTO 1657
+
+000001655    329                REF_CNT_LOCAL -- str -48
+000001656    329                REF_CNT_LOCAL -- str -32
+
+000001657    329                  LEAVE_FRAME
+000001658    329                       RETURN 4
+
+
+Function: rand
+
+000001659    347                  ENTER_FRAME 0x55a2cce091b8
+000001660    343                         PUSH ^ randSeed
+000001661    343                          DUP
+000001662    343                        DEREF uint
+000001663    343                  PUSH_GLOBAL uint randSeed
+000001664    343                         PUSH int 13
+000001665    343                       BINARY << uint
+000001666    343                       BINARY ~ uint
+000001667    343                       ASSIGN uint 8
+000001668    344                         PUSH ^ randSeed
+000001669    344                          DUP
+000001670    344                        DEREF uint
+000001671    344                  PUSH_GLOBAL uint randSeed
+000001672    344                         PUSH int 7
+000001673    344                       BINARY >> uint
+000001674    344                       BINARY ~ uint
+000001675    344                       ASSIGN uint 8
+000001676    345                         PUSH ^ randSeed
+000001677    345                          DUP
+000001678    345                        DEREF uint
+000001679    345                  PUSH_GLOBAL uint randSeed
+000001680    345                         PUSH int 17
+000001681    345                       BINARY << uint
+000001682    345                       BINARY ~ uint
+000001683    345                       ASSIGN uint 8
+000001684    346                  PUSH_GLOBAL uint randSeed
+000001685    346                         PUSH int 2147483647
+000001686    346                       BINARY & uint
+000001687    346                 ASSERT_RANGE uint int
+000001688    346                      POP_REG RESULT
+000001689    347                         GOTO 1690
+
+000001690    347                  LEAVE_FRAME
+000001691    347                       RETURN 2
+
+
+Function: frand
+
+000001692    351                  ENTER_FRAME 0x55a2cce09468
+000001693    350                    PUSH_ZERO 2
+000001694    350                         CALL rand (1659)
+000001695    350                     PUSH_REG RESULT
+000001696    350                 CALL_BUILTIN int makereal
+000001697    350                         PUSH real 2.14748e+09
+000001698    350                     DIV_REAL real
+000001699    350                      POP_REG RESULT
+000001700    351                         GOTO 1701
+
+000001701    351                  LEAVE_FRAME
+000001702    351                       RETURN 2
+
+
+Function: srand
+
+000001703    358                  ENTER_FRAME 0x55a2cce09ad8
+000001704    354                   PUSH_LOCAL int 16
+000001705    354                         PUSH int 0
+000001706    357          GOTO_IF_LESS_EQ_INT int 1715
+000001707    355                         PUSH ^ randSeed
+000001708    355                   PUSH_LOCAL int 16
+000001709    355                 ASSERT_RANGE int uint
+000001710    355                       ASSIGN uint 8
+000001711    356                    PUSH_ZERO 2
+000001712    356                         CALL rand (1659)
+000001713    356                     PUSH_REG RESULT
+000001714    356                          POP 1
+000001715    358                  LEAVE_FRAME
+000001716    358                       RETURN 3
+
+000001717    426                         GOTO 1857
+
+
+Function: time
+
+000001718    373                  ENTER_FRAME 0x55a2cce0baa8
+000001719    372                    PUSH_ZERO 2
+000001720    372                         CALL <unknown> (1717)
+000001721    373                         GOTO 1722
+
+000001722    373                  LEAVE_FRAME
+000001723    373                       RETURN 2
+
+000001724    426                         GOTO 1853
+
+
+Function: clock
+
+000001725    379                  ENTER_FRAME 0x55a2cce0c288
+000001726    378                    PUSH_ZERO 2
+000001727    378                         CALL <unknown> (1724)
+000001728    379                         GOTO 1729
+
+000001729    379                  LEAVE_FRAME
+000001730    379                       RETURN 2
+
+000001731    426                         GOTO 1849
+
+
+Function: localtime
+
+000001732    385                  ENTER_FRAME 0x55a2cce57b18
+000001733    384                    PUSH_ZERO 2
+000001734    384                   PUSH_LOCAL int 24
+000001735    384          PUSH_LOCAL_PTR_ZERO -88 72
+000001736    384                         CALL <unknown> (1731)
+000001737    384                     PUSH_REG RESULT
+000001738    384                   PUSH_LOCAL ^ 16
+000001739    384                  SWAP_ASSIGN struct 72
+000001740    384                   PUSH_LOCAL ^ 16
+000001741    384                      POP_REG RESULT
+000001742    385                         GOTO 1743
+
+000001743    385                  LEAVE_FRAME
+000001744    385                       RETURN 4
+
+000001745    426                         GOTO 1845
+
+
+Function: gmtime
+
+000001746    391                  ENTER_FRAME 0x55a2cce58898
+000001747    390                    PUSH_ZERO 2
+000001748    390                   PUSH_LOCAL int 24
+000001749    390          PUSH_LOCAL_PTR_ZERO -88 72
+000001750    390                         CALL <unknown> (1745)
+000001751    390                     PUSH_REG RESULT
+000001752    390                   PUSH_LOCAL ^ 16
+000001753    390                  SWAP_ASSIGN struct 72
+000001754    390                   PUSH_LOCAL ^ 16
+000001755    390                      POP_REG RESULT
+000001756    391                         GOTO 1757
+
+000001757    391                  LEAVE_FRAME
+000001758    391                       RETURN 4
+
+000001759    426                         GOTO 1840
+
+
+Function: mktime
+
+000001760    397                  ENTER_FRAME 0x55a2cce59248
+000001761    396                    PUSH_ZERO 2
+000001762    396               PUSH_LOCAL_PTR 16
+000001763    396                      REF_CNT ++ ^DateTime
+000001764    396                         CALL <unknown> (1759)
+000001765    397                         GOTO 1766
+
+000001766    397                  LEAVE_FRAME
+000001767    397                       RETURN 11
+
+
+Function: timestr
+
+000001768    403                  ENTER_FRAME 0x55a2cce59df8
+000001769    400                         PUSH int 0
+000001770    400                         PUSH ^ (nil)
+000001771    400                         PUSH ^ 0x55a2cce02268
+000001772    401                   PUSH_LOCAL int 56
+000001773    401                 CALL_BUILTIN int sprintf
+000001774    401                   PUSH_LOCAL int 48
+000001775    401                 CALL_BUILTIN int sprintf
+000001776    401                   PUSH_LOCAL int 40
+000001777    401                 CALL_BUILTIN int sprintf
+000001778    402                   PUSH_LOCAL int 32
+000001779    402                 CALL_BUILTIN int sprintf
+000001780    402                   PUSH_LOCAL int 24
+000001781    402                 CALL_BUILTIN int sprintf
+000001782    402                   PUSH_LOCAL int 16
+000001783    402                 CALL_BUILTIN int sprintf
+000001784    402                         PUSH int 0
+000001785    402                 CALL_BUILTIN void sprintf
+000001786    402                          POP 1
+000001787    402                         SWAP
+000001788    402                          POP 1
+000001789    402                      POP_REG RESULT
+000001790    403                         GOTO 1791
+
+000001791    403                  LEAVE_FRAME
+000001792    403                       RETURN 11
+
+
+Function: argc
+
+000001793    409                  ENTER_FRAME 0x55a2cce5a0b8
+000001794    408                         PUSH ^ rtlargv
+000001795    408                          POP 1
+000001796    408                         PUSH int 1
+000001797    408                      POP_REG RESULT
+000001798    409                         GOTO 1799
+
+000001799    409                  LEAVE_FRAME
+000001800    409                       RETURN 2
+
+
+Function: argv
+
+000001801    413                  ENTER_FRAME 0x55a2cce5a6c8
+000001802    412                         PUSH ^ rtlargv
+000001803    412                   PUSH_LOCAL int 16
+000001804    412                    GET_ARRAY str 8 1
+000001805    412                      REF_CNT ++ str
+000001806    412                      POP_REG RESULT
+000001807    413                         GOTO 1808
+
+000001808    413                  LEAVE_FRAME
+000001809    413                       RETURN 3
+
+000001810    426                         GOTO 1835
+
+
+Function: getenv
+
+000001811    419                  ENTER_FRAME 0x55a2cce5b2e8
+000001812    418                    PUSH_ZERO 2
+000001813    418                   PUSH_LOCAL str 16
+000001814    418                      REF_CNT ++ str
+000001815    418                         CALL <unknown> (1810)
+000001816    419                         GOTO 1817
+
+000001817    419                REF_CNT_LOCAL -- str 16
+000001818    419                  LEAVE_FRAME
+000001819    419                       RETURN 3
+
+000001820    426                         GOTO 1830
+
+
+Function: system
+
+000001821    425                  ENTER_FRAME 0x55a2cce5bc28
+000001822    424                    PUSH_ZERO 2
+000001823    424                   PUSH_LOCAL str 16
+000001824    424                      REF_CNT ++ str
+000001825    424                         CALL <unknown> (1820)
+000001826    425                         GOTO 1827
+
+000001827    425                REF_CNT_LOCAL -- str 16
+000001828    425                  LEAVE_FRAME
+000001829    425                       RETURN 3
+
+
+Function: <unknown>
+
+000001830    426                  ENTER_FRAME 0x55a2cce5bc98
+000001831    426                  CALL_EXTERN 0x55a29d6d6880
+000001832    426                REF_CNT_LOCAL -- str 16
+000001833    426                  LEAVE_FRAME
+000001834    426                       RETURN 3
+
+
+Function: <unknown>
+
+000001835    426                  ENTER_FRAME 0x55a2cce5bd08
+000001836    426                  CALL_EXTERN 0x55a29d6d6810
+000001837    426                REF_CNT_LOCAL -- str 16
+000001838    426                  LEAVE_FRAME
+000001839    426                       RETURN 3
+
+
+Function: <unknown>
+
+000001840    426                  ENTER_FRAME 0x55a2cce5bd78
+000001841    426                  CALL_EXTERN 0x55a29d6d67a0
+000001842    426                REF_CNT_LOCAL -- ^DateTime 16
+000001843    426                  LEAVE_FRAME
+000001844    426                       RETURN 3
+
+
+Function: <unknown>
+
+000001845    426                  ENTER_FRAME 0x55a2cce5bf58
+000001846    426                  CALL_EXTERN 0x55a29d6d6700
+000001847    426                  LEAVE_FRAME
+000001848    426                       RETURN 4
+
+
+Function: <unknown>
+
+000001849    426                  ENTER_FRAME 0x55a2cce5bfd8
+000001850    426                  CALL_EXTERN 0x55a29d6d6660
+000001851    426                  LEAVE_FRAME
+000001852    426                       RETURN 4
+
+
+Function: <unknown>
+
+000001853    426                  ENTER_FRAME 0x55a2cce5c058
+000001854    426                  CALL_EXTERN 0x55a29d6d65f0
+000001855    426                  LEAVE_FRAME
+000001856    426                       RETURN 2
+
+
+Function: <unknown>
+
+000001857    426                  ENTER_FRAME 0x55a2cce5c0b8
+000001858    426                  CALL_EXTERN 0x55a29d6d65d0
+000001859    426                  LEAVE_FRAME
+000001860    426                       RETURN 2
+
+
+Function: <unknown>
+
+000001861    426                  ENTER_FRAME 0x55a2cce5c3f8
+000001862    426                  CALL_EXTERN 0x55a29d6d62f0
+000001863    426                REF_CNT_LOCAL -- File 16
+000001864    426                REF_CNT_LOCAL -- ^void 40
+000001865    426                  LEAVE_FRAME
+000001866    426                       RETURN 6
+
+
+Function: <unknown>
+
+000001867    426                  ENTER_FRAME 0x55a2cce5c498
+000001868    426                  CALL_EXTERN 0x55a29d6d6240
+000001869    426                REF_CNT_LOCAL -- File 16
+000001870    426                REF_CNT_LOCAL -- ^void 40
+000001871    426                  LEAVE_FRAME
+000001872    426                       RETURN 6
+
+
+Function: <unknown>
+
+000001873    426                  ENTER_FRAME 0x55a2cce5c538
+000001874    426                  CALL_EXTERN 0x55a29d6d6580
+000001875    426                REF_CNT_LOCAL -- File 16
+000001876    426                  LEAVE_FRAME
+000001877    426                       RETURN 3
+
+
+Function: <unknown>
+
+000001878    426                  ENTER_FRAME 0x55a2cce5c5a8
+000001879    426                  CALL_EXTERN 0x55a29d6d6510
+000001880    426                REF_CNT_LOCAL -- File 16
+000001881    426                  LEAVE_FRAME
+000001882    426                       RETURN 3
+
+
+Function: <unknown>
+
+000001883    426                  ENTER_FRAME 0x55a2cce5c618
+000001884    426                  CALL_EXTERN 0x55a29d6d64c0
+000001885    426                REF_CNT_LOCAL -- str 16
+000001886    426                  LEAVE_FRAME
+000001887    426                       RETURN 3
+
+
+Function: <unknown>
+
+000001888    426                  ENTER_FRAME 0x55a2cce5c688
+000001889    426                  CALL_EXTERN 0x55a29d6d6450
+000001890    426                REF_CNT_LOCAL -- File 16
+000001891    426                  LEAVE_FRAME
+000001892    426                       RETURN 3
+
+
+Function: <unknown>
+
+000001893    426                  ENTER_FRAME 0x55a2cce5c6f8
+000001894    426                  CALL_EXTERN 0x55a29d6d63a0
+000001895    426                REF_CNT_LOCAL -- File 32
+000001896    426                  LEAVE_FRAME
+000001897    426                       RETURN 5
+
+
+Function: <unknown>
+
+000001898    426                  ENTER_FRAME 0x55a2cce5c788
+000001899    426                  CALL_EXTERN 0x55a29d6d61c0
+000001900    426                REF_CNT_LOCAL -- File 16
+000001901    426                  LEAVE_FRAME
+000001902    426                       RETURN 3
+
+
+Function: <unknown>
+
+000001903    426                  ENTER_FRAME 0x55a2cce5c7f8
+000001904    426                  CALL_EXTERN 0x55a29d6d6120
+000001905    426                REF_CNT_LOCAL -- str 16
+000001906    426                REF_CNT_LOCAL -- str 24
+000001907    426                  LEAVE_FRAME
+000001908    426                       RETURN 4
+
+
+Function: <unknown>
+
+000001909    426                  ENTER_FRAME 0x55a2cce5c878
+000001910    426                  CALL_EXTERN 0x55a29d6d60f0
+000001911    426                  LEAVE_FRAME
+000001912    426                       RETURN 2
+
+
+Function: <unknown>
+
+000001913    426                  ENTER_FRAME 0x55a2cce5c8d8
+000001914    426                  CALL_EXTERN 0x55a29d6d60c0
+000001915    426                  LEAVE_FRAME
+000001916    426                       RETURN 2
+
+
+Function: <unknown>
+
+000001917    426                  ENTER_FRAME 0x55a2cce5c938
+000001918    426                  CALL_EXTERN 0x55a29d6d6090
+000001919    426                  LEAVE_FRAME
+000001920    426                       RETURN 2
+
+
+Function: <unknown>
+
+000001921    426                  ENTER_FRAME 0x55a2cce5c998
+000001922    426                  CALL_EXTERN 0x55a29d6d6050
+000001923    426                REF_CNT_LOCAL -- ^void 24
+000001924    426                REF_CNT_LOCAL -- ^void 32
+000001925    426                  LEAVE_FRAME
+000001926    426                       RETURN 5
+
+
+Function: <unknown>
+
+000001927    426                  ENTER_FRAME 0x55a2cce5ca28
+000001928    426                  CALL_EXTERN 0x55a29d6d68d0
+000001929    426                REF_CNT_LOCAL -- ^ErrPos 16
+000001930    426                  LEAVE_FRAME
+000001931    426                       RETURN 4
+
+
+Module: /root/repo/benchmarks/nbody.um
+
+
+Function: offsetMomentum
+
+000001932     19                  ENTER_FRAME 0x55a2cce5d1a8
+000001933     16                   PUSH_LOCAL ^ 40
+000001934     16                GET_FIELD_PTR 24
+000001935     16                   PUSH_LOCAL real 32
+000001936     16                     NEG_REAL real
+000001937     16                         PUSH real 39.4784
+000001938     16                     DIV_REAL real
+000001939     16                       ASSIGN real 8
+000001940     17                   PUSH_LOCAL ^ 40
+000001941     17                GET_FIELD_PTR 32
+000001942     17                   PUSH_LOCAL real 24
+000001943     17                     NEG_REAL real
+000001944     17                         PUSH real 39.4784
+000001945     17                     DIV_REAL real
+000001946     17                       ASSIGN real 8
+000001947     18                   PUSH_LOCAL ^ 40
+000001948     18                GET_FIELD_PTR 40
+000001949     18                   PUSH_LOCAL real 16
+000001950     18                     NEG_REAL real
+000001951     18                         PUSH real 39.4784
+000001952     18                     DIV_REAL real
+000001953     18                       ASSIGN real 8
+000001954     19                REF_CNT_LOCAL -- ^Body 40
+000001955     19                  LEAVE_FRAME
+000001956     19                       RETURN 6
+
+
+Function: NewSystem
+
+000001957     36                  ENTER_FRAME 0x55a2cce23f38
+000001958     24                   PUSH_LOCAL ^ 24
+000001959     24                        DEREF []
+000001960     24                 CALL_BUILTIN [] len
+000001961     24               PUSH_LOCAL_PTR -40
+000001962     24                 CALL_BUILTIN []^Body make
+000001963     24               PUSH_LOCAL_PTR -88
+000001964     24                  SWAP_ASSIGN [] 24
+000001965     25               PUSH_LOCAL_PTR -88
+000001966     25                          DUP
+000001967     25                 CALL_BUILTIN [] len
+000001968     25               PUSH_LOCAL_PTR -96
+000001969     25                  SWAP_ASSIGN int 8
+000001970     25                          POP 1
+000001971     25               PUSH_LOCAL_PTR -104
+000001972     25                         ZERO 8
+
+000001973     25                   PUSH_LOCAL int -104
+000001974     25                   PUSH_LOCAL int -96
+000001975     27       GOTO_IF_GREATER_EQ_INT int 1985
+000001976     26               PUSH_LOCAL_PTR -88
+000001977     26                   PUSH_LOCAL int -104
+000001978     26             GET_DYNARRAY_PTR
+000001979     26                   PUSH_LOCAL ^ 24
+000001980     26                   PUSH_LOCAL int -104
+000001981     26             GET_DYNARRAY_PTR
+000001982     26               REF_CNT_ASSIGN ^Body
+000001983     27                INC_LOCAL_INT -104
+000001984     27                         GOTO 1973
+
+000001985     28               PUSH_LOCAL_PTR -112
+000001986     28                         ZERO 8
+000001987     28               PUSH_LOCAL_PTR -120
+000001988     28                         ZERO 8
+000001989     28               PUSH_LOCAL_PTR -128
+000001990     28                         ZERO 8
+000001991     29               PUSH_LOCAL_PTR -88
+000001992     29                          DUP
+000001993     29                 CALL_BUILTIN [] len
+000001994     29               PUSH_LOCAL_PTR -136
+000001995     29                  SWAP_ASSIGN int 8
+000001996     29          PUSH_LOCAL_PTR_ZERO -160 24
+000001997     29          SWAP_REF_CNT_ASSIGN []^Body
+000001998     29               PUSH_LOCAL_PTR -168
+000001999     29                         ZERO 8
+000002000     29               PUSH_LOCAL_PTR -176
+000002001     29                         ZERO 8
+
+000002002     29                   PUSH_LOCAL int -168
+000002003     29                   PUSH_LOCAL int -136
+000002004     33       GOTO_IF_GREATER_EQ_INT int 2042
+000002005     29                   PUSH_LOCAL [] -160
+000002006     29                   PUSH_LOCAL int -168
+000002007     29                 GET_DYNARRAY ^
+000002008     29               PUSH_LOCAL_PTR -176
+000002009     29          SWAP_REF_CNT_ASSIGN ^Body
+000002010     30               PUSH_LOCAL_PTR -112
+000002011     30                          DUP
+000002012     30                        DEREF real
+000002013     30                   PUSH_LOCAL ^ -176
+000002014     30                    GET_FIELD real 24
+000002015     30                   PUSH_LOCAL ^ -176
+000002016     30                    GET_FIELD real 48
+000002017     30                     MUL_REAL real
+000002018     30                     ADD_REAL real
+000002019     30                       ASSIGN real 8
+000002020     31               PUSH_LOCAL_PTR -120
+000002021     31                          DUP
+000002022     31                        DEREF real
+000002023     31                   PUSH_LOCAL ^ -176
+000002024     31                    GET_FIELD real 32
+000002025     31                   PUSH_LOCAL ^ -176
+000002026     31                    GET_FIELD real 48
+000002027     31                     MUL_REAL real
+000002028     31                     ADD_REAL real
+000002029     31                       ASSIGN real 8
+000002030     32               PUSH_LOCAL_PTR -128
+000002031     32                          DUP
+000002032     32                        DEREF real
+000002033     32                   PUSH_LOCAL ^ -176
+000002034     32                    GET_FIELD real 40
+000002035     32                   PUSH_LOCAL ^ -176
+000002036     32                    GET_FIELD real 48
+000002037     32                     MUL_REAL real
+000002038     32                     ADD_REAL real
+000002039     32                       ASSIGN real 8
+000002040     33                INC_LOCAL_INT -168
+000002041     33                         GOTO 2002
+
+000002042     33                REF_CNT_LOCAL -- ^Body -176
+000002043     33                REF_CNT_LOCAL -- []^Body -160
+000002044     34                    PUSH_ZERO 2
+000002045     34               PUSH_LOCAL_PTR -88
+000002046     34                         PUSH int 0
+000002047     34                 GET_DYNARRAY ^
+000002048     34                      REF_CNT ++ ^Body
+000002049     34                   PUSH_LOCAL real -112
+000002050     34                   PUSH_LOCAL real -120
+000002051     34                   PUSH_LOCAL real -128
+000002052     34                         CALL offsetMomentum (1932)
+000002053     35               PUSH_LOCAL_PTR -88
+000002054     35                   PUSH_LOCAL ^ 16
+000002055     35                  SWAP_ASSIGN [] 24
+000002056     35                   PUSH_LOCAL ^ 16
+000002057     35                      REF_CNT ++ System
+000002058     35                      POP_REG RESULT
+000002059     35                REF_CNT_LOCAL -- []^Body -88
+000002060     36                         GOTO 2062
+
+000002061     36                REF_CNT_LOCAL -- []^Body -88
+
+000002062     36                REF_CNT_LOCAL -- ^[]Body 24
+000002063     36                  LEAVE_FRAME
+000002064     36                       RETURN 4
+
+
+Function: energy
+
+000002065     52                  ENTER_FRAME 0x55a2cce5dca8
+000002066     39               PUSH_LOCAL_PTR -24
+000002067     39                         ZERO 8
+000002068     40                   PUSH_LOCAL ^ 16
+000002069     40                        DEREF []
+000002070     40                          DUP
+000002071     40                 CALL_BUILTIN [] len
+000002072     40               PUSH_LOCAL_PTR -32
+000002073     40                  SWAP_ASSIGN int 8
+000002074     40          PUSH_LOCAL_PTR_ZERO -56 24
+000002075     40          SWAP_REF_CNT_ASSIGN System
+000002076     40               PUSH_LOCAL_PTR -64
+000002077     40                         ZERO 8
+000002078     40               PUSH_LOCAL_PTR -72
+000002079     40                         ZERO 8
+
+000002080     40                   PUSH_LOCAL int -64
+000002081     40                   PUSH_LOCAL int -32
+000002082     50       GOTO_IF_GREATER_EQ_INT int 2183
+000002083     40                   PUSH_LOCAL [] -56
+000002084     40                   PUSH_LOCAL int -64
+000002085     40                 GET_DYNARRAY ^
+000002086     40               PUSH_LOCAL_PTR -72
+000002087     40          SWAP_REF_CNT_ASSIGN ^Body
+000002088     41               PUSH_LOCAL_PTR -24
+000002089     41                          DUP
+000002090     41                        DEREF real
+000002091     41                         PUSH real 0.5
+000002092     41                   PUSH_LOCAL ^ -72
+000002093     41                    GET_FIELD real 48
+000002094     41                     MUL_REAL real
+000002095     41                   PUSH_LOCAL ^ -72
+000002096     41                    GET_FIELD real 24
+000002097     41                   PUSH_LOCAL ^ -72
+000002098     41                    GET_FIELD real 24
+000002099     41                     MUL_REAL real
+000002100     41                   PUSH_LOCAL ^ -72
+000002101     41                    GET_FIELD real 32
+000002102     41                   PUSH_LOCAL ^ -72
+000002103     41                    GET_FIELD real 32
+000002104     41                     MUL_REAL real
+000002105     41                     ADD_REAL real
+000002106     41                   PUSH_LOCAL ^ -72
+000002107     41                    GET_FIELD real 40
+000002108     41                   PUSH_LOCAL ^ -72
+000002109     41                    GET_FIELD real 40
+000002110     41                     MUL_REAL real
+000002111     41                     ADD_REAL real
+000002112     41                     MUL_REAL real
+000002113     41                     ADD_REAL real
+000002114     41                       ASSIGN real 8
+000002115     42                   PUSH_LOCAL int -64
+000002116     42                         PUSH int 1
+000002117     42                      ADD_INT int
+000002118     42               PUSH_LOCAL_PTR -80
+000002119     42                  SWAP_ASSIGN int 8
+
+000002120     42                   PUSH_LOCAL int -80
+000002121     42                   PUSH_LOCAL ^ 16
+000002122     42                        DEREF []
+000002123     42                 CALL_BUILTIN [] len
+000002124     49       GOTO_IF_GREATER_EQ_INT int 2181
+000002125     43                   PUSH_LOCAL ^ 16
+000002126     43                   PUSH_LOCAL int -80
+000002127     43                 GET_DYNARRAY ^
+000002128     43                      REF_CNT ++ ^Body
+000002129     43               PUSH_LOCAL_PTR -88
+000002130     43                  SWAP_ASSIGN ^ 8
+000002131     44                   PUSH_LOCAL ^ -72
+000002132     44                        DEREF real
+000002133     44                   PUSH_LOCAL ^ -88
+000002134     44                        DEREF real
+000002135     44                     SUB_REAL real
+000002136     44               PUSH_LOCAL_PTR -96
+000002137     44                  SWAP_ASSIGN real 8
+000002138     45                   PUSH_LOCAL ^ -72
+000002139     45                    GET_FIELD real 8
+000002140     45                   PUSH_LOCAL ^ -88
+000002141     45                    GET_FIELD real 8
+000002142     45                     SUB_REAL real
+000002143     45               PUSH_LOCAL_PTR -104
+000002144     45                  SWAP_ASSIGN real 8
+000002145     46                   PUSH_LOCAL ^ -72
+000002146     46                    GET_FIELD real 16
+000002147     46                   PUSH_LOCAL ^ -88
+000002148     46                    GET_FIELD real 16
+000002149     46                     SUB_REAL real
+000002150     46               PUSH_LOCAL_PTR -112
+000002151     46                  SWAP_ASSIGN real 8
+000002152     47                   PUSH_LOCAL real -96
+000002153     47                   PUSH_LOCAL real -96
+000002154     47                     MUL_REAL real
+000002155     47                   PUSH_LOCAL real -104
+000002156     47                   PUSH_LOCAL real -104
+000002157     47                     MUL_REAL real
+000002158     47                     ADD_REAL real
+000002159     47                   PUSH_LOCAL real -112
+000002160     47                   PUSH_LOCAL real -112
+000002161     47                     MUL_REAL real
+000002162     47                     ADD_REAL real
+000002163     47                 CALL_BUILTIN real sqrt
+000002164     47               PUSH_LOCAL_PTR -120
+000002165     47                  SWAP_ASSIGN real 8
+000002166     48               PUSH_LOCAL_PTR -24
+000002167     48                          DUP
+000002168     48                        DEREF real
+000002169     48                   PUSH_LOCAL ^ -72
+000002170     48                    GET_FIELD real 48
+000002171     48                   PUSH_LOCAL ^ -88
+000002172     48                    GET_FIELD real 48
+000002173     48                     MUL_REAL real
+000002174     48                   PUSH_LOCAL real -120
+000002175     48                     DIV_REAL real
+000002176     48                     SUB_REAL real
+000002177     48                       ASSIGN real 8
+000002178     49                REF_CNT_LOCAL -- ^Body -88
+000002179     49                INC_LOCAL_INT -80
+000002180     49                         GOTO 2120
+
+000002181     50                INC_LOCAL_INT -64
+000002182     50                         GOTO 2080
+
+000002183     50                REF_CNT_LOCAL -- ^Body -72
+000002184     50                REF_CNT_LOCAL -- System -56
+000002185     51                   PUSH_LOCAL real -24
+000002186     51                      POP_REG RESULT
+000002187     52                         GOTO 2188
+
+000002188     52                REF_CNT_LOCAL -- ^System 16
+000002189     52                  LEAVE_FRAME
+000002190     52                       RETURN 3
+
+
+Function: advance
+
+000002191     81                  ENTER_FRAME 0x55a2cce3de58
+000002192     55                   PUSH_LOCAL ^ 24
+000002193     55                        DEREF []
+000002194     55                          DUP
+000002195     55                 CALL_BUILTIN [] len
+000002196     55               PUSH_LOCAL_PTR -24
+000002197     55                  SWAP_ASSIGN int 8
+000002198     55          PUSH_LOCAL_PTR_ZERO -48 24
+000002199     55          SWAP_REF_CNT_ASSIGN System
+000002200     55               PUSH_LOCAL_PTR -56
+000002201     55                         ZERO 8
+000002202     55               PUSH_LOCAL_PTR -64
+000002203     55                         ZERO 8
+
+000002204     55                   PUSH_LOCAL int -56
+000002205     55                   PUSH_LOCAL int -24
+000002206     74       GOTO_IF_GREATER_EQ_INT int 2350
+000002207     55                   PUSH_LOCAL [] -48
+000002208     55                   PUSH_LOCAL int -56
+000002209     55                 GET_DYNARRAY ^
+000002210     55               PUSH_LOCAL_PTR -64
+000002211     55          SWAP_REF_CNT_ASSIGN ^Body
+000002212     56                   PUSH_LOCAL int -56
+000002213     56                         PUSH int 1
+000002214     56                      ADD_INT int
+000002215     56               PUSH_LOCAL_PTR -72
+000002216     56                  SWAP_ASSIGN int 8
+
+000002217     56                   PUSH_LOCAL int -72
+000002218     56                   PUSH_LOCAL ^ 24
+000002219     56                        DEREF []
+000002220     56                 CALL_BUILTIN [] len
+000002221     73       GOTO_IF_GREATER_EQ_INT int 2348
+000002222     57                   PUSH_LOCAL ^ 24
+000002223     57                   PUSH_LOCAL int -72
+000002224     57                 GET_DYNARRAY ^
+000002225     57                      REF_CNT ++ ^Body
+000002226     57               PUSH_LOCAL_PTR -80
+000002227     57                  SWAP_ASSIGN ^ 8
+000002228     58                   PUSH_LOCAL ^ -64
+000002229     58                        DEREF real
+000002230     58                   PUSH_LOCAL ^ -80
+000002231     58                        DEREF real
+000002232     58                     SUB_REAL real
+000002233     58               PUSH_LOCAL_PTR -88
+000002234     58                  SWAP_ASSIGN real 8
+000002235     59                   PUSH_LOCAL ^ -64
+000002236     59                    GET_FIELD real 8
+000002237     59                   PUSH_LOCAL ^ -80
+000002238     59                    GET_FIELD real 8
+000002239     59                     SUB_REAL real
+000002240     59               PUSH_LOCAL_PTR -96
+000002241     59                  SWAP_ASSIGN real 8
+000002242     60                   PUSH_LOCAL ^ -64
+000002243     60                    GET_FIELD real 16
+000002244     60                   PUSH_LOCAL ^ -80
+000002245     60                    GET_FIELD real 16
+000002246     60                     SUB_REAL real
+000002247     60               PUSH_LOCAL_PTR -104
+000002248     60                  SWAP_ASSIGN real 8
+000002249     62                   PUSH_LOCAL real -88
+000002250     62                   PUSH_LOCAL real -88
+000002251     62                     MUL_REAL real
+000002252     62                   PUSH_LOCAL real -96
+000002253     62                   PUSH_LOCAL real -96
+000002254     62                     MUL_REAL real
+000002255     62                     ADD_REAL real
+000002256     62                   PUSH_LOCAL real -104
+000002257     62                   PUSH_LOCAL real -104
+000002258     62                     MUL_REAL real
+000002259     62                     ADD_REAL real
+000002260     62               PUSH_LOCAL_PTR -112
+000002261     62                  SWAP_ASSIGN real 8
+000002262     63                   PUSH_LOCAL real -112
+000002263     63                 CALL_BUILTIN real sqrt
+000002264     63               PUSH_LOCAL_PTR -120
+000002265     63                  SWAP_ASSIGN real 8
+000002266     64                   PUSH_LOCAL real 16
+000002267     64                   PUSH_LOCAL real -112
+000002268     64                   PUSH_LOCAL real -120
+000002269     64                     MUL_REAL real
+000002270     64                     DIV_REAL real
+000002271     64               PUSH_LOCAL_PTR -128
+000002272     64                  SWAP_ASSIGN real 8
+000002273     66                   PUSH_LOCAL ^ -64
+000002274     66                GET_FIELD_PTR 24
+000002275     66                          DUP
+000002276     66                        DEREF real
+000002277     66                   PUSH_LOCAL real -88
+000002278     66                   PUSH_LOCAL ^ -80
+000002279     66                    GET_FIELD real 48
+000002280     66                     MUL_REAL real
+000002281     66                   PUSH_LOCAL real -128
+000002282     66                     MUL_REAL real
+000002283     66                     SUB_REAL real
+000002284     66                       ASSIGN real 8
+000002285     67                   PUSH_LOCAL ^ -64
+000002286     67                GET_FIELD_PTR 32
+000002287     67                          DUP
+000002288     67                        DEREF real
+000002289     67                   PUSH_LOCAL real -96
+000002290     67                   PUSH_LOCAL ^ -80
+000002291     67                    GET_FIELD real 48
+000002292     67                     MUL_REAL real
+000002293     67                   PUSH_LOCAL real -128
+000002294     67                     MUL_REAL real
+000002295     67                     SUB_REAL real
+000002296     67                       ASSIGN real 8
+000002297     68                   PUSH_LOCAL ^ -64
+000002298     68                GET_FIELD_PTR 40
+000002299     68                          DUP
+000002300     68                        DEREF real
+000002301     68                   PUSH_LOCAL real -104
+000002302     68                   PUSH_LOCAL ^ -80
+000002303     68                    GET_FIELD real 48
+000002304     68                     MUL_REAL real
+000002305     68                   PUSH_LOCAL real -128
+000002306     68                     MUL_REAL real
+000002307     68                     SUB_REAL real
+000002308     68                       ASSIGN real 8
+000002309     70                   PUSH_LOCAL ^ -80
+000002310     70                GET_FIELD_PTR 24
+000002311     70                          DUP
+000002312     70                        DEREF real
+000002313     70                   PUSH_LOCAL real -88
+000002314     70                   PUSH_LOCAL ^ -64
+000002315     70                    GET_FIELD real 48
+000002316     70                     MUL_REAL real
+000002317     70                   PUSH_LOCAL real -128
+000002318     70                     MUL_REAL real
+000002319     70                     ADD_REAL real
+000002320     70                       ASSIGN real 8
+000002321     71                   PUSH_LOCAL ^ -80
+000002322     71                GET_FIELD_PTR 32
+000002323     71                          DUP
+000002324     71                        DEREF real
+000002325     71                   PUSH_LOCAL real -96
+000002326     71                   PUSH_LOCAL ^ -64
+000002327     71                    GET_FIELD real 48
+000002328     71                     MUL_REAL real
+000002329     71                   PUSH_LOCAL real -128
+000002330     71                     MUL_REAL real
+000002331     71                     ADD_REAL real
+000002332     71                       ASSIGN real 8
+000002333     72                   PUSH_LOCAL ^ -80
+000002334     72                GET_FIELD_PTR 40
+000002335     72                          DUP
+000002336     72                        DEREF real
+000002337     72                   PUSH_LOCAL real -104
+000002338     72                   PUSH_LOCAL ^ -64
+000002339     72                    GET_FIELD real 48
+000002340     72                     MUL_REAL real
+000002341     72                   PUSH_LOCAL real -128
+000002342     72                     MUL_REAL real
+000002343     72                     ADD_REAL real
+000002344     72                       ASSIGN real 8
+000002345     73                REF_CNT_LOCAL -- ^Body -80
+000002346     73                INC_LOCAL_INT -72
+000002347     73                         GOTO 2217
+
+000002348     74                INC_LOCAL_INT -56
+000002349     74                         GOTO 2204
+
+000002350     74                REF_CNT_LOCAL -- ^Body -64
+000002351     74                REF_CNT_LOCAL -- System -48
+000002352     76                   PUSH_LOCAL ^ 24
+000002353     76                        DEREF []
+000002354     76                          DUP
+000002355     76                 CALL_BUILTIN [] len
+000002356     76               PUSH_LOCAL_PTR -136
+000002357     76                  SWAP_ASSIGN int 8
+000002358     76          PUSH_LOCAL_PTR_ZERO -160 24
+000002359     76          SWAP_REF_CNT_ASSIGN System
+000002360     76               PUSH_LOCAL_PTR -168
+000002361     76                         ZERO 8
+000002362     76               PUSH_LOCAL_PTR -176
+000002363     76                         ZERO 8
+
+000002364     76                   PUSH_LOCAL int -168
+000002365     76                   PUSH_LOCAL int -136
+000002366     80       GOTO_IF_GREATER_EQ_INT int 2404
+000002367     76                   PUSH_LOCAL [] -160
+000002368     76                   PUSH_LOCAL int -168
+000002369     76                 GET_DYNARRAY ^
+000002370     76               PUSH_LOCAL_PTR -176
+000002371     76          SWAP_REF_CNT_ASSIGN ^Body
+000002372     77                   PUSH_LOCAL ^ -176
+000002373     77                GET_FIELD_PTR 0
+000002374     77                          DUP
+000002375     77                        DEREF real
+000002376     77                   PUSH_LOCAL real 16
+000002377     77                   PUSH_LOCAL ^ -176
+000002378     77                    GET_FIELD real 24
+000002379     77                     MUL_REAL real
+000002380     77                     ADD_REAL real
+000002381     77                       ASSIGN real 8
+000002382     78                   PUSH_LOCAL ^ -176
+000002383     78                GET_FIELD_PTR 8
+000002384     78                          DUP
+000002385     78                        DEREF real
+000002386     78                   PUSH_LOCAL real 16
+000002387     78                   PUSH_LOCAL ^ -176
+000002388     78                    GET_FIELD real 32
+000002389     78                     MUL_REAL real
+000002390     78                     ADD_REAL real
+000002391     78                       ASSIGN real 8
+000002392     79                   PUSH_LOCAL ^ -176
+000002393     79                GET_FIELD_PTR 16
+000002394     79                          DUP
+000002395     79                        DEREF real
+000002396     79                   PUSH_LOCAL real 16
+000002397     79                   PUSH_LOCAL ^ -176
+000002398     79                    GET_FIELD real 40
+000002399     79                     MUL_REAL real
+000002400     79                     ADD_REAL real
+000002401     79                       ASSIGN real 8
+000002402     80                INC_LOCAL_INT -168
+000002403     80                         GOTO 2364
+
+000002404     80                REF_CNT_LOCAL -- ^Body -176
+000002405     80                REF_CNT_LOCAL -- System -160
+000002406     81                REF_CNT_LOCAL -- ^System 24
+000002407     81                  LEAVE_FRAME
+000002408     81                       RETURN 4
+
+
+Function: test
+
+000002409    131                  ENTER_FRAME 0x55a2cce40218
+000002410    124          PUSH_LOCAL_PTR_ZERO -40 24
+000002411    124          PUSH_LOCAL_PTR_ZERO -320 280
+000002412    124                         PUSH ^ sun
+000002413    124                       ASSIGN struct 56
+000002414    124               PUSH_LOCAL_PTR -264
+000002415    124                         PUSH ^ jupiter
+000002416    124                       ASSIGN struct 56
+000002417    124               PUSH_LOCAL_PTR -208
+000002418    124                         PUSH ^ saturn
+000002419    124                       ASSIGN struct 56
+000002420    124               PUSH_LOCAL_PTR -152
+000002421    124                         PUSH ^ uranus
+000002422    124                       ASSIGN struct 56
+000002423    124               PUSH_LOCAL_PTR -96
+000002424    124                         PUSH ^ neptune
+000002425    124                       ASSIGN struct 56
+000002426    124               PUSH_LOCAL_PTR -320
+000002427    124                         PUSH int 5
+000002428    124               PUSH_LOCAL_PTR -344
+000002429    124                 CALL_BUILTIN []Body makefromarr
+000002430    124               REF_CNT_ASSIGN -- []Body
+000002431    125                    PUSH_ZERO 2
+000002432    125               PUSH_LOCAL_PTR -40
+000002433    125                      REF_CNT ++ ^[]Body
+000002434    125          PUSH_LOCAL_PTR_ZERO -392 24
+000002435    125                         CALL NewSystem (1957)
+000002436    125                     PUSH_REG RESULT
+000002437    125               PUSH_LOCAL_PTR -440
+000002438    125                  SWAP_ASSIGN [] 24
+000002439    126                         PUSH int 0
+000002440    126                         PUSH ^ (nil)
+000002441    126                         PUSH ^ 0x55a2cce09fa8
+000002442    126                    PUSH_ZERO 2
+000002443    126               PUSH_LOCAL_PTR -440
+000002444    126                      REF_CNT ++ ^System
+000002445    126                         CALL energy (2065)
+000002446    126                     PUSH_REG RESULT
+000002447    126                 CALL_BUILTIN real printf
+000002448    126                         PUSH int 0
+000002449    126                 CALL_BUILTIN void printf
+000002450    126                          POP 3
+000002451    127                         PUSH int 0
+000002452    127               PUSH_LOCAL_PTR -448
+000002453    127                  SWAP_ASSIGN int 8
+
+000002454    127                   PUSH_LOCAL int -448
+000002455    127                   PUSH_LOCAL int 16
+000002456    129       GOTO_IF_GREATER_EQ_INT int 2464
+000002457    128                    PUSH_ZERO 2
+000002458    128               PUSH_LOCAL_PTR -440
+000002459    128                      REF_CNT ++ ^System
+000002460    128                         PUSH real 0.01
+000002461    128                         CALL advance (2191)
+000002462    129                INC_LOCAL_INT -448
+000002463    129                         GOTO 2454
+
+000002464    130                         PUSH int 0
+000002465    130                         PUSH ^ (nil)
+000002466    130                         PUSH ^ 0x55a2cce0a118
+000002467    130                    PUSH_ZERO 2
+000002468    130               PUSH_LOCAL_PTR -440
+000002469    130                      REF_CNT ++ ^System
+000002470    130                         CALL energy (2065)
+000002471    130                     PUSH_REG RESULT
+000002472    130                 CALL_BUILTIN real printf
+000002473    130                         PUSH int 0
+000002474    130                 CALL_BUILTIN void printf
+000002475    130                          POP 3
+000002476    131                REF_CNT_LOCAL -- System -440
+000002477    131                REF_CNT_LOCAL -- []Body -40
+000002478    131                  LEAVE_FRAME
+000002479    131                       RETURN 3
+
+
+Function: main
+
+000002480    137                  ENTER_FRAME 0x55a2cce42c28
+000002481    134                    PUSH_ZERO 2
+000002482    134                         CALL argc (1793)
+000002483    134                     PUSH_REG RESULT
+000002484    134                         PUSH int 2
+000002485    136           GOTO_IF_NOT_EQ_INT int 2493
+000002486    135                    PUSH_ZERO 6
+000002487    135                         PUSH int 1
+000002488    135                         CALL argv (1801)
+000002489    135                     PUSH_REG RESULT
+000002490    135                         CALL atoi (1569)
+000002491    135                     PUSH_REG RESULT
+000002492    135                         CALL test (2409)
+000002493    137                  LEAVE_FRAME
+000002494    137                       RETURN 2
+
+000002495    139               REF_CNT_GLOBAL -- [15]str fopenModes
+000002496    139               REF_CNT_GLOBAL -- []str stdErrMsg
+000002497    139               REF_CNT_GLOBAL -- [1]str rtlargv
+000002498    139                         HALT
\ No newline at end of file
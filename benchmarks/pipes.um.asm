@@ -0,0 +1,3681 @@
+
+Module: /root/repo/benchmarks/pipes.um
+
+000000000     56                         GOTO 3066
+
+
+Module: /root/repo/benchmarks/std.um
+
+000000001    541                         GOTO 2644
+
+
+Function: error
+
+000000002     49                  ENTER_FRAME 0x558b1933e358
+000000003     41          PUSH_LOCAL_PTR_ZERO -72 56
+000000004     41                   PUSH_LOCAL int 48
+000000005     41                       ASSIGN int 8
+000000006     41               PUSH_LOCAL_PTR -64
+000000007     41                   PUSH_LOCAL str 40
+000000008     41               REF_CNT_ASSIGN str
+000000009     41               PUSH_LOCAL_PTR -56
+000000010     41               PUSH_LOCAL_PTR 24
+000000011     41               REF_CNT_ASSIGN interface
+000000012     41               PUSH_LOCAL_PTR -40
+000000013     41          PUSH_LOCAL_PTR_ZERO -96 24
+000000014     41               REF_CNT_ASSIGN []ErrPos
+000000015     41               PUSH_LOCAL_PTR -72
+000000016     41                      REF_CNT ++ Err
+000000017     41               PUSH_LOCAL_PTR -152
+000000018     41                  SWAP_ASSIGN struct 56
+000000019     42                   PUSH_LOCAL int 48
+000000020     42                         PUSH int 0
+000000021     47               GOTO_IF_EQ_INT int 52
+000000022     43               PUSH_LOCAL_PTR -176
+000000023     43                         ZERO 24
+000000024     44                         PUSH int 2
+000000025     44               PUSH_LOCAL_PTR -184
+000000026     44                  SWAP_ASSIGN int 8
+
+000000027     44                   PUSH_LOCAL int -184
+000000028     44                         PUSH int 10
+000000029     44                     LESS_INT int
+000000030     44                          DUP
+000000031     44                  GOTO_IF_NOT 41
+
+000000032     44                          POP 1
+000000033     44                    PUSH_ZERO 2
+000000034     44                   PUSH_LOCAL int -184
+000000035     44               PUSH_LOCAL_PTR -176
+000000036     44                      REF_CNT ++ ^ErrPos
+000000037     44                         CALL rtltrace (1)
+000000038     44                     PUSH_REG RESULT
+000000039     44                         PUSH int 0
+000000040     44                       EQ_INT int
+
+000000041     46                  GOTO_IF_NOT 51
+
+000000042     45               PUSH_LOCAL_PTR -120
+000000043     45               PUSH_LOCAL_PTR -120
+000000044     45               PUSH_LOCAL_PTR -176
+000000045     45                         PUSH int 1
+000000046     45               PUSH_LOCAL_PTR -208
+000000047     45                 CALL_BUILTIN []ErrPos append
+000000048     45               REF_CNT_ASSIGN -- []ErrPos
+000000049     46                INC_LOCAL_INT -184
+000000050     46                         GOTO 27
+
+000000051     47                REF_CNT_LOCAL -- ErrPos -176
+000000052     48               PUSH_LOCAL_PTR -152
+000000053     48                   PUSH_LOCAL ^ 16
+000000054     48                  SWAP_ASSIGN struct 56
+000000055     48                   PUSH_LOCAL ^ 16
+000000056     48                      REF_CNT ++ Err
+000000057     48                      POP_REG RESULT
+000000058     48                REF_CNT_LOCAL -- Err -152
+000000059     48                REF_CNT_LOCAL -- Err -72
+000000060     49                         GOTO 63
+
+000000061     49                REF_CNT_LOCAL -- Err -152
+000000062     49                REF_CNT_LOCAL -- Err -72
+
+000000063     49                REF_CNT_LOCAL -- interface 24
+000000064     49                REF_CNT_LOCAL -- str 40
+000000065     49                  LEAVE_FRAME
+000000066     49                       RETURN 7
+
+
+Function: stderror
+
+000000067     53                  ENTER_FRAME 0x558b1933fa18
+000000068     52                    PUSH_ZERO 2
+000000069     52                   PUSH_LOCAL int 24
+000000070     52                 ASSERT_RANGE StdErr int
+000000071     52                         PUSH ^ stdErrMsg
+000000072     52                   PUSH_LOCAL int 24
+000000073     52                 ASSERT_RANGE StdErr int
+000000074     52                 GET_DYNARRAY str
+000000075     52                      REF_CNT ++ str
+000000076     52                         PUSH ^ 0x558b1933e7a0
+000000077     52                 CALL_BUILTIN str new
+000000078     52                          DUP
+000000079     52                      POP_REG HEAP_COPY
+000000080     52          SWAP_REF_CNT_ASSIGN str
+000000081     52                     PUSH_REG HEAP_COPY
+000000082     52               PUSH_LOCAL_PTR -32
+000000083     52                  SWAP_ASSIGN ^ 0
+000000084     52                         PUSH ^ 0x558b1933f9a8
+000000085     52               PUSH_LOCAL_PTR -24
+000000086     52                  SWAP_ASSIGN ^ 0
+000000087     52               PUSH_LOCAL_PTR -32
+000000088     52                 ASSIGN_PARAM interface 16
+000000089     52          PUSH_LOCAL_PTR_ZERO -104 56
+000000090     52                         CALL error (2)
+000000091     52                     PUSH_REG RESULT
+000000092     52                          DUP
+000000093     52               PUSH_LOCAL_PTR -160
+000000094     52                  SWAP_ASSIGN struct 56
+000000095     52                   PUSH_LOCAL ^ 16
+000000096     52                  SWAP_ASSIGN struct 56
+000000097     52                   PUSH_LOCAL ^ 16
+000000098     52                      REF_CNT ++ Err
+000000099     52                      POP_REG RESULT
+000000100     52                REF_CNT_LOCAL -- Err -160
+000000101     53                         GOTO 103
+
+000000102     53                REF_CNT_LOCAL -- Err -160
+
+000000103     53                  LEAVE_FRAME
+000000104     53                       RETURN 4
+
+
+Function: exitif
+
+000000105     64                  ENTER_FRAME 0x558b1933f4c8
+000000106     56                   PUSH_LOCAL int 16
+000000107     56                         PUSH int 0
+000000108     63               GOTO_IF_EQ_INT int 179
+000000109     57                         PUSH int 0
+000000110     57                         PUSH ^ (nil)
+000000111     57                   PUSH_LOCAL str 24
+000000112     57                   PUSH_LOCAL int 16
+000000113     57               PUSH_LOCAL_PTR 32
+000000114     57                  CALL_PRINTF sprintf 3
+000000115     57               PUSH_LOCAL_PTR -32
+000000116     57                  SWAP_ASSIGN str 8
+000000117     58               PUSH_LOCAL_PTR -32
+000000118     58                          DUP
+000000119     58                        DEREF str
+000000120     58                         PUSH int 0
+000000121     58                         PUSH ^ (nil)
+000000122     58                  CALL_PRINTF sprintf 0
+000000123     58                          DUP
+000000124     58               PUSH_LOCAL_PTR -40
+000000125     58                  SWAP_ASSIGN str 8
+000000126     58                       BINARY += str
+000000127     58                          DUP
+000000128     58               PUSH_LOCAL_PTR -48
+000000129     58                  SWAP_ASSIGN str 8
+000000130     58               REF_CNT_ASSIGN str
+000000131     59               PUSH_LOCAL_PTR 48
+000000132     59                          DUP
+000000133     59                 CALL_BUILTIN [] len
+000000134     59               PUSH_LOCAL_PTR -56
+000000135     59                  SWAP_ASSIGN int 8
+000000136     59          PUSH_LOCAL_PTR_ZERO -80 24
+000000137     59          SWAP_REF_CNT_ASSIGN []ErrPos
+000000138     59               PUSH_LOCAL_PTR -88
+000000139     59                         ZERO 8
+000000140     59               PUSH_LOCAL_PTR -112
+000000141     59                         ZERO 24
+
+000000142     59                   PUSH_LOCAL int -88
+000000143     59                   PUSH_LOCAL int -56
+000000144     61       GOTO_IF_GREATER_EQ_INT int 171
+000000145     59                   PUSH_LOCAL [] -80
+000000146     59                   PUSH_LOCAL int -88
+000000147     59                 GET_DYNARRAY struct
+000000148     59               PUSH_LOCAL_PTR -112
+000000149     59          SWAP_REF_CNT_ASSIGN ErrPos
+000000150     60               PUSH_LOCAL_PTR -32
+000000151     60                          DUP
+000000152     60                        DEREF str
+000000153     60                         PUSH int 0
+000000154     60                         PUSH ^ (nil)
+000000155     60                   PUSH_LOCAL str -104
+000000156     60                   PUSH_LOCAL str -112
+000000157     60                   PUSH_LOCAL int -96
+000000158     60                  CALL_PRINTF sprintf 3
+000000159     60                          DUP
+000000160     60               PUSH_LOCAL_PTR -120
+000000161     60                  SWAP_ASSIGN str 8
+000000162     60                       BINARY += str
+000000163     60                          DUP
+000000164     60               PUSH_LOCAL_PTR -128
+000000165     60                  SWAP_ASSIGN str 8
+000000166     60               REF_CNT_ASSIGN str
+000000167     61                REF_CNT_LOCAL -- str -128
+000000168     61                REF_CNT_LOCAL -- str -120
+000000169     61                INC_LOCAL_INT -88
+000000170     61                         GOTO 142
+
+000000171     61                REF_CNT_LOCAL -- ErrPos -112
+000000172     61                REF_CNT_LOCAL -- []ErrPos -80
+000000173     62                   PUSH_LOCAL int 16
+000000174     62                   PUSH_LOCAL str -32
+000000175     62                 CALL_BUILTIN void exit
+000000176     63                REF_CNT_LOCAL -- str -48
+000000177     63                REF_CNT_LOCAL -- str -40
+000000178     63                REF_CNT_LOCAL -- str -32
+000000179     64                REF_CNT_LOCAL -- Err 16
+000000180     64                  LEAVE_FRAME
+000000181     64                       RETURN 9
+
+
+Function: assert
+
+000000182     74                  ENTER_FRAME 0x558b19341778
+000000183     67                   PUSH_LOCAL bool 24
+000000184     67                        UNARY ! bool
+000000185     73                  GOTO_IF_NOT 219
+
+000000186     68                    PUSH_ZERO 2
+000000187     68                         PUSH int 1
+000000188     68          PUSH_LOCAL_PTR_ZERO -72 56
+000000189     68                         CALL stderror (67)
+000000190     68                     PUSH_REG RESULT
+000000191     68               PUSH_LOCAL_PTR -184
+000000192     68                  SWAP_ASSIGN struct 56
+000000193     69                   PUSH_LOCAL str 16
+000000194     69                         PUSH ^ 0x558b1933ec20
+000000195     69                       BINARY != str
+000000196     71                  GOTO_IF_NOT 213
+
+000000197     70               PUSH_LOCAL_PTR -176
+000000198     70                          DUP
+000000199     70                        DEREF str
+000000200     70                         PUSH ^ 0x558b1933f270
+000000201     70                   PUSH_LOCAL str 16
+000000202     70                 STR_CONCAT_N 2
+000000203     70                          DUP
+000000204     70               PUSH_LOCAL_PTR -192
+000000205     70                  SWAP_ASSIGN str 8
+000000206     70                       BINARY += str
+000000207     70                          DUP
+000000208     70               PUSH_LOCAL_PTR -200
+000000209     70                  SWAP_ASSIGN str 8
+000000210     70               REF_CNT_ASSIGN str
+000000211     71                REF_CNT_LOCAL -- str -200
+000000212     71                REF_CNT_LOCAL -- str -192
+
+000000213     72                    PUSH_ZERO 2
+000000214     72               PUSH_LOCAL_PTR -184
+000000215     72                      REF_CNT ++ Err
+000000216     72                 ASSIGN_PARAM struct 56
+000000217     72                         CALL exitif (105)
+000000218     73                REF_CNT_LOCAL -- Err -184
+
+000000219     74                REF_CNT_LOCAL -- str 16
+000000220     74                  LEAVE_FRAME
+000000221     74                       RETURN 4
+
+000000222    541                         GOTO 2638
+
+
+Function: tobytes
+
+000000223     87                  ENTER_FRAME 0x558b19342548
+000000224     81               PUSH_LOCAL_PTR 24
+000000225     81                 CALL_BUILTIN interface valid
+000000226     81                        UNARY ! bool
+000000227     83                  GOTO_IF_NOT 235
+
+000000228     82          PUSH_LOCAL_PTR_ZERO -40 24
+000000229     82                   PUSH_LOCAL ^ 16
+000000230     82                  SWAP_ASSIGN [] 24
+000000231     82                   PUSH_LOCAL ^ 16
+000000232     82                      REF_CNT ++ []uint8
+000000233     82                      POP_REG RESULT
+000000234     87                         GOTO 261
+
+000000235     84               PUSH_LOCAL_PTR 24
+000000236     84                 CALL_BUILTIN interface sizeofself
+000000237     84               PUSH_LOCAL_PTR -64
+000000238     84                 CALL_BUILTIN []uint8 make
+000000239     84               PUSH_LOCAL_PTR -112
+000000240     84                  SWAP_ASSIGN [] 24
+000000241     85                    PUSH_ZERO 2
+000000242     85               PUSH_LOCAL_PTR -112
+000000243     85                         PUSH int 0
+000000244     85             GET_DYNARRAY_PTR
+000000245     85                      REF_CNT ++ ^void
+000000246     85               PUSH_LOCAL_PTR 24
+000000247     85                 CALL_BUILTIN interface selfptr
+000000248     85                      REF_CNT ++ ^void
+000000249     85               PUSH_LOCAL_PTR 24
+000000250     85                 CALL_BUILTIN interface sizeofself
+000000251     85                         CALL rtlmemcpy (222)
+000000252     86               PUSH_LOCAL_PTR -112
+000000253     86                   PUSH_LOCAL ^ 16
+000000254     86                  SWAP_ASSIGN [] 24
+000000255     86                   PUSH_LOCAL ^ 16
+000000256     86                      REF_CNT ++ []uint8
+000000257     86                      POP_REG RESULT
+000000258     86                REF_CNT_LOCAL -- []uint8 -112
+000000259     87                         GOTO 261
+
+000000260     87                REF_CNT_LOCAL -- []uint8 -112
+
+000000261     87                REF_CNT_LOCAL -- interface 24
+000000262     87                  LEAVE_FRAME
+000000263     87                       RETURN 5
+
+
+Function: frombytes
+
+000000264     98                  ENTER_FRAME 0x558b19342e88
+000000265     90               PUSH_LOCAL_PTR 48
+000000266     90                 CALL_BUILTIN interface valid
+000000267     90                        UNARY ! bool
+000000268     90                          DUP
+000000269     90                      GOTO_IF 276
+
+000000270     90                          POP 1
+000000271     90               PUSH_LOCAL_PTR 48
+000000272     90                 CALL_BUILTIN interface sizeofself
+000000273     90               PUSH_LOCAL_PTR 24
+000000274     90                 CALL_BUILTIN [] len
+000000275     90                   NOT_EQ_INT int
+
+000000276     92                  GOTO_IF_NOT 293
+
+000000277     91                    PUSH_ZERO 2
+000000278     91                         PUSH int 2
+000000279     91          PUSH_LOCAL_PTR_ZERO -72 56
+000000280     91                         CALL stderror (67)
+000000281     91                     PUSH_REG RESULT
+000000282     91                          DUP
+000000283     91               PUSH_LOCAL_PTR -128
+000000284     91                  SWAP_ASSIGN struct 56
+000000285     91                   PUSH_LOCAL ^ 16
+000000286     91                  SWAP_ASSIGN struct 56
+000000287     91                   PUSH_LOCAL ^ 16
+000000288     91                      REF_CNT ++ Err
+000000289     91                      POP_REG RESULT
+000000290     91                REF_CNT_LOCAL -- Err -128
+000000291     98                         GOTO 332
+
+000000292     92                REF_CNT_LOCAL -- Err -128
+
+000000293     93               PUSH_LOCAL_PTR 48
+000000294     93                 CALL_BUILTIN interface selfhasptr
+000000295     95                  GOTO_IF_NOT 312
+
+000000296     94                    PUSH_ZERO 2
+000000297     94                         PUSH int 3
+000000298     94          PUSH_LOCAL_PTR_ZERO -184 56
+000000299     94                         CALL stderror (67)
+000000300     94                     PUSH_REG RESULT
+000000301     94                          DUP
+000000302     94               PUSH_LOCAL_PTR -240
+000000303     94                  SWAP_ASSIGN struct 56
+000000304     94                   PUSH_LOCAL ^ 16
+000000305     94                  SWAP_ASSIGN struct 56
+000000306     94                   PUSH_LOCAL ^ 16
+000000307     94                      REF_CNT ++ Err
+000000308     94                      POP_REG RESULT
+000000309     94                REF_CNT_LOCAL -- Err -240
+000000310     98                         GOTO 332
+
+000000311     95                REF_CNT_LOCAL -- Err -240
+
+000000312     96                    PUSH_ZERO 2
+000000313     96               PUSH_LOCAL_PTR 48
+000000314     96                 CALL_BUILTIN interface selfptr
+000000315     96                      REF_CNT ++ ^void
+000000316     96               PUSH_LOCAL_PTR 24
+000000317     96                         PUSH int 0
+000000318     96             GET_DYNARRAY_PTR
+000000319     96                      REF_CNT ++ ^void
+000000320     96               PUSH_LOCAL_PTR 48
+000000321     96                 CALL_BUILTIN interface sizeofself
+000000322     96                         CALL rtlmemcpy (222)
+000000323     97          PUSH_LOCAL_PTR_ZERO -296 56
+000000324     97                   PUSH_LOCAL ^ 16
+000000325     97                  SWAP_ASSIGN struct 56
+000000326     97                   PUSH_LOCAL ^ 16
+000000327     97                      REF_CNT ++ Err
+000000328     97                      POP_REG RESULT
+000000329     97                REF_CNT_LOCAL -- Err -296
+000000330     98                         GOTO 332
+
+000000331     98                REF_CNT_LOCAL -- Err -296
+
+000000332     98                REF_CNT_LOCAL -- []uint8 24
+000000333     98                REF_CNT_LOCAL -- interface 48
+000000334     98                  LEAVE_FRAME
+000000335     98                       RETURN 8
+
+000000336    541                         GOTO 2633
+
+
+Function: heapsnapshot
+
+000000337    123                  ENTER_FRAME 0x558b19345418
+000000338    120               PUSH_LOCAL_PTR -40
+000000339    120                         ZERO 24
+000000340    121                    PUSH_ZERO 2
+000000341    121               PUSH_LOCAL_PTR -40
+000000342    121                      REF_CNT ++ ^[]HeapSite
+000000343    121                         CALL rtlheapsnapshot (336)
+000000344    122               PUSH_LOCAL_PTR -40
+000000345    122                   PUSH_LOCAL ^ 16
+000000346    122                  SWAP_ASSIGN [] 24
+000000347    122                   PUSH_LOCAL ^ 16
+000000348    122                      REF_CNT ++ []HeapSite
+000000349    122                      POP_REG RESULT
+000000350    122                REF_CNT_LOCAL -- []HeapSite -40
+000000351    123                         GOTO 353
+
+000000352    123                REF_CNT_LOCAL -- []HeapSite -40
+
+000000353    123                  LEAVE_FRAME
+000000354    123                       RETURN 3
+
+
+Function: heapdiff
+
+000000355    150                  ENTER_FRAME 0x558b19345228
+000000356    126          PUSH_LOCAL_PTR_ZERO -32 16
+000000357    126                 CALL_BUILTIN map[HeapSiteKey]HeapSite make
+000000358    126                      REF_CNT ++ map[HeapSiteKey]HeapSite
+000000359    126               PUSH_LOCAL_PTR -48
+000000360    126                  SWAP_ASSIGN map 16
+000000361    128               PUSH_LOCAL_PTR 24
+000000362    128                          DUP
+000000363    128                 CALL_BUILTIN [] len
+000000364    128               PUSH_LOCAL_PTR -56
+000000365    128                  SWAP_ASSIGN int 8
+000000366    128          PUSH_LOCAL_PTR_ZERO -80 24
+000000367    128          SWAP_REF_CNT_ASSIGN []HeapSite
+000000368    128               PUSH_LOCAL_PTR -88
+000000369    128                         ZERO 8
+000000370    128               PUSH_LOCAL_PTR -136
+000000371    128                         ZERO 48
+
+000000372    128                   PUSH_LOCAL int -88
+000000373    128                   PUSH_LOCAL int -56
+000000374    130       GOTO_IF_GREATER_EQ_INT int 397
+000000375    128                   PUSH_LOCAL [] -80
+000000376    128                   PUSH_LOCAL int -88
+000000377    128                 GET_DYNARRAY struct
+000000378    128               PUSH_LOCAL_PTR -136
+000000379    128          SWAP_REF_CNT_ASSIGN HeapSite
+000000380    129               PUSH_LOCAL_PTR -48
+000000381    129          PUSH_LOCAL_PTR_ZERO -160 24
+000000382    129                   PUSH_LOCAL str -136
+000000383    129               REF_CNT_ASSIGN str
+000000384    129               PUSH_LOCAL_PTR -152
+000000385    129                   PUSH_LOCAL int -120
+000000386    129                       ASSIGN int 8
+000000387    129               PUSH_LOCAL_PTR -144
+000000388    129                   PUSH_LOCAL str -112
+000000389    129               REF_CNT_ASSIGN str
+000000390    129               PUSH_LOCAL_PTR -160
+000000391    129                  GET_MAP_PTR map[HeapSiteKey]HeapSite
+000000392    129               PUSH_LOCAL_PTR -136
+000000393    129               REF_CNT_ASSIGN HeapSite
+000000394    130                REF_CNT_LOCAL -- HeapSiteKey -160
+000000395    130                INC_LOCAL_INT -88
+000000396    130                         GOTO 372
+
+000000397    130                REF_CNT_LOCAL -- HeapSite -136
+000000398    130                REF_CNT_LOCAL -- []HeapSite -80
+000000399    132               PUSH_LOCAL_PTR 48
+000000400    132                          DUP
+000000401    132                 CALL_BUILTIN [] len
+000000402    132               PUSH_LOCAL_PTR -168
+000000403    132                  SWAP_ASSIGN int 8
+000000404    132          PUSH_LOCAL_PTR_ZERO -192 24
+000000405    132          SWAP_REF_CNT_ASSIGN []HeapSite
+000000406    132               PUSH_LOCAL_PTR -200
+000000407    132                         ZERO 8
+000000408    132               PUSH_LOCAL_PTR -248
+000000409    132                         ZERO 48
+
+000000410    132                   PUSH_LOCAL int -200
+000000411    132                   PUSH_LOCAL int -168
+000000412    139       GOTO_IF_GREATER_EQ_INT int 482
+000000413    132                   PUSH_LOCAL [] -192
+000000414    132                   PUSH_LOCAL int -200
+000000415    132                 GET_DYNARRAY struct
+000000416    132               PUSH_LOCAL_PTR -248
+000000417    132          SWAP_REF_CNT_ASSIGN HeapSite
+000000418    133          PUSH_LOCAL_PTR_ZERO -272 24
+000000419    133                   PUSH_LOCAL str -248
+000000420    133               REF_CNT_ASSIGN str
+000000421    133               PUSH_LOCAL_PTR -264
+000000422    133                   PUSH_LOCAL int -232
+000000423    133                       ASSIGN int 8
+000000424    133               PUSH_LOCAL_PTR -256
+000000425    133                   PUSH_LOCAL str -224
+000000426    133               REF_CNT_ASSIGN str
+000000427    133               PUSH_LOCAL_PTR -272
+000000428    133                      REF_CNT ++ HeapSiteKey
+000000429    133               PUSH_LOCAL_PTR -296
+000000430    133                  SWAP_ASSIGN struct 24
+000000431    134               PUSH_LOCAL_PTR -48
+000000432    134               PUSH_LOCAL_PTR -296
+000000433    134                 CALL_BUILTIN map validkey
+000000434    134                        UNARY ! bool
+000000435    136                  GOTO_IF_NOT 460
+
+000000436    135               PUSH_LOCAL_PTR -48
+000000437    135               PUSH_LOCAL_PTR -296
+000000438    135                  GET_MAP_PTR map[HeapSiteKey]HeapSite
+000000439    135          PUSH_LOCAL_PTR_ZERO -344 48
+000000440    135                   PUSH_LOCAL str -248
+000000441    135               REF_CNT_ASSIGN str
+000000442    135               PUSH_LOCAL_PTR -336
+000000443    135                   PUSH_LOCAL str -240
+000000444    135               REF_CNT_ASSIGN str
+000000445    135               PUSH_LOCAL_PTR -328
+000000446    135                   PUSH_LOCAL int -232
+000000447    135                       ASSIGN int 8
+000000448    135               PUSH_LOCAL_PTR -320
+000000449    135                   PUSH_LOCAL str -224
+000000450    135               REF_CNT_ASSIGN str
+000000451    135               PUSH_LOCAL_PTR -312
+000000452    135                         PUSH int 0
+000000453    135                       ASSIGN int 8
+000000454    135               PUSH_LOCAL_PTR -304
+000000455    135                         PUSH int 0
+000000456    135                       ASSIGN int 8
+000000457    135               PUSH_LOCAL_PTR -344
+000000458    135               REF_CNT_ASSIGN HeapSite
+000000459    136                REF_CNT_LOCAL -- HeapSite -344
+
+000000460    137               PUSH_LOCAL_PTR -48
+000000461    137               PUSH_LOCAL_PTR -296
+000000462    137                  GET_MAP_PTR map[HeapSiteKey]HeapSite
+000000463    137                GET_FIELD_PTR 32
+000000464    137                          DUP
+000000465    137                        DEREF int
+000000466    137                   PUSH_LOCAL int -216
+000000467    137                      SUB_INT int
+000000468    137                       ASSIGN int 8
+000000469    138               PUSH_LOCAL_PTR -48
+000000470    138               PUSH_LOCAL_PTR -296
+000000471    138                  GET_MAP_PTR map[HeapSiteKey]HeapSite
+000000472    138                GET_FIELD_PTR 40
+000000473    138                          DUP
+000000474    138                        DEREF int
+000000475    138                   PUSH_LOCAL int -208
+000000476    138                      SUB_INT int
+000000477    138                       ASSIGN int 8
+000000478    139                REF_CNT_LOCAL -- HeapSiteKey -296
+000000479    139                REF_CNT_LOCAL -- HeapSiteKey -272
+000000480    139                INC_LOCAL_INT -200
+000000481    139                         GOTO 410
+
+000000482    139                REF_CNT_LOCAL -- HeapSite -248
+000000483    139                REF_CNT_LOCAL -- []HeapSite -192
+000000484    141               PUSH_LOCAL_PTR -368
+000000485    141                         ZERO 24
+000000486    142               PUSH_LOCAL_PTR -48
+000000487    142                          DUP
+000000488    142                 CALL_BUILTIN map len
+000000489    142               PUSH_LOCAL_PTR -376
+000000490    142                  SWAP_ASSIGN int 8
+000000491    142          PUSH_LOCAL_PTR_ZERO -392 16
+000000492    142          SWAP_REF_CNT_ASSIGN map[HeapSiteKey]HeapSite
+000000493    142               PUSH_LOCAL_PTR -400
+000000494    142                         ZERO 8
+000000495    142               PUSH_LOCAL_PTR -424
+000000496    142                         ZERO 24
+000000497    142               PUSH_LOCAL_PTR -456
+000000498    142                         ZERO 32
+000000499    142               PUSH_LOCAL_PTR -392
+000000500    142               PUSH_LOCAL_PTR -488
+000000501    142                 CALL_BUILTIN struct mapiter
+000000502    142               PUSH_LOCAL_PTR -456
+000000503    142                  SWAP_ASSIGN struct 32
+000000504    142               PUSH_LOCAL_PTR -536
+000000505    142                         ZERO 48
+
+000000506    142               PUSH_LOCAL_PTR -456
+000000507    142               PUSH_LOCAL_PTR -400
+000000508    142               PUSH_LOCAL_PTR -392
+000000509    142                 CALL_BUILTIN struct mapnext
+000000510    146                  GOTO_IF_NOT 542
+
+000000511    142               PUSH_LOCAL_PTR -448
+000000512    142                   PUSH_LOCAL int -400
+000000513    142             GET_DYNARRAY_PTR
+000000514    142                    GET_FIELD struct 8
+000000515    142               PUSH_LOCAL_PTR -424
+000000516    142          SWAP_REF_CNT_ASSIGN HeapSiteKey
+000000517    142               PUSH_LOCAL_PTR -448
+000000518    142                   PUSH_LOCAL int -400
+000000519    142                 GET_DYNARRAY uint
+000000520    142                        DEREF struct
+000000521    142               PUSH_LOCAL_PTR -536
+000000522    142          SWAP_REF_CNT_ASSIGN HeapSite
+000000523    143                   PUSH_LOCAL int -504
+000000524    143                         PUSH int 0
+000000525    143                   NOT_EQ_INT int
+000000526    143                          DUP
+000000527    143                      GOTO_IF 532
+
+000000528    143                          POP 1
+000000529    143                   PUSH_LOCAL int -496
+000000530    143                         PUSH int 0
+000000531    143                   NOT_EQ_INT int
+
+000000532    145                  GOTO_IF_NOT 540
+
+000000533    144               PUSH_LOCAL_PTR -368
+000000534    144               PUSH_LOCAL_PTR -368
+000000535    144               PUSH_LOCAL_PTR -536
+000000536    144                         PUSH int 1
+000000537    144               PUSH_LOCAL_PTR -560
+000000538    144                 CALL_BUILTIN []HeapSite append
+000000539    144               REF_CNT_ASSIGN -- []HeapSite
+
+000000540    146                INC_LOCAL_INT -400
+000000541    146                         GOTO 506
+
+000000542    146                REF_CNT_LOCAL -- HeapSite -536
+000000543    146                REF_CNT_LOCAL -- struct -456
+000000544    146                REF_CNT_LOCAL -- HeapSiteKey -424
+000000545    146                REF_CNT_LOCAL -- map[HeapSiteKey]HeapSite -392
+000000546    148               PUSH_LOCAL_PTR -368
+000000547    148                         PUSH int 0
+000000548    148                         PUSH int 40
+000000549    148                 CALL_BUILTIN int sortfast
+000000550    149               PUSH_LOCAL_PTR -368
+000000551    149                   PUSH_LOCAL ^ 16
+000000552    149                  SWAP_ASSIGN [] 24
+000000553    149                   PUSH_LOCAL ^ 16
+000000554    149                      REF_CNT ++ []HeapSite
+000000555    149                      POP_REG RESULT
+000000556    149                REF_CNT_LOCAL -- []HeapSite -368
+000000557    149                REF_CNT_LOCAL -- map[HeapSiteKey]HeapSite -48
+000000558    149                REF_CNT_LOCAL -- map[HeapSiteKey]HeapSite -32
+000000559    150                         GOTO 563
+
+000000560    150                REF_CNT_LOCAL -- []HeapSite -368
+000000561    150                REF_CNT_LOCAL -- map[HeapSiteKey]HeapSite -48
+000000562    150                REF_CNT_LOCAL -- map[HeapSiteKey]HeapSite -32
+
+000000563    150                REF_CNT_LOCAL -- []HeapSite 24
+000000564    150                REF_CNT_LOCAL -- []HeapSite 48
+000000565    150                  LEAVE_FRAME
+000000566    150                       RETURN 9
+
+000000567    541                         GOTO 2629
+
+
+Function: stdin
+
+000000568    168                  ENTER_FRAME 0x558b193499e8
+000000569    167                    PUSH_ZERO 2
+000000570    167                         CALL rtlstdin (567)
+000000571    168                         GOTO 572
+
+000000572    168                  LEAVE_FRAME
+000000573    168                       RETURN 2
+
+000000574    541                         GOTO 2625
+
+
+Function: stdout
+
+000000575    174                  ENTER_FRAME 0x558b1934a088
+000000576    173                    PUSH_ZERO 2
+000000577    173                         CALL rtlstdout (574)
+000000578    174                         GOTO 579
+
+000000579    174                  LEAVE_FRAME
+000000580    174                       RETURN 2
+
+000000581    541                         GOTO 2621
+
+
+Function: stderr
+
+000000582    180                  ENTER_FRAME 0x558b1934a8a8
+000000583    179                    PUSH_ZERO 2
+000000584    179                         CALL rtlstderr (581)
+000000585    180                         GOTO 586
+
+000000586    180                  LEAVE_FRAME
+000000587    180                       RETURN 2
+
+000000588    541                         GOTO 2615
+
+
+Function: fopen
+
+000000589    199                  ENTER_FRAME 0x558b1934ca98
+000000590    192                         PUSH ^ fopenModes
+000000591    192                         PUSH int 15
+000000592    192               PUSH_LOCAL_PTR -24
+000000593    192                  SWAP_ASSIGN int 8
+000000594    192          PUSH_LOCAL_PTR_ZERO -32 8
+000000595    192          SWAP_REF_CNT_ASSIGN ^[15]str
+000000596    192               PUSH_LOCAL_PTR -40
+000000597    192                         ZERO 8
+000000598    192               PUSH_LOCAL_PTR -48
+000000599    192                         ZERO 8
+
+000000600    192                   PUSH_LOCAL int -40
+000000601    192                   PUSH_LOCAL int -24
+000000602    197       GOTO_IF_GREATER_EQ_INT int 676
+000000603    192                   PUSH_LOCAL ^ -32
+000000604    192                   PUSH_LOCAL int -40
+000000605    192                    GET_ARRAY str 8 15
+000000606    192               PUSH_LOCAL_PTR -48
+000000607    192          SWAP_REF_CNT_ASSIGN str
+000000608    193                   PUSH_LOCAL str 24
+000000609    193                   PUSH_LOCAL str -48
+000000610    193                       BINARY == str
+000000611    196                  GOTO_IF_NOT 674
+
+000000612    194                    PUSH_ZERO 2
+000000613    194                   PUSH_LOCAL str 32
+000000614    194                      REF_CNT ++ str
+000000615    194                   PUSH_LOCAL str 24
+000000616    194                      REF_CNT ++ str
+000000617    194                         CALL rtlfopen (588)
+000000618    194                     PUSH_REG RESULT
+000000619    194               PUSH_LOCAL_PTR -64
+000000620    194                  SWAP_ASSIGN ^ 8
+000000621    195                   PUSH_LOCAL ^ -64
+000000622    195                   PUSH_LOCAL ^ -64
+000000623    195                         PUSH ^ (nil)
+000000624    195                       BINARY != File
+000000625    195                  GOTO_IF_NOT 640
+
+000000626    195                    PUSH_ZERO 2
+000000627    195                         PUSH int 0
+000000628    195          PUSH_LOCAL_PTR_ZERO -120 56
+000000629    195                         CALL stderror (67)
+000000630    195                     PUSH_REG RESULT
+000000631    195                          DUP
+000000632    195               PUSH_LOCAL_PTR -176
+000000633    195                  SWAP_ASSIGN struct 56
+000000634    195                          DUP
+000000635    195                      REF_CNT ++ Err
+000000636    195               PUSH_LOCAL_PTR -232
+000000637    195                  SWAP_ASSIGN struct 56
+000000638    195                REF_CNT_LOCAL -- Err -176
+000000639    195                         GOTO 653
+
+000000640    195                    PUSH_ZERO 2
+000000641    195                         PUSH int 4
+000000642    195          PUSH_LOCAL_PTR_ZERO -288 56
+000000643    195                         CALL stderror (67)
+000000644    195                     PUSH_REG RESULT
+000000645    195                          DUP
+000000646    195               PUSH_LOCAL_PTR -344
+000000647    195                  SWAP_ASSIGN struct 56
+000000648    195                          DUP
+000000649    195                      REF_CNT ++ Err
+000000650    195               PUSH_LOCAL_PTR -232
+000000651    195                  SWAP_ASSIGN struct 56
+000000652    195                REF_CNT_LOCAL -- Err -344
+
+000000653    195               PUSH_LOCAL_PTR -408
+000000654    195                         ZERO 64
+000000655    195               PUSH_LOCAL_PTR -400
+000000656    195          SWAP_REF_CNT_ASSIGN Err
+000000657    195               PUSH_LOCAL_PTR -408
+000000658    195          SWAP_REF_CNT_ASSIGN File
+000000659    195               PUSH_LOCAL_PTR -408
+000000660    195                   PUSH_LOCAL ^ 16
+000000661    195                  SWAP_ASSIGN struct 64
+000000662    195                   PUSH_LOCAL ^ 16
+000000663    195                      REF_CNT ++ { File Err }
+000000664    195                      POP_REG RESULT
+000000665    195                REF_CNT_LOCAL -- { File Err } -408
+000000666    195                REF_CNT_LOCAL -- Err -232
+000000667    195                REF_CNT_LOCAL -- File -64
+000000668    195                REF_CNT_LOCAL -- str -48
+000000669    195                REF_CNT_LOCAL -- ^[15]str -32
+000000670    199                         GOTO 704
+
+000000671    196                REF_CNT_LOCAL -- { File Err } -408
+000000672    196                REF_CNT_LOCAL -- Err -232
+000000673    196                REF_CNT_LOCAL -- File -64
+
+000000674    197                INC_LOCAL_INT -40
+000000675    197                         GOTO 600
+
+000000676    197                REF_CNT_LOCAL -- str -48
+000000677    197                REF_CNT_LOCAL -- ^[15]str -32
+000000678    198                         PUSH ^ (nil)
+000000679    198                    PUSH_ZERO 2
+000000680    198                         PUSH int 4
+000000681    198          PUSH_LOCAL_PTR_ZERO -464 56
+000000682    198                         CALL stderror (67)
+000000683    198                     PUSH_REG RESULT
+000000684    198                          DUP
+000000685    198               PUSH_LOCAL_PTR -520
+000000686    198                  SWAP_ASSIGN struct 56
+000000687    198               PUSH_LOCAL_PTR -584
+000000688    198                         ZERO 64
+000000689    198               PUSH_LOCAL_PTR -576
+000000690    198          SWAP_REF_CNT_ASSIGN Err
+000000691    198               PUSH_LOCAL_PTR -584
+000000692    198          SWAP_REF_CNT_ASSIGN File
+000000693    198               PUSH_LOCAL_PTR -584
+000000694    198                   PUSH_LOCAL ^ 16
+000000695    198                  SWAP_ASSIGN struct 64
+000000696    198                   PUSH_LOCAL ^ 16
+000000697    198                      REF_CNT ++ { File Err }
+000000698    198                      POP_REG RESULT
+000000699    198                REF_CNT_LOCAL -- { File Err } -584
+000000700    198                REF_CNT_LOCAL -- Err -520
+000000701    199                         GOTO 704
+
+000000702    199                REF_CNT_LOCAL -- { File Err } -584
+000000703    199                REF_CNT_LOCAL -- Err -520
+
+000000704    199                REF_CNT_LOCAL -- str 24
+000000705    199                REF_CNT_LOCAL -- str 32
+000000706    199                  LEAVE_FRAME
+000000707    199                       RETURN 5
+
+000000708    541                         GOTO 2610
+
+
+Function: fclose
+
+000000709    208                  ENTER_FRAME 0x558b1934e1e8
+000000710    204                   PUSH_LOCAL ^ 24
+000000711    204                         PUSH ^ (nil)
+000000712    204                       BINARY == File
+000000713    206                  GOTO_IF_NOT 730
+
+000000714    205                    PUSH_ZERO 2
+000000715    205                         PUSH int 4
+000000716    205          PUSH_LOCAL_PTR_ZERO -72 56
+000000717    205                         CALL stderror (67)
+000000718    205                     PUSH_REG RESULT
+000000719    205                          DUP
+000000720    205               PUSH_LOCAL_PTR -128
+000000721    205                  SWAP_ASSIGN struct 56
+000000722    205                   PUSH_LOCAL ^ 16
+000000723    205                  SWAP_ASSIGN struct 56
+000000724    205                   PUSH_LOCAL ^ 16
+000000725    205                      REF_CNT ++ Err
+000000726    205                      POP_REG RESULT
+000000727    205                REF_CNT_LOCAL -- Err -128
+000000728    208                         GOTO 772
+
+000000729    206                REF_CNT_LOCAL -- Err -128
+
+000000730    207                    PUSH_ZERO 2
+000000731    207                   PUSH_LOCAL ^ 24
+000000732    207                      REF_CNT ++ File
+000000733    207                         CALL rtlfclose (708)
+000000734    207                     PUSH_REG RESULT
+000000735    207                         PUSH int 0
+000000736    207           GOTO_IF_NOT_EQ_INT int 751
+000000737    207                    PUSH_ZERO 2
+000000738    207                         PUSH int 0
+000000739    207          PUSH_LOCAL_PTR_ZERO -184 56
+000000740    207                         CALL stderror (67)
+000000741    207                     PUSH_REG RESULT
+000000742    207                          DUP
+000000743    207               PUSH_LOCAL_PTR -240
+000000744    207                  SWAP_ASSIGN struct 56
+000000745    207                          DUP
+000000746    207                      REF_CNT ++ Err
+000000747    207               PUSH_LOCAL_PTR -296
+000000748    207                  SWAP_ASSIGN struct 56
+000000749    207                REF_CNT_LOCAL -- Err -240
+000000750    207                         GOTO 764
+
+000000751    207                    PUSH_ZERO 2
+000000752    207                         PUSH int 5
+000000753    207          PUSH_LOCAL_PTR_ZERO -352 56
+000000754    207                         CALL stderror (67)
+000000755    207                     PUSH_REG RESULT
+000000756    207                          DUP
+000000757    207               PUSH_LOCAL_PTR -408
+000000758    207                  SWAP_ASSIGN struct 56
+000000759    207                          DUP
+000000760    207                      REF_CNT ++ Err
+000000761    207               PUSH_LOCAL_PTR -296
+000000762    207                  SWAP_ASSIGN struct 56
+000000763    207                REF_CNT_LOCAL -- Err -408
+
+000000764    207                   PUSH_LOCAL ^ 16
+000000765    207                  SWAP_ASSIGN struct 56
+000000766    207                   PUSH_LOCAL ^ 16
+000000767    207                      REF_CNT ++ Err
+000000768    207                      POP_REG RESULT
+000000769    207                REF_CNT_LOCAL -- Err -296
+000000770    208                         GOTO 772
+
+000000771    208                REF_CNT_LOCAL -- Err -296
+
+000000772    208                REF_CNT_LOCAL -- File 24
+000000773    208                  LEAVE_FRAME
+000000774    208                       RETURN 4
+
+000000775    541                         GOTO 2605
+
+
+Function: fseek
+
+000000776    217                  ENTER_FRAME 0x558b1934f7a8
+000000777    213                   PUSH_LOCAL ^ 40
+000000778    213                         PUSH ^ (nil)
+000000779    213                       BINARY == File
+000000780    215                  GOTO_IF_NOT 797
+
+000000781    214                    PUSH_ZERO 2
+000000782    214                         PUSH int 4
+000000783    214          PUSH_LOCAL_PTR_ZERO -72 56
+000000784    214                         CALL stderror (67)
+000000785    214                     PUSH_REG RESULT
+000000786    214                          DUP
+000000787    214               PUSH_LOCAL_PTR -128
+000000788    214                  SWAP_ASSIGN struct 56
+000000789    214                   PUSH_LOCAL ^ 16
+000000790    214                  SWAP_ASSIGN struct 56
+000000791    214                   PUSH_LOCAL ^ 16
+000000792    214                      REF_CNT ++ Err
+000000793    214                      POP_REG RESULT
+000000794    214                REF_CNT_LOCAL -- Err -128
+000000795    217                         GOTO 841
+
+000000796    215                REF_CNT_LOCAL -- Err -128
+
+000000797    216                    PUSH_ZERO 2
+000000798    216                   PUSH_LOCAL ^ 40
+000000799    216                      REF_CNT ++ File
+000000800    216                   PUSH_LOCAL int 32
+000000801    216                   PUSH_LOCAL int 24
+000000802    216                         CALL rtlfseek (775)
+000000803    216                     PUSH_REG RESULT
+000000804    216                         PUSH int 0
+000000805    216           GOTO_IF_NOT_EQ_INT int 820
+000000806    216                    PUSH_ZERO 2
+000000807    216                         PUSH int 0
+000000808    216          PUSH_LOCAL_PTR_ZERO -184 56
+000000809    216                         CALL stderror (67)
+000000810    216                     PUSH_REG RESULT
+000000811    216                          DUP
+000000812    216               PUSH_LOCAL_PTR -240
+000000813    216                  SWAP_ASSIGN struct 56
+000000814    216                          DUP
+000000815    216                      REF_CNT ++ Err
+000000816    216               PUSH_LOCAL_PTR -296
+000000817    216                  SWAP_ASSIGN struct 56
+000000818    216                REF_CNT_LOCAL -- Err -240
+000000819    216                         GOTO 833
+
+000000820    216                    PUSH_ZERO 2
+000000821    216                         PUSH int 5
+000000822    216          PUSH_LOCAL_PTR_ZERO -352 56
+000000823    216                         CALL stderror (67)
+000000824    216                     PUSH_REG RESULT
+000000825    216                          DUP
+000000826    216               PUSH_LOCAL_PTR -408
+000000827    216                  SWAP_ASSIGN struct 56
+000000828    216                          DUP
+000000829    216                      REF_CNT ++ Err
+000000830    216               PUSH_LOCAL_PTR -296
+000000831    216                  SWAP_ASSIGN struct 56
+000000832    216                REF_CNT_LOCAL -- Err -408
+
+000000833    216                   PUSH_LOCAL ^ 16
+000000834    216                  SWAP_ASSIGN struct 56
+000000835    216                   PUSH_LOCAL ^ 16
+000000836    216                      REF_CNT ++ Err
+000000837    216                      POP_REG RESULT
+000000838    216                REF_CNT_LOCAL -- Err -296
+000000839    217                         GOTO 841
+
+000000840    217                REF_CNT_LOCAL -- Err -296
+
+000000841    217                REF_CNT_LOCAL -- File 40
+000000842    217                  LEAVE_FRAME
+000000843    217                       RETURN 6
+
+000000844    541                         GOTO 2600
+
+
+Function: ftell
+
+000000845    227                  ENTER_FRAME 0x558b19350d18
+000000846    222                   PUSH_LOCAL ^ 24
+000000847    222                         PUSH ^ (nil)
+000000848    222                       BINARY == File
+000000849    224                  GOTO_IF_NOT 876
+
+000000850    223                         PUSH int 0
+000000851    223                    PUSH_ZERO 2
+000000852    223                         PUSH int 4
+000000853    223          PUSH_LOCAL_PTR_ZERO -72 56
+000000854    223                         CALL stderror (67)
+000000855    223                     PUSH_REG RESULT
+000000856    223                          DUP
+000000857    223               PUSH_LOCAL_PTR -128
+000000858    223                  SWAP_ASSIGN struct 56
+000000859    223               PUSH_LOCAL_PTR -192
+000000860    223                         ZERO 64
+000000861    223               PUSH_LOCAL_PTR -184
+000000862    223          SWAP_REF_CNT_ASSIGN Err
+000000863    223               PUSH_LOCAL_PTR -192
+000000864    223                  SWAP_ASSIGN int 8
+000000865    223               PUSH_LOCAL_PTR -192
+000000866    223                   PUSH_LOCAL ^ 16
+000000867    223                  SWAP_ASSIGN struct 64
+000000868    223                   PUSH_LOCAL ^ 16
+000000869    223                      REF_CNT ++ { int Err }
+000000870    223                      POP_REG RESULT
+000000871    223                REF_CNT_LOCAL -- { int Err } -192
+000000872    223                REF_CNT_LOCAL -- Err -128
+000000873    227                         GOTO 931
+
+000000874    224                REF_CNT_LOCAL -- { int Err } -192
+000000875    224                REF_CNT_LOCAL -- Err -128
+
+000000876    225                    PUSH_ZERO 2
+000000877    225                   PUSH_LOCAL ^ 24
+000000878    225                      REF_CNT ++ File
+000000879    225                         CALL rtlftell (844)
+000000880    225                     PUSH_REG RESULT
+000000881    225               PUSH_LOCAL_PTR -200
+000000882    225                  SWAP_ASSIGN int 8
+000000883    226                   PUSH_LOCAL int -200
+000000884    226                   PUSH_LOCAL int -200
+000000885    226                         PUSH int 0
+000000886    226             GOTO_IF_LESS_INT int 901
+000000887    226                    PUSH_ZERO 2
+000000888    226                         PUSH int 0
+000000889    226          PUSH_LOCAL_PTR_ZERO -256 56
+000000890    226                         CALL stderror (67)
+000000891    226                     PUSH_REG RESULT
+000000892    226                          DUP
+000000893    226               PUSH_LOCAL_PTR -312
+000000894    226                  SWAP_ASSIGN struct 56
+000000895    226                          DUP
+000000896    226                      REF_CNT ++ Err
+000000897    226               PUSH_LOCAL_PTR -368
+000000898    226                  SWAP_ASSIGN struct 56
+000000899    226                REF_CNT_LOCAL -- Err -312
+000000900    226                         GOTO 914
+
+000000901    226                    PUSH_ZERO 2
+000000902    226                         PUSH int 5
+000000903    226          PUSH_LOCAL_PTR_ZERO -424 56
+000000904    226                         CALL stderror (67)
+000000905    226                     PUSH_REG RESULT
+000000906    226                          DUP
+000000907    226               PUSH_LOCAL_PTR -480
+000000908    226                  SWAP_ASSIGN struct 56
+000000909    226                          DUP
+000000910    226                      REF_CNT ++ Err
+000000911    226               PUSH_LOCAL_PTR -368
+000000912    226                  SWAP_ASSIGN struct 56
+000000913    226                REF_CNT_LOCAL -- Err -480
+
+000000914    226               PUSH_LOCAL_PTR -544
+000000915    226                         ZERO 64
+000000916    226               PUSH_LOCAL_PTR -536
+000000917    226          SWAP_REF_CNT_ASSIGN Err
+000000918    226               PUSH_LOCAL_PTR -544
+000000919    226                  SWAP_ASSIGN int 8
+000000920    226               PUSH_LOCAL_PTR -544
+000000921    226                   PUSH_LOCAL ^ 16
+000000922    226                  SWAP_ASSIGN struct 64
+000000923    226                   PUSH_LOCAL ^ 16
+000000924    226                      REF_CNT ++ { int Err }
+000000925    226                      POP_REG RESULT
+000000926    226                REF_CNT_LOCAL -- { int Err } -544
+000000927    226                REF_CNT_LOCAL -- Err -368
+000000928    227                         GOTO 931
+
+000000929    227                REF_CNT_LOCAL -- { int Err } -544
+000000930    227                REF_CNT_LOCAL -- Err -368
+
+000000931    227                REF_CNT_LOCAL -- File 24
+000000932    227                  LEAVE_FRAME
+000000933    227                       RETURN 4
+
+000000934    541                         GOTO 2595
+
+
+Function: remove
+
+000000935    233                  ENTER_FRAME 0x558b19351848
+000000936    232                    PUSH_ZERO 2
+000000937    232                   PUSH_LOCAL str 24
+000000938    232                      REF_CNT ++ str
+000000939    232                         CALL rtlremove (934)
+000000940    232                     PUSH_REG RESULT
+000000941    232                         PUSH int 0
+000000942    232           GOTO_IF_NOT_EQ_INT int 957
+000000943    232                    PUSH_ZERO 2
+000000944    232                         PUSH int 0
+000000945    232          PUSH_LOCAL_PTR_ZERO -72 56
+000000946    232                         CALL stderror (67)
+000000947    232                     PUSH_REG RESULT
+000000948    232                          DUP
+000000949    232               PUSH_LOCAL_PTR -128
+000000950    232                  SWAP_ASSIGN struct 56
+000000951    232                          DUP
+000000952    232                      REF_CNT ++ Err
+000000953    232               PUSH_LOCAL_PTR -184
+000000954    232                  SWAP_ASSIGN struct 56
+000000955    232                REF_CNT_LOCAL -- Err -128
+000000956    232                         GOTO 970
+
+000000957    232                    PUSH_ZERO 2
+000000958    232                         PUSH int 5
+000000959    232          PUSH_LOCAL_PTR_ZERO -240 56
+000000960    232                         CALL stderror (67)
+000000961    232                     PUSH_REG RESULT
+000000962    232                          DUP
+000000963    232               PUSH_LOCAL_PTR -296
+000000964    232                  SWAP_ASSIGN struct 56
+000000965    232                          DUP
+000000966    232                      REF_CNT ++ Err
+000000967    232               PUSH_LOCAL_PTR -184
+000000968    232                  SWAP_ASSIGN struct 56
+000000969    232                REF_CNT_LOCAL -- Err -296
+
+000000970    232                   PUSH_LOCAL ^ 16
+000000971    232                  SWAP_ASSIGN struct 56
+000000972    232                   PUSH_LOCAL ^ 16
+000000973    232                      REF_CNT ++ Err
+000000974    232                      POP_REG RESULT
+000000975    232                REF_CNT_LOCAL -- Err -184
+000000976    233                         GOTO 978
+
+000000977    233                REF_CNT_LOCAL -- Err -184
+
+000000978    233                REF_CNT_LOCAL -- str 24
+000000979    233                  LEAVE_FRAME
+000000980    233                       RETURN 4
+
+000000981    541                         GOTO 2590
+
+
+Function: feof
+
+000000982    242                  ENTER_FRAME 0x558b193520c8
+000000983    238                   PUSH_LOCAL ^ 16
+000000984    238                         PUSH ^ (nil)
+000000985    238                       BINARY == File
+000000986    240                  GOTO_IF_NOT 990
+
+000000987    239                         PUSH int 1
+000000988    239                      POP_REG RESULT
+000000989    242                         GOTO 999
+
+000000990    241                    PUSH_ZERO 2
+000000991    241                   PUSH_LOCAL ^ 16
+000000992    241                      REF_CNT ++ File
+000000993    241                         CALL rtlfeof (981)
+000000994    241                     PUSH_REG RESULT
+000000995    241                         PUSH int 0
+000000996    241                   NOT_EQ_INT int
+000000997    241                      POP_REG RESULT
+000000998    242                         GOTO 999
+
+000000999    242                REF_CNT_LOCAL -- File 16
+000001000    242                  LEAVE_FRAME
+000001001    242                       RETURN 3
+
+000001002    541                         GOTO 2585
+
+
+Function: fflush
+
+000001003    251                  ENTER_FRAME 0x558b19310b78
+000001004    247                   PUSH_LOCAL ^ 24
+000001005    247                         PUSH ^ (nil)
+000001006    247                       BINARY == File
+000001007    249                  GOTO_IF_NOT 1024
+
+000001008    248                    PUSH_ZERO 2
+000001009    248                         PUSH int 4
+000001010    248          PUSH_LOCAL_PTR_ZERO -72 56
+000001011    248                         CALL stderror (67)
+000001012    248                     PUSH_REG RESULT
+000001013    248                          DUP
+000001014    248               PUSH_LOCAL_PTR -128
+000001015    248                  SWAP_ASSIGN struct 56
+000001016    248                   PUSH_LOCAL ^ 16
+000001017    248                  SWAP_ASSIGN struct 56
+000001018    248                   PUSH_LOCAL ^ 16
+000001019    248                      REF_CNT ++ Err
+000001020    248                      POP_REG RESULT
+000001021    248                REF_CNT_LOCAL -- Err -128
+000001022    251                         GOTO 1066
+
+000001023    249                REF_CNT_LOCAL -- Err -128
+
+000001024    250                    PUSH_ZERO 2
+000001025    250                   PUSH_LOCAL ^ 24
+000001026    250                      REF_CNT ++ File
+000001027    250                         CALL rtlfflush (1002)
+000001028    250                     PUSH_REG RESULT
+000001029    250                         PUSH int 0
+000001030    250           GOTO_IF_NOT_EQ_INT int 1045
+000001031    250                    PUSH_ZERO 2
+000001032    250                         PUSH int 0
+000001033    250          PUSH_LOCAL_PTR_ZERO -184 56
+000001034    250                         CALL stderror (67)
+000001035    250                     PUSH_REG RESULT
+000001036    250                          DUP
+000001037    250               PUSH_LOCAL_PTR -240
+000001038    250                  SWAP_ASSIGN struct 56
+000001039    250                          DUP
+000001040    250                      REF_CNT ++ Err
+000001041    250               PUSH_LOCAL_PTR -296
+000001042    250                  SWAP_ASSIGN struct 56
+000001043    250                REF_CNT_LOCAL -- Err -240
+000001044    250                         GOTO 1058
+
+000001045    250                    PUSH_ZERO 2
+000001046    250                         PUSH int 5
+000001047    250          PUSH_LOCAL_PTR_ZERO -352 56
+000001048    250                         CALL stderror (67)
+000001049    250                     PUSH_REG RESULT
+000001050    250                          DUP
+000001051    250               PUSH_LOCAL_PTR -408
+000001052    250                  SWAP_ASSIGN struct 56
+000001053    250                          DUP
+000001054    250                      REF_CNT ++ Err
+000001055    250               PUSH_LOCAL_PTR -296
+000001056    250                  SWAP_ASSIGN struct 56
+000001057    250                REF_CNT_LOCAL -- Err -408
+
+000001058    250                   PUSH_LOCAL ^ 16
+000001059    250                  SWAP_ASSIGN struct 56
+000001060    250                   PUSH_LOCAL ^ 16
+000001061    250                      REF_CNT ++ Err
+000001062    250                      POP_REG RESULT
+000001063    250                REF_CNT_LOCAL -- Err -296
+000001064    251                         GOTO 1066
+
+000001065    251                REF_CNT_LOCAL -- Err -296
+
+000001066    251                REF_CNT_LOCAL -- File 24
+000001067    251                  LEAVE_FRAME
+000001068    251                       RETURN 4
+
+000001069    541                         GOTO 2579
+
+000001070    541                         GOTO 2573
+
+
+Function: rawbuf
+
+000001071    270                  ENTER_FRAME 0x558b19314ad8
+000001072    257               PUSH_LOCAL_PTR -24
+000001073    257                         ZERO 8
+000001074    258               PUSH_LOCAL_PTR -32
+000001075    258                         ZERO 8
+000001076    259               PUSH_LOCAL_PTR 24
+000001077    260                          DUP
+000001078    260                  ASSERT_TYPE ^[]int8
+000001079    260                          DUP
+000001080    260                         PUSH ^ (nil)
+000001081    260                       BINARY != ^[]int8
+000001082    261                  GOTO_IF_NOT 1100
+
+000001083    260          PUSH_LOCAL_PTR_ZERO -40 8
+000001084    260          SWAP_REF_CNT_ASSIGN ^[]int8
+000001085    260               PUSH_LOCAL_PTR -32
+000001086    260                   PUSH_LOCAL ^ -40
+000001087    260                        DEREF []
+000001088    260                 CALL_BUILTIN [] len
+000001089    260                       ASSIGN int 8
+000001090    260                   PUSH_LOCAL int -32
+000001091    260                         PUSH int 0
+000001092    260          GOTO_IF_LESS_EQ_INT int 1098
+000001093    260               PUSH_LOCAL_PTR -24
+000001094    260                   PUSH_LOCAL ^ -40
+000001095    260                         PUSH int 0
+000001096    260             GET_DYNARRAY_PTR
+000001097    260               REF_CNT_ASSIGN ^void
+000001098    261                REF_CNT_LOCAL -- ^[]int8 -40
+000001099    268                         GOTO 1207
+
+000001100    261                          POP 1
+000001101    261                          DUP
+000001102    261                  ASSERT_TYPE ^[]uint8
+000001103    261                          DUP
+000001104    261                         PUSH ^ (nil)
+000001105    261                       BINARY != ^[]uint8
+000001106    262                  GOTO_IF_NOT 1124
+
+000001107    261          PUSH_LOCAL_PTR_ZERO -48 8
+000001108    261          SWAP_REF_CNT_ASSIGN ^[]uint8
+000001109    261               PUSH_LOCAL_PTR -32
+000001110    261                   PUSH_LOCAL ^ -48
+000001111    261                        DEREF []
+000001112    261                 CALL_BUILTIN [] len
+000001113    261                       ASSIGN int 8
+000001114    261                   PUSH_LOCAL int -32
+000001115    261                         PUSH int 0
+000001116    261          GOTO_IF_LESS_EQ_INT int 1122
+000001117    261               PUSH_LOCAL_PTR -24
+000001118    261                   PUSH_LOCAL ^ -48
+000001119    261                         PUSH int 0
+000001120    261             GET_DYNARRAY_PTR
+000001121    261               REF_CNT_ASSIGN ^void
+000001122    262                REF_CNT_LOCAL -- ^[]uint8 -48
+000001123    268                         GOTO 1207
+
+000001124    262                          POP 1
+000001125    262                          DUP
+000001126    262                  ASSERT_TYPE ^[]char
+000001127    262                          DUP
+000001128    262                         PUSH ^ (nil)
+000001129    262                       BINARY != ^[]char
+000001130    263                  GOTO_IF_NOT 1148
+
+000001131    262          PUSH_LOCAL_PTR_ZERO -56 8
+000001132    262          SWAP_REF_CNT_ASSIGN ^[]char
+000001133    262               PUSH_LOCAL_PTR -32
+000001134    262                   PUSH_LOCAL ^ -56
+000001135    262                        DEREF []
+000001136    262                 CALL_BUILTIN [] len
+000001137    262                       ASSIGN int 8
+000001138    262                   PUSH_LOCAL int -32
+000001139    262                         PUSH int 0
+000001140    262          GOTO_IF_LESS_EQ_INT int 1146
+000001141    262               PUSH_LOCAL_PTR -24
+000001142    262                   PUSH_LOCAL ^ -56
+000001143    262                         PUSH int 0
+000001144    262             GET_DYNARRAY_PTR
+000001145    262               REF_CNT_ASSIGN ^void
+000001146    263                REF_CNT_LOCAL -- ^[]char -56
+000001147    268                         GOTO 1207
+
+000001148    263                          POP 1
+000001149    264               PUSH_LOCAL_PTR 24
+000001150    264                 CALL_BUILTIN interface selfhasptr
+000001151    266                  GOTO_IF_NOT 1182
+
+000001152    265                         PUSH ^ (nil)
+000001153    265                         PUSH int 0
+000001154    265                    PUSH_ZERO 2
+000001155    265                         PUSH int 3
+000001156    265          PUSH_LOCAL_PTR_ZERO -112 56
+000001157    265                         CALL stderror (67)
+000001158    265                     PUSH_REG RESULT
+000001159    265                          DUP
+000001160    265               PUSH_LOCAL_PTR -168
+000001161    265                  SWAP_ASSIGN struct 56
+000001162    265               PUSH_LOCAL_PTR -240
+000001163    265                         ZERO 72
+000001164    265               PUSH_LOCAL_PTR -224
+000001165    265          SWAP_REF_CNT_ASSIGN Err
+000001166    265               PUSH_LOCAL_PTR -232
+000001167    265                  SWAP_ASSIGN int 8
+000001168    265               PUSH_LOCAL_PTR -240
+000001169    265          SWAP_REF_CNT_ASSIGN ^void
+000001170    265               PUSH_LOCAL_PTR -240
+000001171    265                   PUSH_LOCAL ^ 16
+000001172    265                  SWAP_ASSIGN struct 72
+000001173    265                   PUSH_LOCAL ^ 16
+000001174    265                      REF_CNT ++ { ^void int Err }
+000001175    265                      POP_REG RESULT
+000001176    265                REF_CNT_LOCAL -- { ^void int Err } -240
+000001177    265                REF_CNT_LOCAL -- Err -168
+000001178    265                REF_CNT_LOCAL -- ^void -24
+000001179    270                         GOTO 1239
+
+000001180    266                REF_CNT_LOCAL -- { ^void int Err } -240
+000001181    266                REF_CNT_LOCAL -- Err -168
+
+000001182    267               PUSH_LOCAL_PTR -32
+000001183    267               PUSH_LOCAL_PTR -24
+000001184    267               PUSH_LOCAL_PTR 24
+000001185    267                 CALL_BUILTIN interface sizeofself
+000001186    267               PUSH_LOCAL_PTR 24
+000001187    267                 CALL_BUILTIN interface selfptr
+000001188    267               PUSH_LOCAL_PTR -256
+000001189    267                         ZERO 16
+000001190    267               PUSH_LOCAL_PTR -248
+000001191    267          SWAP_REF_CNT_ASSIGN ^void
+000001192    267               PUSH_LOCAL_PTR -256
+000001193    267                  SWAP_ASSIGN int 8
+000001194    267               PUSH_LOCAL_PTR -256
+000001195    267                          DUP
+000001196    267                      POP_REG EXPR_LIST
+000001197    267                    GET_FIELD ^ 8
+000001198    267               REF_CNT_ASSIGN ^void
+000001199    267                     PUSH_REG EXPR_LIST
+000001200    267                          DUP
+000001201    267                      POP_REG EXPR_LIST
+000001202    267                        DEREF int
+000001203    267                       ASSIGN int 8
+000001204    267                     PUSH_REG EXPR_LIST
+000001205    267                          POP 1
+000001206    268                REF_CNT_LOCAL -- { int ^void } -256
+
+000001207    268                          POP 1
+000001208    269                   PUSH_LOCAL ^ -24
+000001209    269                   PUSH_LOCAL int -32
+000001210    269                    PUSH_ZERO 2
+000001211    269                         PUSH int 0
+000001212    269          PUSH_LOCAL_PTR_ZERO -312 56
+000001213    269                         CALL stderror (67)
+000001214    269                     PUSH_REG RESULT
+000001215    269                          DUP
+000001216    269               PUSH_LOCAL_PTR -368
+000001217    269                  SWAP_ASSIGN struct 56
+000001218    269               PUSH_LOCAL_PTR -440
+000001219    269                         ZERO 72
+000001220    269               PUSH_LOCAL_PTR -424
+000001221    269          SWAP_REF_CNT_ASSIGN Err
+000001222    269               PUSH_LOCAL_PTR -432
+000001223    269                  SWAP_ASSIGN int 8
+000001224    269               PUSH_LOCAL_PTR -440
+000001225    269          SWAP_REF_CNT_ASSIGN ^void
+000001226    269               PUSH_LOCAL_PTR -440
+000001227    269                   PUSH_LOCAL ^ 16
+000001228    269                  SWAP_ASSIGN struct 72
+000001229    269                   PUSH_LOCAL ^ 16
+000001230    269                      REF_CNT ++ { ^void int Err }
+000001231    269                      POP_REG RESULT
+000001232    269                REF_CNT_LOCAL -- { ^void int Err } -440
+000001233    269                REF_CNT_LOCAL -- Err -368
+000001234    269                REF_CNT_LOCAL -- ^void -24
+000001235    270                         GOTO 1239
+
+000001236    270                REF_CNT_LOCAL -- { ^void int Err } -440
+000001237    270                REF_CNT_LOCAL -- Err -368
+000001238    270                REF_CNT_LOCAL -- ^void -24
+
+000001239    270                REF_CNT_LOCAL -- interface 24
+000001240    270                  LEAVE_FRAME
+000001241    270                       RETURN 5
+
+
+Function: freadwrite
+
+000001242    285                  ENTER_FRAME 0x558b19312b38
+000001243    273                   PUSH_LOCAL ^ 48
+000001244    273                         PUSH ^ (nil)
+000001245    273                       BINARY == File
+000001246    275                  GOTO_IF_NOT 1273
+
+000001247    274                         PUSH int 0
+000001248    274                    PUSH_ZERO 2
+000001249    274                         PUSH int 4
+000001250    274          PUSH_LOCAL_PTR_ZERO -72 56
+000001251    274                         CALL stderror (67)
+000001252    274                     PUSH_REG RESULT
+000001253    274                          DUP
+000001254    274               PUSH_LOCAL_PTR -128
+000001255    274                  SWAP_ASSIGN struct 56
+000001256    274               PUSH_LOCAL_PTR -192
+000001257    274                         ZERO 64
+000001258    274               PUSH_LOCAL_PTR -184
+000001259    274          SWAP_REF_CNT_ASSIGN Err
+000001260    274               PUSH_LOCAL_PTR -192
+000001261    274                  SWAP_ASSIGN int 8
+000001262    274               PUSH_LOCAL_PTR -192
+000001263    274                   PUSH_LOCAL ^ 16
+000001264    274                  SWAP_ASSIGN struct 64
+000001265    274                   PUSH_LOCAL ^ 16
+000001266    274                      REF_CNT ++ { int Err }
+000001267    274                      POP_REG RESULT
+000001268    274                REF_CNT_LOCAL -- { int Err } -192
+000001269    274                REF_CNT_LOCAL -- Err -128
+000001270    285                         GOTO 1437
+
+000001271    275                REF_CNT_LOCAL -- { int Err } -192
+000001272    275                REF_CNT_LOCAL -- Err -128
+
+000001273    276                    PUSH_ZERO 2
+000001274    276               PUSH_LOCAL_PTR 32
+000001275    276                      REF_CNT ++ interface
+000001276    276                 ASSIGN_PARAM interface 16
+000001277    276          PUSH_LOCAL_PTR_ZERO -264 72
+000001278    276                         CALL rawbuf (1071)
+000001279    276                     PUSH_REG RESULT
+000001280    276                          DUP
+000001281    276               PUSH_LOCAL_PTR -336
+000001282    276                  SWAP_ASSIGN struct 72
+000001283    276                          DUP
+000001284    276                        DEREF ^
+000001285    276                      REF_CNT ++ ^void
+000001286    276               PUSH_LOCAL_PTR -344
+000001287    276                  SWAP_ASSIGN ^ 8
+000001288    276                          DUP
+000001289    276                    GET_FIELD int 8
+000001290    276               PUSH_LOCAL_PTR -352
+000001291    276                  SWAP_ASSIGN int 8
+000001292    276                          DUP
+000001293    276                    GET_FIELD struct 16
+000001294    276                      REF_CNT ++ Err
+000001295    276               PUSH_LOCAL_PTR -408
+000001296    276                  SWAP_ASSIGN struct 56
+000001297    276                          POP 1
+000001298    277                   PUSH_LOCAL int -408
+000001299    277                         PUSH int 0
+000001300    279               GOTO_IF_EQ_INT int 1321
+000001301    278                         PUSH int 0
+000001302    278               PUSH_LOCAL_PTR -408
+000001303    278               PUSH_LOCAL_PTR -472
+000001304    278                         ZERO 64
+000001305    278               PUSH_LOCAL_PTR -464
+000001306    278          SWAP_REF_CNT_ASSIGN Err
+000001307    278               PUSH_LOCAL_PTR -472
+000001308    278                  SWAP_ASSIGN int 8
+000001309    278               PUSH_LOCAL_PTR -472
+000001310    278                   PUSH_LOCAL ^ 16
+000001311    278                  SWAP_ASSIGN struct 64
+000001312    278                   PUSH_LOCAL ^ 16
+000001313    278                      REF_CNT ++ { int Err }
+000001314    278                      POP_REG RESULT
+000001315    278                REF_CNT_LOCAL -- { int Err } -472
+000001316    278                REF_CNT_LOCAL -- Err -408
+000001317    278                REF_CNT_LOCAL -- ^void -344
+000001318    278                REF_CNT_LOCAL -- { ^void int Err } -336
+000001319    285                         GOTO 1437
+
+000001320    279                REF_CNT_LOCAL -- { int Err } -472
+000001321    280                   PUSH_LOCAL int -352
+000001322    280                         PUSH int 0
+000001323    280                       EQ_INT int
+000001324    280                          DUP
+000001325    280                      GOTO_IF 1330
+
+000001326    280                          POP 1
+000001327    280                   PUSH_LOCAL ^ -344
+000001328    280                         PUSH ^ (nil)
+000001329    280                       BINARY == ^void
+
+000001330    282                  GOTO_IF_NOT 1360
+
+000001331    281                         PUSH int 0
+000001332    281                    PUSH_ZERO 2
+000001333    281                         PUSH int 0
+000001334    281          PUSH_LOCAL_PTR_ZERO -528 56
+000001335    281                         CALL stderror (67)
+000001336    281                     PUSH_REG RESULT
+000001337    281                          DUP
+000001338    281               PUSH_LOCAL_PTR -584
+000001339    281                  SWAP_ASSIGN struct 56
+000001340    281               PUSH_LOCAL_PTR -648
+000001341    281                         ZERO 64
+000001342    281               PUSH_LOCAL_PTR -640
+000001343    281          SWAP_REF_CNT_ASSIGN Err
+000001344    281               PUSH_LOCAL_PTR -648
+000001345    281                  SWAP_ASSIGN int 8
+000001346    281               PUSH_LOCAL_PTR -648
+000001347    281                   PUSH_LOCAL ^ 16
+000001348    281                  SWAP_ASSIGN struct 64
+000001349    281                   PUSH_LOCAL ^ 16
+000001350    281                      REF_CNT ++ { int Err }
+000001351    281                      POP_REG RESULT
+000001352    281                REF_CNT_LOCAL -- { int Err } -648
+000001353    281                REF_CNT_LOCAL -- Err -584
+000001354    281                REF_CNT_LOCAL -- Err -408
+000001355    281                REF_CNT_LOCAL -- ^void -344
+000001356    281                REF_CNT_LOCAL -- { ^void int Err } -336
+000001357    285                         GOTO 1437
+
+000001358    282                REF_CNT_LOCAL -- { int Err } -648
+000001359    282                REF_CNT_LOCAL -- Err -584
+
+000001360    283                   PUSH_LOCAL bool 24
+000001361    283                  GOTO_IF_NOT 1372
+
+000001362    283                    PUSH_ZERO 2
+000001363    283                   PUSH_LOCAL ^ -344
+000001364    283                      REF_CNT ++ ^void
+000001365    283                         PUSH int 1
+000001366    283                   PUSH_LOCAL int -352
+000001367    283                   PUSH_LOCAL ^ 48
+000001368    283                      REF_CNT ++ File
+000001369    283                         CALL rtlfread (1069)
+000001370    283                     PUSH_REG RESULT
+000001371    283                         GOTO 1381
+
+000001372    283                    PUSH_ZERO 2
+000001373    283                   PUSH_LOCAL ^ -344
+000001374    283                      REF_CNT ++ ^void
+000001375    283                         PUSH int 1
+000001376    283                   PUSH_LOCAL int -352
+000001377    283                   PUSH_LOCAL ^ 48
+000001378    283                      REF_CNT ++ File
+000001379    283                         CALL rtlfwrite (1070)
+000001380    283                     PUSH_REG RESULT
+
+000001381    283               PUSH_LOCAL_PTR -656
+000001382    283                  SWAP_ASSIGN int 8
+000001383    284                   PUSH_LOCAL int -656
+000001384    284                   PUSH_LOCAL int -656
+000001385    284                   PUSH_LOCAL int -352
+000001386    284           GOTO_IF_NOT_EQ_INT int 1401
+000001387    284                    PUSH_ZERO 2
+000001388    284                         PUSH int 0
+000001389    284          PUSH_LOCAL_PTR_ZERO -712 56
+000001390    284                         CALL stderror (67)
+000001391    284                     PUSH_REG RESULT
+000001392    284                          DUP
+000001393    284               PUSH_LOCAL_PTR -768
+000001394    284                  SWAP_ASSIGN struct 56
+000001395    284                          DUP
+000001396    284                      REF_CNT ++ Err
+000001397    284               PUSH_LOCAL_PTR -824
+000001398    284                  SWAP_ASSIGN struct 56
+000001399    284                REF_CNT_LOCAL -- Err -768
+000001400    284                         GOTO 1414
+
+000001401    284                    PUSH_ZERO 2
+000001402    284                         PUSH int 5
+000001403    284          PUSH_LOCAL_PTR_ZERO -880 56
+000001404    284                         CALL stderror (67)
+000001405    284                     PUSH_REG RESULT
+000001406    284                          DUP
+000001407    284               PUSH_LOCAL_PTR -936
+000001408    284                  SWAP_ASSIGN struct 56
+000001409    284                          DUP
+000001410    284                      REF_CNT ++ Err
+000001411    284               PUSH_LOCAL_PTR -824
+000001412    284                  SWAP_ASSIGN struct 56
+000001413    284                REF_CNT_LOCAL -- Err -936
+
+000001414    284               PUSH_LOCAL_PTR -1000
+000001415    284                         ZERO 64
+000001416    284               PUSH_LOCAL_PTR -992
+000001417    284          SWAP_REF_CNT_ASSIGN Err
+000001418    284               PUSH_LOCAL_PTR -1000
+000001419    284                  SWAP_ASSIGN int 8
+000001420    284               PUSH_LOCAL_PTR -1000
+000001421    284                   PUSH_LOCAL ^ 16
+000001422    284                  SWAP_ASSIGN struct 64
+000001423    284                   PUSH_LOCAL ^ 16
+000001424    284                      REF_CNT ++ { int Err }
+000001425    284                      POP_REG RESULT
+000001426    284                REF_CNT_LOCAL -- { int Err } -1000
+000001427    284                REF_CNT_LOCAL -- Err -824
+000001428    284                REF_CNT_LOCAL -- Err -408
+000001429    284                REF_CNT_LOCAL -- ^void -344
+000001430    284                REF_CNT_LOCAL -- { ^void int Err } -336
+000001431    285                         GOTO 1437
+
+000001432    285                REF_CNT_LOCAL -- { int Err } -1000
+000001433    285                REF_CNT_LOCAL -- Err -824
+000001434    285                REF_CNT_LOCAL -- Err -408
+000001435    285                REF_CNT_LOCAL -- ^void -344
+000001436    285                REF_CNT_LOCAL -- { ^void int Err } -336
+
+000001437    285                REF_CNT_LOCAL -- interface 32
+000001438    285                REF_CNT_LOCAL -- File 48
+000001439    285                  LEAVE_FRAME
+000001440    285                       RETURN 7
+
+
+Function: fread
+
+000001441    289                  ENTER_FRAME 0x558b193175e8
+000001442    288                    PUSH_ZERO 2
+000001443    288                   PUSH_LOCAL ^ 40
+000001444    288                      REF_CNT ++ File
+000001445    288               PUSH_LOCAL_PTR 24
+000001446    288                      REF_CNT ++ interface
+000001447    288                 ASSIGN_PARAM interface 16
+000001448    288                         PUSH int 1
+000001449    288                 ASSIGN_PARAM bool 1
+000001450    288          PUSH_LOCAL_PTR_ZERO -80 64
+000001451    288                         CALL freadwrite (1242)
+000001452    288                     PUSH_REG RESULT
+000001453    288                          DUP
+000001454    288               PUSH_LOCAL_PTR -144
+000001455    288                  SWAP_ASSIGN struct 64
+000001456    288                   PUSH_LOCAL ^ 16
+000001457    288                  SWAP_ASSIGN struct 64
+000001458    288                   PUSH_LOCAL ^ 16
+000001459    288                      REF_CNT ++ { int Err }
+000001460    288                      POP_REG RESULT
+000001461    288                REF_CNT_LOCAL -- { int Err } -144
+000001462    289                         GOTO 1464
+
+000001463    289                REF_CNT_LOCAL -- { int Err } -144
+
+000001464    289                REF_CNT_LOCAL -- interface 24
+000001465    289                REF_CNT_LOCAL -- File 40
+000001466    289                  LEAVE_FRAME
+000001467    289                       RETURN 6
+
+
+Function: freadall
+
+000001468    313                  ENTER_FRAME 0x558b19312978
+000001469    292                    PUSH_ZERO 2
+000001470    292                   PUSH_LOCAL ^ 24
+000001471    292                      REF_CNT ++ File
+000001472    292                         PUSH int 0
+000001473    292                         PUSH int 2
+000001474    292          PUSH_LOCAL_PTR_ZERO -72 56
+000001475    292                         CALL fseek (776)
+000001476    292                     PUSH_REG RESULT
+000001477    292               PUSH_LOCAL_PTR -184
+000001478    292                  SWAP_ASSIGN struct 56
+000001479    293                   PUSH_LOCAL int -184
+000001480    293                         PUSH int 0
+000001481    295               GOTO_IF_EQ_INT int 1500
+000001482    294          PUSH_LOCAL_PTR_ZERO -208 24
+000001483    294               PUSH_LOCAL_PTR -184
+000001484    294               PUSH_LOCAL_PTR -288
+000001485    294                         ZERO 80
+000001486    294               PUSH_LOCAL_PTR -264
+000001487    294          SWAP_REF_CNT_ASSIGN Err
+000001488    294               PUSH_LOCAL_PTR -288
+000001489    294          SWAP_REF_CNT_ASSIGN []char
+000001490    294               PUSH_LOCAL_PTR -288
+000001491    294                   PUSH_LOCAL ^ 16
+000001492    294                  SWAP_ASSIGN struct 80
+000001493    294                   PUSH_LOCAL ^ 16
+000001494    294                      REF_CNT ++ { []char Err }
+000001495    294                      POP_REG RESULT
+000001496    294                REF_CNT_LOCAL -- { []char Err } -288
+000001497    294                REF_CNT_LOCAL -- Err -184
+000001498    313                         GOTO 1693
+
+000001499    295                REF_CNT_LOCAL -- { []char Err } -288
+000001500    296                    PUSH_ZERO 2
+000001501    296                   PUSH_LOCAL ^ 24
+000001502    296                      REF_CNT ++ File
+000001503    296          PUSH_LOCAL_PTR_ZERO -352 64
+000001504    296                         CALL ftell (845)
+000001505    296                     PUSH_REG RESULT
+000001506    296                          DUP
+000001507    296               PUSH_LOCAL_PTR -416
+000001508    296                  SWAP_ASSIGN struct 64
+000001509    296                          DUP
+000001510    296                        DEREF int
+000001511    296               PUSH_LOCAL_PTR -424
+000001512    296                  SWAP_ASSIGN int 8
+000001513    296                          DUP
+000001514    296                    GET_FIELD struct 8
+000001515    296               PUSH_LOCAL_PTR -184
+000001516    296          SWAP_REF_CNT_ASSIGN Err
+000001517    296                          POP 1
+000001518    297                   PUSH_LOCAL int -184
+000001519    297                         PUSH int 0
+000001520    299               GOTO_IF_EQ_INT int 1540
+000001521    298          PUSH_LOCAL_PTR_ZERO -448 24
+000001522    298               PUSH_LOCAL_PTR -184
+000001523    298               PUSH_LOCAL_PTR -528
+000001524    298                         ZERO 80
+000001525    298               PUSH_LOCAL_PTR -504
+000001526    298          SWAP_REF_CNT_ASSIGN Err
+000001527    298               PUSH_LOCAL_PTR -528
+000001528    298          SWAP_REF_CNT_ASSIGN []char
+000001529    298               PUSH_LOCAL_PTR -528
+000001530    298                   PUSH_LOCAL ^ 16
+000001531    298                  SWAP_ASSIGN struct 80
+000001532    298                   PUSH_LOCAL ^ 16
+000001533    298                      REF_CNT ++ { []char Err }
+000001534    298                      POP_REG RESULT
+000001535    298                REF_CNT_LOCAL -- { []char Err } -528
+000001536    298                REF_CNT_LOCAL -- { int Err } -416
+000001537    298                REF_CNT_LOCAL -- Err -184
+000001538    313                         GOTO 1693
+
+000001539    299                REF_CNT_LOCAL -- { []char Err } -528
+000001540    300                   PUSH_LOCAL int -424
+000001541    300                         PUSH int 2147483392
+000001542    302          GOTO_IF_LESS_EQ_INT int 1571
+000001543    301          PUSH_LOCAL_PTR_ZERO -552 24
+000001544    301                    PUSH_ZERO 2
+000001545    301                         PUSH int 5
+000001546    301          PUSH_LOCAL_PTR_ZERO -608 56
+000001547    301                         CALL stderror (67)
+000001548    301                     PUSH_REG RESULT
+000001549    301                          DUP
+000001550    301               PUSH_LOCAL_PTR -664
+000001551    301                  SWAP_ASSIGN struct 56
+000001552    301               PUSH_LOCAL_PTR -744
+000001553    301                         ZERO 80
+000001554    301               PUSH_LOCAL_PTR -720
+000001555    301          SWAP_REF_CNT_ASSIGN Err
+000001556    301               PUSH_LOCAL_PTR -744
+000001557    301          SWAP_REF_CNT_ASSIGN []char
+000001558    301               PUSH_LOCAL_PTR -744
+000001559    301                   PUSH_LOCAL ^ 16
+000001560    301                  SWAP_ASSIGN struct 80
+000001561    301                   PUSH_LOCAL ^ 16
+000001562    301                      REF_CNT ++ { []char Err }
+000001563    301                      POP_REG RESULT
+000001564    301                REF_CNT_LOCAL -- { []char Err } -744
+000001565    301                REF_CNT_LOCAL -- Err -664
+000001566    301                REF_CNT_LOCAL -- { int Err } -416
+000001567    301                REF_CNT_LOCAL -- Err -184
+000001568    313                         GOTO 1693
+
+000001569    302                REF_CNT_LOCAL -- { []char Err } -744
+000001570    302                REF_CNT_LOCAL -- Err -664
+000001571    303               PUSH_LOCAL_PTR -184
+000001572    303                    PUSH_ZERO 2
+000001573    303                   PUSH_LOCAL ^ 24
+000001574    303                      REF_CNT ++ File
+000001575    303                         PUSH int 0
+000001576    303                         PUSH int 0
+000001577    303          PUSH_LOCAL_PTR_ZERO -800 56
+000001578    303                         CALL fseek (776)
+000001579    303                     PUSH_REG RESULT
+000001580    303               REF_CNT_ASSIGN -- Err
+000001581    304                   PUSH_LOCAL int -184
+000001582    304                         PUSH int 0
+000001583    306               GOTO_IF_EQ_INT int 1603
+000001584    305          PUSH_LOCAL_PTR_ZERO -880 24
+000001585    305               PUSH_LOCAL_PTR -184
+000001586    305               PUSH_LOCAL_PTR -960
+000001587    305                         ZERO 80
+000001588    305               PUSH_LOCAL_PTR -936
+000001589    305          SWAP_REF_CNT_ASSIGN Err
+000001590    305               PUSH_LOCAL_PTR -960
+000001591    305          SWAP_REF_CNT_ASSIGN []char
+000001592    305               PUSH_LOCAL_PTR -960
+000001593    305                   PUSH_LOCAL ^ 16
+000001594    305                  SWAP_ASSIGN struct 80
+000001595    305                   PUSH_LOCAL ^ 16
+000001596    305                      REF_CNT ++ { []char Err }
+000001597    305                      POP_REG RESULT
+000001598    305                REF_CNT_LOCAL -- { []char Err } -960
+000001599    305                REF_CNT_LOCAL -- { int Err } -416
+000001600    305                REF_CNT_LOCAL -- Err -184
+000001601    313                         GOTO 1693
+
+000001602    306                REF_CNT_LOCAL -- { []char Err } -960
+000001603    307                   PUSH_LOCAL int -424
+000001604    307               PUSH_LOCAL_PTR -984
+000001605    307                 CALL_BUILTIN []char make
+000001606    307               PUSH_LOCAL_PTR -1032
+000001607    307                  SWAP_ASSIGN [] 24
+000001608    308                    PUSH_ZERO 2
+000001609    308                   PUSH_LOCAL ^ 24
+000001610    308                      REF_CNT ++ File
+000001611    308               PUSH_LOCAL_PTR -1032
+000001612    308               PUSH_LOCAL_PTR -1048
+000001613    308                  SWAP_ASSIGN ^ 0
+000001614    308                         PUSH ^ 0x558b19319948
+000001615    308               PUSH_LOCAL_PTR -1040
+000001616    308                  SWAP_ASSIGN ^ 0
+000001617    308               PUSH_LOCAL_PTR -1048
+000001618    308                      REF_CNT ++ interface
+000001619    308                 ASSIGN_PARAM interface 16
+000001620    308          PUSH_LOCAL_PTR_ZERO -1112 64
+000001621    308                         CALL fread (1441)
+000001622    308                     PUSH_REG RESULT
+000001623    308                          DUP
+000001624    308               PUSH_LOCAL_PTR -1176
+000001625    308                  SWAP_ASSIGN struct 64
+000001626    308                          DUP
+000001627    308                        DEREF int
+000001628    308               PUSH_LOCAL_PTR -1184
+000001629    308                  SWAP_ASSIGN int 8
+000001630    308                          DUP
+000001631    308                    GET_FIELD struct 8
+000001632    308               PUSH_LOCAL_PTR -184
+000001633    308          SWAP_REF_CNT_ASSIGN Err
+000001634    308                          POP 1
+000001635    309                   PUSH_LOCAL int -184
+000001636    309                         PUSH int 0
+000001637    311               GOTO_IF_EQ_INT int 1659
+000001638    310               PUSH_LOCAL_PTR -1032
+000001639    310               PUSH_LOCAL_PTR -184
+000001640    310               PUSH_LOCAL_PTR -1264
+000001641    310                         ZERO 80
+000001642    310               PUSH_LOCAL_PTR -1240
+000001643    310          SWAP_REF_CNT_ASSIGN Err
+000001644    310               PUSH_LOCAL_PTR -1264
+000001645    310          SWAP_REF_CNT_ASSIGN []char
+000001646    310               PUSH_LOCAL_PTR -1264
+000001647    310                   PUSH_LOCAL ^ 16
+000001648    310                  SWAP_ASSIGN struct 80
+000001649    310                   PUSH_LOCAL ^ 16
+000001650    310                      REF_CNT ++ { []char Err }
+000001651    310                      POP_REG RESULT
+000001652    310                REF_CNT_LOCAL -- { []char Err } -1264
+000001653    310                REF_CNT_LOCAL -- { int Err } -1176
+000001654    310                REF_CNT_LOCAL -- []char -1032
+000001655    310                REF_CNT_LOCAL -- { int Err } -416
+000001656    310                REF_CNT_LOCAL -- Err -184
+000001657    313                         GOTO 1693
+
+000001658    311                REF_CNT_LOCAL -- { []char Err } -1264
+000001659    312               PUSH_LOCAL_PTR -1032
+000001660    312                    PUSH_ZERO 2
+000001661    312                         PUSH int 0
+000001662    312          PUSH_LOCAL_PTR_ZERO -1320 56
+000001663    312                         CALL stderror (67)
+000001664    312                     PUSH_REG RESULT
+000001665    312                          DUP
+000001666    312               PUSH_LOCAL_PTR -1376
+000001667    312                  SWAP_ASSIGN struct 56
+000001668    312               PUSH_LOCAL_PTR -1456
+000001669    312                         ZERO 80
+000001670    312               PUSH_LOCAL_PTR -1432
+000001671    312          SWAP_REF_CNT_ASSIGN Err
+000001672    312               PUSH_LOCAL_PTR -1456
+000001673    312          SWAP_REF_CNT_ASSIGN []char
+000001674    312               PUSH_LOCAL_PTR -1456
+000001675    312                   PUSH_LOCAL ^ 16
+000001676    312                  SWAP_ASSIGN struct 80
+000001677    312                   PUSH_LOCAL ^ 16
+000001678    312                      REF_CNT ++ { []char Err }
+000001679    312                      POP_REG RESULT
+000001680    312                REF_CNT_LOCAL -- { []char Err } -1456
+000001681    312                REF_CNT_LOCAL -- Err -1376
+000001682    312                REF_CNT_LOCAL -- { int Err } -1176
+000001683    312                REF_CNT_LOCAL -- []char -1032
+000001684    312                REF_CNT_LOCAL -- { int Err } -416
+000001685    312                REF_CNT_LOCAL -- Err -184
+000001686    313                         GOTO 1693
+
+000001687    313                REF_CNT_LOCAL -- { []char Err } -1456
+000001688    313                REF_CNT_LOCAL -- Err -1376
+000001689    313                REF_CNT_LOCAL -- { int Err } -1176
+000001690    313                REF_CNT_LOCAL -- []char -1032
+000001691    313                REF_CNT_LOCAL -- { int Err } -416
+000001692    313                REF_CNT_LOCAL -- Err -184
+
+000001693    313                REF_CNT_LOCAL -- File 24
+000001694    313                  LEAVE_FRAME
+000001695    313                       RETURN 4
+
+
+Function: fwrite
+
+000001696    317                  ENTER_FRAME 0x558b1931a838
+000001697    316                    PUSH_ZERO 2
+000001698    316                   PUSH_LOCAL ^ 40
+000001699    316                      REF_CNT ++ File
+000001700    316               PUSH_LOCAL_PTR 24
+000001701    316                      REF_CNT ++ interface
+000001702    316                 ASSIGN_PARAM interface 16
+000001703    316                         PUSH int 0
+000001704    316                 ASSIGN_PARAM bool 1
+000001705    316          PUSH_LOCAL_PTR_ZERO -80 64
+000001706    316                         CALL freadwrite (1242)
+000001707    316                     PUSH_REG RESULT
+000001708    316                          DUP
+000001709    316               PUSH_LOCAL_PTR -144
+000001710    316                  SWAP_ASSIGN struct 64
+000001711    316                   PUSH_LOCAL ^ 16
+000001712    316                  SWAP_ASSIGN struct 64
+000001713    316                   PUSH_LOCAL ^ 16
+000001714    316                      REF_CNT ++ { int Err }
+000001715    316                      POP_REG RESULT
+000001716    316                REF_CNT_LOCAL -- { int Err } -144
+000001717    317                         GOTO 1719
+
+000001718    317                REF_CNT_LOCAL -- { int Err } -144
+
+000001719    317                REF_CNT_LOCAL -- interface 24
+000001720    317                REF_CNT_LOCAL -- File 40
+000001721    317                  LEAVE_FRAME
+000001722    317                       RETURN 6
+
+000001723    541                         GOTO 2568
+
+
+Function: pipe
+
+000001724    331                  ENTER_FRAME 0x558b1931c2e8
+000001725    326               PUSH_LOCAL_PTR -32
+000001726    326                         ZERO 16
+000001727    327                    PUSH_ZERO 2
+000001728    327               PUSH_LOCAL_PTR -32
+000001729    327                      REF_CNT ++ ^[2]int
+000001730    327                         CALL rtlpipe (1723)
+000001731    327                     PUSH_REG RESULT
+000001732    327                         PUSH int 0
+000001733    329               GOTO_IF_EQ_INT int 1763
+000001734    328                         PUSH int -1
+000001735    328                         PUSH int -1
+000001736    328                    PUSH_ZERO 2
+000001737    328                         PUSH int 5
+000001738    328          PUSH_LOCAL_PTR_ZERO -88 56
+000001739    328                         CALL stderror (67)
+000001740    328                     PUSH_REG RESULT
+000001741    328                          DUP
+000001742    328               PUSH_LOCAL_PTR -144
+000001743    328                  SWAP_ASSIGN struct 56
+000001744    328               PUSH_LOCAL_PTR -216
+000001745    328                         ZERO 72
+000001746    328               PUSH_LOCAL_PTR -200
+000001747    328          SWAP_REF_CNT_ASSIGN Err
+000001748    328               PUSH_LOCAL_PTR -208
+000001749    328                  SWAP_ASSIGN int 8
+000001750    328               PUSH_LOCAL_PTR -216
+000001751    328                  SWAP_ASSIGN int 8
+000001752    328               PUSH_LOCAL_PTR -216
+000001753    328                   PUSH_LOCAL ^ 16
+000001754    328                  SWAP_ASSIGN struct 72
+000001755    328                   PUSH_LOCAL ^ 16
+000001756    328                      REF_CNT ++ { int int Err }
+000001757    328                      POP_REG RESULT
+000001758    328                REF_CNT_LOCAL -- { int int Err } -216
+000001759    328                REF_CNT_LOCAL -- Err -144
+000001760    331                         GOTO 1792
+
+000001761    329                REF_CNT_LOCAL -- { int int Err } -216
+000001762    329                REF_CNT_LOCAL -- Err -144
+000001763    330                   PUSH_LOCAL int -32
+000001764    330                   PUSH_LOCAL int -24
+000001765    330                    PUSH_ZERO 2
+000001766    330                         PUSH int 0
+000001767    330          PUSH_LOCAL_PTR_ZERO -272 56
+000001768    330                         CALL stderror (67)
+000001769    330                     PUSH_REG RESULT
+000001770    330                          DUP
+000001771    330               PUSH_LOCAL_PTR -328
+000001772    330                  SWAP_ASSIGN struct 56
+000001773    330               PUSH_LOCAL_PTR -400
+000001774    330                         ZERO 72
+000001775    330               PUSH_LOCAL_PTR -384
+000001776    330          SWAP_REF_CNT_ASSIGN Err
+000001777    330               PUSH_LOCAL_PTR -392
+000001778    330                  SWAP_ASSIGN int 8
+000001779    330               PUSH_LOCAL_PTR -400
+000001780    330                  SWAP_ASSIGN int 8
+000001781    330               PUSH_LOCAL_PTR -400
+000001782    330                   PUSH_LOCAL ^ 16
+000001783    330                  SWAP_ASSIGN struct 72
+000001784    330                   PUSH_LOCAL ^ 16
+000001785    330                      REF_CNT ++ { int int Err }
+000001786    330                      POP_REG RESULT
+000001787    330                REF_CNT_LOCAL -- { int int Err } -400
+000001788    330                REF_CNT_LOCAL -- Err -328
+000001789    331                         GOTO 1792
+
+000001790    331                REF_CNT_LOCAL -- { int int Err } -400
+000001791    331                REF_CNT_LOCAL -- Err -328
+
+000001792    331                  LEAVE_FRAME
+000001793    331                       RETURN 3
+
+000001794    541                         GOTO 2563
+
+000001795    541                         GOTO 2558
+
+000001796    541                         GOTO 2554
+
+
+Function: fdread
+
+000001797    350                  ENTER_FRAME 0x558b1931bc48
+000001798    338                    PUSH_ZERO 2
+000001799    338               PUSH_LOCAL_PTR 24
+000001800    338                      REF_CNT ++ interface
+000001801    338                 ASSIGN_PARAM interface 16
+000001802    338          PUSH_LOCAL_PTR_ZERO -88 72
+000001803    338                         CALL rawbuf (1071)
+000001804    338                     PUSH_REG RESULT
+000001805    338                          DUP
+000001806    338               PUSH_LOCAL_PTR -160
+000001807    338                  SWAP_ASSIGN struct 72
+000001808    338                          DUP
+000001809    338                        DEREF ^
+000001810    338                      REF_CNT ++ ^void
+000001811    338               PUSH_LOCAL_PTR -168
+000001812    338                  SWAP_ASSIGN ^ 8
+000001813    338                          DUP
+000001814    338                    GET_FIELD int 8
+000001815    338               PUSH_LOCAL_PTR -176
+000001816    338                  SWAP_ASSIGN int 8
+000001817    338                          DUP
+000001818    338                    GET_FIELD struct 16
+000001819    338                      REF_CNT ++ Err
+000001820    338               PUSH_LOCAL_PTR -232
+000001821    338                  SWAP_ASSIGN struct 56
+000001822    338                          POP 1
+000001823    339                   PUSH_LOCAL int -232
+000001824    339                         PUSH int 0
+000001825    341               GOTO_IF_EQ_INT int 1846
+000001826    340                         PUSH int 0
+000001827    340               PUSH_LOCAL_PTR -232
+000001828    340               PUSH_LOCAL_PTR -296
+000001829    340                         ZERO 64
+000001830    340               PUSH_LOCAL_PTR -288
+000001831    340          SWAP_REF_CNT_ASSIGN Err
+000001832    340               PUSH_LOCAL_PTR -296
+000001833    340                  SWAP_ASSIGN int 8
+000001834    340               PUSH_LOCAL_PTR -296
+000001835    340                   PUSH_LOCAL ^ 16
+000001836    340                  SWAP_ASSIGN struct 64
+000001837    340                   PUSH_LOCAL ^ 16
+000001838    340                      REF_CNT ++ { int Err }
+000001839    340                      POP_REG RESULT
+000001840    340                REF_CNT_LOCAL -- { int Err } -296
+000001841    340                REF_CNT_LOCAL -- Err -232
+000001842    340                REF_CNT_LOCAL -- ^void -168
+000001843    340                REF_CNT_LOCAL -- { ^void int Err } -160
+000001844    350                         GOTO 1960
+
+000001845    341                REF_CNT_LOCAL -- { int Err } -296
+000001846    342                   PUSH_LOCAL int -176
+000001847    342                         PUSH int 0
+000001848    342                       EQ_INT int
+000001849    342                          DUP
+000001850    342                      GOTO_IF 1855
+
+000001851    342                          POP 1
+000001852    342                   PUSH_LOCAL ^ -168
+000001853    342                         PUSH ^ (nil)
+000001854    342                       BINARY == ^void
+
+000001855    344                  GOTO_IF_NOT 1885
+
+000001856    343                         PUSH int 0
+000001857    343                    PUSH_ZERO 2
+000001858    343                         PUSH int 0
+000001859    343          PUSH_LOCAL_PTR_ZERO -352 56
+000001860    343                         CALL stderror (67)
+000001861    343                     PUSH_REG RESULT
+000001862    343                          DUP
+000001863    343               PUSH_LOCAL_PTR -408
+000001864    343                  SWAP_ASSIGN struct 56
+000001865    343               PUSH_LOCAL_PTR -472
+000001866    343                         ZERO 64
+000001867    343               PUSH_LOCAL_PTR -464
+000001868    343          SWAP_REF_CNT_ASSIGN Err
+000001869    343               PUSH_LOCAL_PTR -472
+000001870    343                  SWAP_ASSIGN int 8
+000001871    343               PUSH_LOCAL_PTR -472
+000001872    343                   PUSH_LOCAL ^ 16
+000001873    343                  SWAP_ASSIGN struct 64
+000001874    343                   PUSH_LOCAL ^ 16
+000001875    343                      REF_CNT ++ { int Err }
+000001876    343                      POP_REG RESULT
+000001877    343                REF_CNT_LOCAL -- { int Err } -472
+000001878    343                REF_CNT_LOCAL -- Err -408
+000001879    343                REF_CNT_LOCAL -- Err -232
+000001880    343                REF_CNT_LOCAL -- ^void -168
+000001881    343                REF_CNT_LOCAL -- { ^void int Err } -160
+000001882    350                         GOTO 1960
+
+000001883    344                REF_CNT_LOCAL -- { int Err } -472
+000001884    344                REF_CNT_LOCAL -- Err -408
+
+000001885    345                         PUSH int -2
+000001886    345               PUSH_LOCAL_PTR -480
+000001887    345                  SWAP_ASSIGN int 8
+
+000001888    346                   PUSH_LOCAL int -480
+000001889    346                         PUSH int -2
+000001890    348           GOTO_IF_NOT_EQ_INT int 1901
+000001891    347               PUSH_LOCAL_PTR -480
+000001892    347                    PUSH_ZERO 2
+000001893    347                   PUSH_LOCAL int 40
+000001894    347                   PUSH_LOCAL ^ -168
+000001895    347                      REF_CNT ++ ^void
+000001896    347                   PUSH_LOCAL int -176
+000001897    347                         CALL rtlfdread (1794)
+000001898    347                     PUSH_REG RESULT
+000001899    347                       ASSIGN int 8
+000001900    348                         GOTO 1888
+
+000001901    349                   PUSH_LOCAL int -480
+000001902    349                         PUSH int 0
+000001903    349          GOTO_IF_LESS_EQ_INT int 1906
+000001904    349                   PUSH_LOCAL int -480
+000001905    349                         GOTO 1907
+
+000001906    349                         PUSH int 0
+
+000001907    349                   PUSH_LOCAL int -480
+000001908    349                         PUSH int 0
+000001909    349          GOTO_IF_LESS_EQ_INT int 1924
+000001910    349                    PUSH_ZERO 2
+000001911    349                         PUSH int 0
+000001912    349          PUSH_LOCAL_PTR_ZERO -536 56
+000001913    349                         CALL stderror (67)
+000001914    349                     PUSH_REG RESULT
+000001915    349                          DUP
+000001916    349               PUSH_LOCAL_PTR -592
+000001917    349                  SWAP_ASSIGN struct 56
+000001918    349                          DUP
+000001919    349                      REF_CNT ++ Err
+000001920    349               PUSH_LOCAL_PTR -648
+000001921    349                  SWAP_ASSIGN struct 56
+000001922    349                REF_CNT_LOCAL -- Err -592
+000001923    349                         GOTO 1937
+
+000001924    349                    PUSH_ZERO 2
+000001925    349                         PUSH int 5
+000001926    349          PUSH_LOCAL_PTR_ZERO -704 56
+000001927    349                         CALL stderror (67)
+000001928    349                     PUSH_REG RESULT
+000001929    349                          DUP
+000001930    349               PUSH_LOCAL_PTR -760
+000001931    349                  SWAP_ASSIGN struct 56
+000001932    349                          DUP
+000001933    349                      REF_CNT ++ Err
+000001934    349               PUSH_LOCAL_PTR -648
+000001935    349                  SWAP_ASSIGN struct 56
+000001936    349                REF_CNT_LOCAL -- Err -760
+
+000001937    349               PUSH_LOCAL_PTR -824
+000001938    349                         ZERO 64
+000001939    349               PUSH_LOCAL_PTR -816
+000001940    349          SWAP_REF_CNT_ASSIGN Err
+000001941    349               PUSH_LOCAL_PTR -824
+000001942    349                  SWAP_ASSIGN int 8
+000001943    349               PUSH_LOCAL_PTR -824
+000001944    349                   PUSH_LOCAL ^ 16
+000001945    349                  SWAP_ASSIGN struct 64
+000001946    349                   PUSH_LOCAL ^ 16
+000001947    349                      REF_CNT ++ { int Err }
+000001948    349                      POP_REG RESULT
+000001949    349                REF_CNT_LOCAL -- { int Err } -824
+000001950    349                REF_CNT_LOCAL -- Err -648
+000001951    349                REF_CNT_LOCAL -- Err -232
+000001952    349                REF_CNT_LOCAL -- ^void -168
+000001953    349                REF_CNT_LOCAL -- { ^void int Err } -160
+000001954    350                         GOTO 1960
+
+000001955    350                REF_CNT_LOCAL -- { int Err } -824
+000001956    350                REF_CNT_LOCAL -- Err -648
+000001957    350                REF_CNT_LOCAL -- Err -232
+000001958    350                REF_CNT_LOCAL -- ^void -168
+000001959    350                REF_CNT_LOCAL -- { ^void int Err } -160
+
+000001960    350                REF_CNT_LOCAL -- interface 24
+000001961    350                  LEAVE_FRAME
+000001962    350                       RETURN 6
+
+
+Function: fdwrite
+
+000001963    369                  ENTER_FRAME 0x558b1936f7a8
+000001964    353                    PUSH_ZERO 2
+000001965    353               PUSH_LOCAL_PTR 24
+000001966    353                      REF_CNT ++ interface
+000001967    353                 ASSIGN_PARAM interface 16
+000001968    353          PUSH_LOCAL_PTR_ZERO -88 72
+000001969    353                         CALL rawbuf (1071)
+000001970    353                     PUSH_REG RESULT
+000001971    353                          DUP
+000001972    353               PUSH_LOCAL_PTR -160
+000001973    353                  SWAP_ASSIGN struct 72
+000001974    353                          DUP
+000001975    353                        DEREF ^
+000001976    353                      REF_CNT ++ ^void
+000001977    353               PUSH_LOCAL_PTR -168
+000001978    353                  SWAP_ASSIGN ^ 8
+000001979    353                          DUP
+000001980    353                    GET_FIELD int 8
+000001981    353               PUSH_LOCAL_PTR -176
+000001982    353                  SWAP_ASSIGN int 8
+000001983    353                          DUP
+000001984    353                    GET_FIELD struct 16
+000001985    353                      REF_CNT ++ Err
+000001986    353               PUSH_LOCAL_PTR -232
+000001987    353                  SWAP_ASSIGN struct 56
+000001988    353                          POP 1
+000001989    354                   PUSH_LOCAL int -232
+000001990    354                         PUSH int 0
+000001991    356               GOTO_IF_EQ_INT int 2012
+000001992    355                         PUSH int 0
+000001993    355               PUSH_LOCAL_PTR -232
+000001994    355               PUSH_LOCAL_PTR -296
+000001995    355                         ZERO 64
+000001996    355               PUSH_LOCAL_PTR -288
+000001997    355          SWAP_REF_CNT_ASSIGN Err
+000001998    355               PUSH_LOCAL_PTR -296
+000001999    355                  SWAP_ASSIGN int 8
+000002000    355               PUSH_LOCAL_PTR -296
+000002001    355                   PUSH_LOCAL ^ 16
+000002002    355                  SWAP_ASSIGN struct 64
+000002003    355                   PUSH_LOCAL ^ 16
+000002004    355                      REF_CNT ++ { int Err }
+000002005    355                      POP_REG RESULT
+000002006    355                REF_CNT_LOCAL -- { int Err } -296
+000002007    355                REF_CNT_LOCAL -- Err -232
+000002008    355                REF_CNT_LOCAL -- ^void -168
+000002009    355                REF_CNT_LOCAL -- { ^void int Err } -160
+000002010    369                         GOTO 2105
+
+000002011    356                REF_CNT_LOCAL -- { int Err } -296
+000002012    357                         PUSH int 0
+000002013    357               PUSH_LOCAL_PTR -304
+000002014    357                  SWAP_ASSIGN int 8
+
+000002015    358                   PUSH_LOCAL int -304
+000002016    358                   PUSH_LOCAL int -176
+000002017    367       GOTO_IF_GREATER_EQ_INT int 2073
+000002018    359                    PUSH_ZERO 2
+000002019    359                   PUSH_LOCAL int 40
+000002020    359                   PUSH_LOCAL ^ -168
+000002021    359                      REF_CNT ++ ^void
+000002022    359                   PUSH_LOCAL int -304
+000002023    359                   PUSH_LOCAL int -176
+000002024    359                   PUSH_LOCAL int -304
+000002025    359                      SUB_INT int
+000002026    359                         CALL rtlfdwrite (1795)
+000002027    359                     PUSH_REG RESULT
+000002028    359               PUSH_LOCAL_PTR -312
+000002029    359                  SWAP_ASSIGN int 8
+000002030    360                   PUSH_LOCAL int -312
+000002031    360                         PUSH int -2
+000002032    362           GOTO_IF_NOT_EQ_INT int 2034
+000002033    367                         GOTO 2072
+
+000002034    363                   PUSH_LOCAL int -312
+000002035    363                         PUSH int 0
+000002036    365          GOTO_IF_GREATER_INT int 2066
+000002037    364                   PUSH_LOCAL int -304
+000002038    364                    PUSH_ZERO 2
+000002039    364                         PUSH int 5
+000002040    364          PUSH_LOCAL_PTR_ZERO -368 56
+000002041    364                         CALL stderror (67)
+000002042    364                     PUSH_REG RESULT
+000002043    364                          DUP
+000002044    364               PUSH_LOCAL_PTR -424
+000002045    364                  SWAP_ASSIGN struct 56
+000002046    364               PUSH_LOCAL_PTR -488
+000002047    364                         ZERO 64
+000002048    364               PUSH_LOCAL_PTR -480
+000002049    364          SWAP_REF_CNT_ASSIGN Err
+000002050    364               PUSH_LOCAL_PTR -488
+000002051    364                  SWAP_ASSIGN int 8
+000002052    364               PUSH_LOCAL_PTR -488
+000002053    364                   PUSH_LOCAL ^ 16
+000002054    364                  SWAP_ASSIGN struct 64
+000002055    364                   PUSH_LOCAL ^ 16
+000002056    364                      REF_CNT ++ { int Err }
+000002057    364                      POP_REG RESULT
+000002058    364                REF_CNT_LOCAL -- { int Err } -488
+000002059    364                REF_CNT_LOCAL -- Err -424
+000002060    364                REF_CNT_LOCAL -- Err -232
+000002061    364                REF_CNT_LOCAL -- ^void -168
+000002062    364                REF_CNT_LOCAL -- { ^void int Err } -160
+000002063    369                         GOTO 2105
+
+000002064    365                REF_CNT_LOCAL -- { int Err } -488
+000002065    365                REF_CNT_LOCAL -- Err -424
+000002066    366               PUSH_LOCAL_PTR -304
+000002067    366                          DUP
+000002068    366                        DEREF int
+000002069    366                   PUSH_LOCAL int -312
+000002070    366                      ADD_INT int
+000002071    366                       ASSIGN int 8
+
+000002072    367                         GOTO 2015
+
+000002073    368                   PUSH_LOCAL int -304
+000002074    368                    PUSH_ZERO 2
+000002075    368                         PUSH int 0
+000002076    368          PUSH_LOCAL_PTR_ZERO -544 56
+000002077    368                         CALL stderror (67)
+000002078    368                     PUSH_REG RESULT
+000002079    368                          DUP
+000002080    368               PUSH_LOCAL_PTR -600
+000002081    368                  SWAP_ASSIGN struct 56
+000002082    368               PUSH_LOCAL_PTR -664
+000002083    368                         ZERO 64
+000002084    368               PUSH_LOCAL_PTR -656
+000002085    368          SWAP_REF_CNT_ASSIGN Err
+000002086    368               PUSH_LOCAL_PTR -664
+000002087    368                  SWAP_ASSIGN int 8
+000002088    368               PUSH_LOCAL_PTR -664
+000002089    368                   PUSH_LOCAL ^ 16
+000002090    368                  SWAP_ASSIGN struct 64
+000002091    368                   PUSH_LOCAL ^ 16
+000002092    368                      REF_CNT ++ { int Err }
+000002093    368                      POP_REG RESULT
+000002094    368                REF_CNT_LOCAL -- { int Err } -664
+000002095    368                REF_CNT_LOCAL -- Err -600
+000002096    368                REF_CNT_LOCAL -- Err -232
+000002097    368                REF_CNT_LOCAL -- ^void -168
+000002098    368                REF_CNT_LOCAL -- { ^void int Err } -160
+000002099    369                         GOTO 2105
+
+000002100    369                REF_CNT_LOCAL -- { int Err } -664
+000002101    369                REF_CNT_LOCAL -- Err -600
+000002102    369                REF_CNT_LOCAL -- Err -232
+000002103    369                REF_CNT_LOCAL -- ^void -168
+000002104    369                REF_CNT_LOCAL -- { ^void int Err } -160
+
+000002105    369                REF_CNT_LOCAL -- interface 24
+000002106    369                  LEAVE_FRAME
+000002107    369                       RETURN 6
+
+
+Function: fdclose
+
+000002108    373                  ENTER_FRAME 0x558b1936e818
+000002109    372                    PUSH_ZERO 2
+000002110    372                   PUSH_LOCAL int 24
+000002111    372                         CALL rtlfdclose (1796)
+000002112    372                     PUSH_REG RESULT
+000002113    372                         PUSH int 0
+000002114    372           GOTO_IF_NOT_EQ_INT int 2129
+000002115    372                    PUSH_ZERO 2
+000002116    372                         PUSH int 0
+000002117    372          PUSH_LOCAL_PTR_ZERO -72 56
+000002118    372                         CALL stderror (67)
+000002119    372                     PUSH_REG RESULT
+000002120    372                          DUP
+000002121    372               PUSH_LOCAL_PTR -128
+000002122    372                  SWAP_ASSIGN struct 56
+000002123    372                          DUP
+000002124    372                      REF_CNT ++ Err
+000002125    372               PUSH_LOCAL_PTR -184
+000002126    372                  SWAP_ASSIGN struct 56
+000002127    372                REF_CNT_LOCAL -- Err -128
+000002128    372                         GOTO 2142
+
+000002129    372                    PUSH_ZERO 2
+000002130    372                         PUSH int 5
+000002131    372          PUSH_LOCAL_PTR_ZERO -240 56
+000002132    372                         CALL stderror (67)
+000002133    372                     PUSH_REG RESULT
+000002134    372                          DUP
+000002135    372               PUSH_LOCAL_PTR -296
+000002136    372                  SWAP_ASSIGN struct 56
+000002137    372                          DUP
+000002138    372                      REF_CNT ++ Err
+000002139    372               PUSH_LOCAL_PTR -184
+000002140    372                  SWAP_ASSIGN struct 56
+000002141    372                REF_CNT_LOCAL -- Err -296
+
+000002142    372                   PUSH_LOCAL ^ 16
+000002143    372                  SWAP_ASSIGN struct 56
+000002144    372                   PUSH_LOCAL ^ 16
+000002145    372                      REF_CNT ++ Err
+000002146    372                      POP_REG RESULT
+000002147    372                REF_CNT_LOCAL -- Err -184
+000002148    373                         GOTO 2150
+
+000002149    373                REF_CNT_LOCAL -- Err -184
+
+000002150    373                  LEAVE_FRAME
+000002151    373                       RETURN 4
+
+
+Function: println
+
+000002152    377                  ENTER_FRAME 0x558b19353538
+000002153    376                         PUSH int 0
+000002154    376                         PUSH ^ (nil)
+000002155    376                   PUSH_LOCAL str 16
+000002156    376                  CALL_PRINTF printf 1
+000002157    376                      POP_REG RESULT
+000002158    377                         GOTO 2159
+
+000002159    377                REF_CNT_LOCAL -- str 16
+000002160    377                  LEAVE_FRAME
+000002161    377                       RETURN 3
+
+
+Function: fprintln
+
+000002162    381                  ENTER_FRAME 0x558b19353be8
+000002163    380                         PUSH int 0
+000002164    380                   PUSH_LOCAL ^ 24
+000002165    380                   PUSH_LOCAL str 16
+000002166    380                  CALL_PRINTF fprintf 1
+000002167    380                      POP_REG RESULT
+000002168    381                         GOTO 2169
+
+000002169    381                REF_CNT_LOCAL -- str 16
+000002170    381                REF_CNT_LOCAL -- File 24
+000002171    381                  LEAVE_FRAME
+000002172    381                       RETURN 4
+
+
+Function: getchar
+
+000002173    387                  ENTER_FRAME 0x558b19354058
+000002174    384               PUSH_LOCAL_PTR -17
+000002175    384                         ZERO 1
+000002176    385                         PUSH int 0
+000002177    385                         PUSH ^ (nil)
+000002178    385                         PUSH ^ 0x558b19353ee0
+000002179    385               PUSH_LOCAL_PTR -17
+000002180    385                 CALL_BUILTIN char scanf
+000002181    385                         PUSH int 0
+000002182    385                 CALL_BUILTIN void scanf
+000002183    385                          POP 3
+000002184    386                   PUSH_LOCAL char -17
+000002185    386                      POP_REG RESULT
+000002186    387                         GOTO 2187
+
+000002187    387                  LEAVE_FRAME
+000002188    387                       RETURN 2
+
+
+Function: ltrim
+
+000002189    402                  ENTER_FRAME 0x558b19354dd8
+000002190    392                         PUSH int -1
+000002191    392               PUSH_LOCAL_PTR -24
+000002192    392                  SWAP_ASSIGN int 8
+000002193    393                   PUSH_LOCAL str 16
+000002194    393                 CALL_BUILTIN str len
+000002195    393               PUSH_LOCAL_PTR -32
+000002196    393                  SWAP_ASSIGN int 8
+000002197    394                         PUSH int 0
+000002198    394               PUSH_LOCAL_PTR -40
+000002199    394                  SWAP_ASSIGN int 8
+
+000002200    394                   PUSH_LOCAL int -40
+000002201    394                   PUSH_LOCAL int -32
+000002202    399       GOTO_IF_GREATER_EQ_INT int 2214
+000002203    395                   PUSH_LOCAL str 16
+000002204    395                   PUSH_LOCAL int -40
+000002205    395                    GET_ARRAY char 1 -1
+000002206    395                         PUSH int 32
+000002207    398          GOTO_IF_LESS_EQ_INT char 2212
+000002208    396               PUSH_LOCAL_PTR -24
+000002209    396                   PUSH_LOCAL int -40
+000002210    396                       ASSIGN int 8
+000002211    399                         GOTO 2214
+
+000002212    399                INC_LOCAL_INT -40
+000002213    399                         GOTO 2200
+
+000002214    400                   PUSH_LOCAL int -24
+000002215    400                         PUSH int -1
+000002216    400           GOTO_IF_NOT_EQ_INT int 2220
+000002217    400                         PUSH ^ 0x558b19354c60
+000002218    400                      POP_REG RESULT
+000002219    402                         GOTO 2227
+
+000002220    401                   PUSH_LOCAL str 16
+000002221    401                   PUSH_LOCAL int -24
+000002222    401                         PUSH int -2147483648
+000002223    401                         PUSH ^ (nil)
+000002224    401                 CALL_BUILTIN str slice
+000002225    401                      POP_REG RESULT
+000002226    402                         GOTO 2227
+
+000002227    402                REF_CNT_LOCAL -- str 16
+000002228    402                  LEAVE_FRAME
+000002229    402                       RETURN 3
+
+
+Function: rtrim
+
+000002230    415                  ENTER_FRAME 0x558b19355868
+000002231    405                         PUSH int -1
+000002232    405               PUSH_LOCAL_PTR -24
+000002233    405                  SWAP_ASSIGN int 8
+000002234    406                   PUSH_LOCAL str 16
+000002235    406                 CALL_BUILTIN str len
+000002236    406               PUSH_LOCAL_PTR -32
+000002237    406                  SWAP_ASSIGN int 8
+000002238    407                   PUSH_LOCAL int -32
+000002239    407                         PUSH int 1
+000002240    407                      SUB_INT int
+000002241    407               PUSH_LOCAL_PTR -40
+000002242    407                  SWAP_ASSIGN int 8
+
+000002243    407                   PUSH_LOCAL int -40
+000002244    407                         PUSH int 0
+000002245    412             GOTO_IF_LESS_INT int 2257
+000002246    408                   PUSH_LOCAL str 16
+000002247    408                   PUSH_LOCAL int -40
+000002248    408                    GET_ARRAY char 1 -1
+000002249    408                         PUSH int 32
+000002250    411          GOTO_IF_LESS_EQ_INT char 2255
+000002251    409               PUSH_LOCAL_PTR -24
+000002252    409                   PUSH_LOCAL int -40
+000002253    409                       ASSIGN int 8
+000002254    412                         GOTO 2257
+
+000002255    412                DEC_LOCAL_INT -40
+000002256    412                         GOTO 2243
+
+000002257    413                   PUSH_LOCAL int -24
+000002258    413                         PUSH int -1
+000002259    413           GOTO_IF_NOT_EQ_INT int 2263
+000002260    413                         PUSH ^ 0x558b193556f0
+000002261    413                      POP_REG RESULT
+000002262    415                         GOTO 2272
+
+000002263    414                   PUSH_LOCAL str 16
+000002264    414                         PUSH int 0
+000002265    414                   PUSH_LOCAL int -24
+000002266    414                         PUSH int 1
+000002267    414                      ADD_INT int
+000002268    414                         PUSH ^ (nil)
+000002269    414                 CALL_BUILTIN str slice
+000002270    414                      POP_REG RESULT
+000002271    415                         GOTO 2272
+
+000002272    415                REF_CNT_LOCAL -- str 16
+000002273    415                  LEAVE_FRAME
+000002274    415                       RETURN 3
+
+
+Function: trim
+
+000002275    419                  ENTER_FRAME 0x558b19355cd8
+000002276    418                    PUSH_ZERO 4
+000002277    418                   PUSH_LOCAL str 16
+000002278    418                      REF_CNT ++ str
+000002279    418                         CALL rtrim (2230)
+000002280    418                     PUSH_REG RESULT
+000002281    418                         CALL ltrim (2189)
+000002282    419                         GOTO 2283
+
+000002283    419                REF_CNT_LOCAL -- str 16
+000002284    419                  LEAVE_FRAME
+000002285    419                       RETURN 3
+
+
+Function: atoi
+
+000002286    427                  ENTER_FRAME 0x558b193562d8
+000002287    424               PUSH_LOCAL_PTR -24
+000002288    424                         ZERO 8
+000002289    425                         PUSH int 0
+000002290    425                   PUSH_LOCAL str 16
+000002291    425                         PUSH ^ 0x558b19356160
+000002292    425               PUSH_LOCAL_PTR -24
+000002293    425                 CALL_BUILTIN int sscanf
+000002294    425                         PUSH int 0
+000002295    425                 CALL_BUILTIN void sscanf
+000002296    425                          POP 3
+000002297    426                   PUSH_LOCAL int -24
+000002298    426                      POP_REG RESULT
+000002299    427                         GOTO 2300
+
+000002300    427                REF_CNT_LOCAL -- str 16
+000002301    427                  LEAVE_FRAME
+000002302    427                       RETURN 3
+
+
+Function: atof
+
+000002303    433                  ENTER_FRAME 0x558b19356a58
+000002304    430               PUSH_LOCAL_PTR -24
+000002305    430                         ZERO 8
+000002306    431                         PUSH int 0
+000002307    431                   PUSH_LOCAL str 16
+000002308    431                         PUSH ^ 0x558b193568e0
+000002309    431               PUSH_LOCAL_PTR -24
+000002310    431                 CALL_BUILTIN real sscanf
+000002311    431                         PUSH int 0
+000002312    431                 CALL_BUILTIN void sscanf
+000002313    431                          POP 3
+000002314    432                   PUSH_LOCAL real -24
+000002315    432                      POP_REG RESULT
+000002316    433                         GOTO 2317
+
+000002317    433                REF_CNT_LOCAL -- str 16
+000002318    433                  LEAVE_FRAME
+000002319    433                       RETURN 3
+
+
+Function: itoa
+
+000002320    438                  ENTER_FRAME 0x558b193572d8
+000002321    436                         PUSH int 0
+000002322    436                         PUSH ^ (nil)
+000002323    436                   PUSH_LOCAL int 16
+000002324    436                  CALL_PRINTF sprintf 1
+000002325    436               PUSH_LOCAL_PTR -32
+000002326    436                  SWAP_ASSIGN str 8
+000002327    437                   PUSH_LOCAL str -32
+000002328    437                      REF_CNT ++ str
+000002329    437                      POP_REG RESULT
+000002330    437                REF_CNT_LOCAL -- str -32
+000002331    438                         GOTO 2333
+
+000002332    438                REF_CNT_LOCAL -- str -32
+
+000002333    438                  LEAVE_FRAME
+000002334    438                       RETURN 3
+
+
+Function: ftoa
+
+000002335    444                  ENTER_FRAME 0x558b19358038
+000002336    441                         PUSH int 0
+000002337    441                         PUSH ^ (nil)
+000002338    441                   PUSH_LOCAL int 16
+000002339    441                  CALL_PRINTF sprintf 1
+000002340    441               PUSH_LOCAL_PTR -32
+000002341    441                  SWAP_ASSIGN str 8
+000002342    442                         PUSH int 0
+000002343    442                         PUSH ^ (nil)
+000002344    442                   PUSH_LOCAL str -32
+000002345    442                   PUSH_LOCAL real 24
+000002346    442                 CALL_BUILTIN real sprintf
+000002347    442                         PUSH int 0
+000002348    442                 CALL_BUILTIN void sprintf
+000002349    442                          POP 1
+000002350    442                         SWAP
+000002351    442                          POP 1
+000002352    442               PUSH_LOCAL_PTR -48
+000002353    442                  SWAP_ASSIGN str 8
+000002354    443                   PUSH_LOCAL str -48
+000002355    443                      REF_CNT ++ str
+000002356    443                      POP_REG RESULT
+000002357    443                REF_CNT_LOCAL -- str -48
+000002358    443                REF_CNT_LOCAL -- str -32
+000002359    444                         GOTO 2362
+
+000002360    444                REF_CNT_LOCAL -- str -48
+000002361    444                REF_CNT_LOCAL -- str -32
+
+000002362    444                  LEAVE_FRAME
+000002363    444                       RETURN 4
+
+
+Function: rand
+
+000002364    462                  ENTER_FRAME 0x558b19358628
+000002365    458                         PUSH ^ randSeed
+000002366    458                          DUP
+000002367    458                        DEREF uint
+000002368    458                  PUSH_GLOBAL uint randSeed
+000002369    458                         PUSH int 13
+000002370    458                       BINARY << uint
+000002371    458                       BINARY ~ uint
+000002372    458                       ASSIGN uint 8
+000002373    459                         PUSH ^ randSeed
+000002374    459                          DUP
+000002375    459                        DEREF uint
+000002376    459                  PUSH_GLOBAL uint randSeed
+000002377    459                         PUSH int 7
+000002378    459                       BINARY >> uint
+000002379    459                       BINARY ~ uint
+000002380    459                       ASSIGN uint 8
+000002381    460                         PUSH ^ randSeed
+000002382    460                          DUP
+000002383    460                        DEREF uint
+000002384    460                  PUSH_GLOBAL uint randSeed
+000002385    460                         PUSH int 17
+000002386    460                       BINARY << uint
+000002387    460                       BINARY ~ uint
+000002388    460                       ASSIGN uint 8
+000002389    461                  PUSH_GLOBAL uint randSeed
+000002390    461                         PUSH int 2147483647
+000002391    461                       BINARY & uint
+000002392    461                 ASSERT_RANGE uint int
+000002393    461                      POP_REG RESULT
+000002394    462                         GOTO 2395
+
+000002395    462                  LEAVE_FRAME
+000002396    462                       RETURN 2
+
+
+Function: frand
+
+000002397    466                  ENTER_FRAME 0x558b193588e8
+000002398    465                    PUSH_ZERO 2
+000002399    465                         CALL rand (2364)
+000002400    465                     PUSH_REG RESULT
+000002401    465                 CALL_BUILTIN int makereal
+000002402    465                         PUSH real 2.14748e+09
+000002403    465                     DIV_REAL real
+000002404    465                      POP_REG RESULT
+000002405    466                         GOTO 2406
+
+000002406    466                  LEAVE_FRAME
+000002407    466                       RETURN 2
+
+
+Function: srand
+
+000002408    473                  ENTER_FRAME 0x558b19358fa8
+000002409    469                   PUSH_LOCAL int 16
+000002410    469                         PUSH int 0
+000002411    472          GOTO_IF_LESS_EQ_INT int 2420
+000002412    470                         PUSH ^ randSeed
+000002413    470                   PUSH_LOCAL int 16
+000002414    470                 ASSERT_RANGE int uint
+000002415    470                       ASSIGN uint 8
+000002416    471                    PUSH_ZERO 2
+000002417    471                         CALL rand (2364)
+000002418    471                     PUSH_REG RESULT
+000002419    471                          POP 1
+000002420    473                  LEAVE_FRAME
+000002421    473                       RETURN 3
+
+000002422    541                         GOTO 2550
+
+
+Function: time
+
+000002423    488                  ENTER_FRAME 0x558b19359b48
+000002424    487                    PUSH_ZERO 2
+000002425    487                         CALL rtltime (2422)
+000002426    488                         GOTO 2427
+
+000002427    488                  LEAVE_FRAME
+000002428    488                       RETURN 2
+
+000002429    541                         GOTO 2546
+
+
+Function: clock
+
+000002430    494                  ENTER_FRAME 0x558b193599b8
+000002431    493                    PUSH_ZERO 2
+000002432    493                         CALL rtlclock (2429)
+000002433    494                         GOTO 2434
+
+000002434    494                  LEAVE_FRAME
+000002435    494                       RETURN 2
+
+000002436    541                         GOTO 2542
+
+
+Function: localtime
+
+000002437    500                  ENTER_FRAME 0x558b1935c928
+000002438    499                    PUSH_ZERO 2
+000002439    499                   PUSH_LOCAL int 24
+000002440    499          PUSH_LOCAL_PTR_ZERO -88 72
+000002441    499                         CALL rtllocaltime (2436)
+000002442    499                     PUSH_REG RESULT
+000002443    499                   PUSH_LOCAL ^ 16
+000002444    499                  SWAP_ASSIGN struct 72
+000002445    499                   PUSH_LOCAL ^ 16
+000002446    499                      POP_REG RESULT
+000002447    500                         GOTO 2448
+
+000002448    500                  LEAVE_FRAME
+000002449    500                       RETURN 4
+
+000002450    541                         GOTO 2538
+
+
+Function: gmtime
+
+000002451    506                  ENTER_FRAME 0x558b1935d778
+000002452    505                    PUSH_ZERO 2
+000002453    505                   PUSH_LOCAL int 24
+000002454    505          PUSH_LOCAL_PTR_ZERO -88 72
+000002455    505                         CALL rtlgmtime (2450)
+000002456    505                     PUSH_REG RESULT
+000002457    505                   PUSH_LOCAL ^ 16
+000002458    505                  SWAP_ASSIGN struct 72
+000002459    505                   PUSH_LOCAL ^ 16
+000002460    505                      POP_REG RESULT
+000002461    506                         GOTO 2462
+
+000002462    506                  LEAVE_FRAME
+000002463    506                       RETURN 4
+
+000002464    541                         GOTO 2533
+
+
+Function: mktime
+
+000002465    512                  ENTER_FRAME 0x558b1935e178
+000002466    511                    PUSH_ZERO 2
+000002467    511               PUSH_LOCAL_PTR 16
+000002468    511                      REF_CNT ++ ^DateTime
+000002469    511                         CALL rtlmktime (2464)
+000002470    512                         GOTO 2471
+
+000002471    512                  LEAVE_FRAME
+000002472    512                       RETURN 11
+
+
+Function: timestr
+
+000002473    518                  ENTER_FRAME 0x558b1935ef18
+000002474    515                         PUSH int 0
+000002475    515                         PUSH ^ (nil)
+000002476    516                   PUSH_LOCAL int 56
+000002477    516                   PUSH_LOCAL int 48
+000002478    516                   PUSH_LOCAL int 40
+000002479    517                   PUSH_LOCAL int 32
+000002480    517                   PUSH_LOCAL int 24
+000002481    517                   PUSH_LOCAL int 16
+000002482    517                  CALL_PRINTF sprintf 6
+000002483    517                      POP_REG RESULT
+000002484    518                         GOTO 2485
+
+000002485    518                  LEAVE_FRAME
+000002486    518                       RETURN 11
+
+
+Function: argc
+
+000002487    524                  ENTER_FRAME 0x558b1935f1e8
+000002488    523                         PUSH ^ rtlargv
+000002489    523                 CALL_BUILTIN [] len
+000002490    523                      POP_REG RESULT
+000002491    524                         GOTO 2492
+
+000002492    524                  LEAVE_FRAME
+000002493    524                       RETURN 2
+
+
+Function: argv
+
+000002494    528                  ENTER_FRAME 0x558b1935f838
+000002495    527                         PUSH ^ rtlargv
+000002496    527                   PUSH_LOCAL int 16
+000002497    527                 GET_DYNARRAY str
+000002498    527                      REF_CNT ++ str
+000002499    527                      POP_REG RESULT
+000002500    528                         GOTO 2501
+
+000002501    528                  LEAVE_FRAME
+000002502    528                       RETURN 3
+
+000002503    541                         GOTO 2528
+
+
+Function: getenv
+
+000002504    534                  ENTER_FRAME 0x558b193604b8
+000002505    533                    PUSH_ZERO 2
+000002506    533                   PUSH_LOCAL str 16
+000002507    533                      REF_CNT ++ str
+000002508    533                         CALL rtlgetenv (2503)
+000002509    534                         GOTO 2510
+
+000002510    534                REF_CNT_LOCAL -- str 16
+000002511    534                  LEAVE_FRAME
+000002512    534                       RETURN 3
+
+000002513    541                         GOTO 2523
+
+
+Function: system
+
+000002514    540                  ENTER_FRAME 0x558b19360e38
+000002515    539                    PUSH_ZERO 2
+000002516    539                   PUSH_LOCAL str 16
+000002517    539                      REF_CNT ++ str
+000002518    539                         CALL rtlsystem (2513)
+000002519    540                         GOTO 2520
+
+000002520    540                REF_CNT_LOCAL -- str 16
+000002521    540                  LEAVE_FRAME
+000002522    540                       RETURN 3
+
+
+Function: rtlsystem
+
+000002523    541                  ENTER_FRAME 0x558b19360ea8
+000002524    541                  CALL_EXTERN 0x558af7c81b80
+000002525    541                REF_CNT_LOCAL -- str 16
+000002526    541                  LEAVE_FRAME
+000002527    541                       RETURN 3
+
+
+Function: rtlgetenv
+
+000002528    541                  ENTER_FRAME 0x558b19360f18
+000002529    541                  CALL_EXTERN 0x558af7c81b10
+000002530    541                REF_CNT_LOCAL -- str 16
+000002531    541                  LEAVE_FRAME
+000002532    541                       RETURN 3
+
+
+Function: rtlmktime
+
+000002533    541                  ENTER_FRAME 0x558b19360f88
+000002534    541                  CALL_EXTERN 0x558af7c81aa0
+000002535    541                REF_CNT_LOCAL -- ^DateTime 16
+000002536    541                  LEAVE_FRAME
+000002537    541                       RETURN 3
+
+
+Function: rtlgmtime
+
+000002538    541                  ENTER_FRAME 0x558b19361178
+000002539    541                  CALL_EXTERN 0x558af7c81a00
+000002540    541                  LEAVE_FRAME
+000002541    541                       RETURN 4
+
+
+Function: rtllocaltime
+
+000002542    541                  ENTER_FRAME 0x558b193611f8
+000002543    541                  CALL_EXTERN 0x558af7c81960
+000002544    541                  LEAVE_FRAME
+000002545    541                       RETURN 4
+
+
+Function: rtlclock
+
+000002546    541                  ENTER_FRAME 0x558b19361278
+000002547    541                  CALL_EXTERN 0x558af7c818f0
+000002548    541                  LEAVE_FRAME
+000002549    541                       RETURN 2
+
+
+Function: rtltime
+
+000002550    541                  ENTER_FRAME 0x558b193612d8
+000002551    541                  CALL_EXTERN 0x558af7c818d0
+000002552    541                  LEAVE_FRAME
+000002553    541                       RETURN 2
+
+
+Function: rtlfdclose
+
+000002554    541                  ENTER_FRAME 0x558b19361338
+000002555    541                  CALL_EXTERN 0x558af7c81880
+000002556    541                  LEAVE_FRAME
+000002557    541                       RETURN 3
+
+
+Function: rtlfdwrite
+
+000002558    541                  ENTER_FRAME 0x558b193616a8
+000002559    541                  CALL_EXTERN 0x558af7c817a0
+000002560    541                REF_CNT_LOCAL -- ^void 32
+000002561    541                  LEAVE_FRAME
+000002562    541                       RETURN 6
+
+
+Function: rtlfdread
+
+000002563    541                  ENTER_FRAME 0x558b19361748
+000002564    541                  CALL_EXTERN 0x558af7c816f0
+000002565    541                REF_CNT_LOCAL -- ^void 24
+000002566    541                  LEAVE_FRAME
+000002567    541                       RETURN 5
+
+
+Function: rtlpipe
+
+000002568    541                  ENTER_FRAME 0x558b193617d8
+000002569    541                  CALL_EXTERN 0x558af7c81610
+000002570    541                REF_CNT_LOCAL -- ^[2]int 16
+000002571    541                  LEAVE_FRAME
+000002572    541                       RETURN 3
+
+
+Function: rtlfwrite
+
+000002573    541                  ENTER_FRAME 0x558b19361848
+000002574    541                  CALL_EXTERN 0x558af7c81330
+000002575    541                REF_CNT_LOCAL -- File 16
+000002576    541                REF_CNT_LOCAL -- ^void 40
+000002577    541                  LEAVE_FRAME
+000002578    541                       RETURN 6
+
+
+Function: rtlfread
+
+000002579    541                  ENTER_FRAME 0x558b193618e8
+000002580    541                  CALL_EXTERN 0x558af7c81280
+000002581    541                REF_CNT_LOCAL -- File 16
+000002582    541                REF_CNT_LOCAL -- ^void 40
+000002583    541                  LEAVE_FRAME
+000002584    541                       RETURN 6
+
+
+Function: rtlfflush
+
+000002585    541                  ENTER_FRAME 0x558b19361988
+000002586    541                  CALL_EXTERN 0x558af7c815c0
+000002587    541                REF_CNT_LOCAL -- File 16
+000002588    541                  LEAVE_FRAME
+000002589    541                       RETURN 3
+
+
+Function: rtlfeof
+
+000002590    541                  ENTER_FRAME 0x558b193619f8
+000002591    541                  CALL_EXTERN 0x558af7c81550
+000002592    541                REF_CNT_LOCAL -- File 16
+000002593    541                  LEAVE_FRAME
+000002594    541                       RETURN 3
+
+
+Function: rtlremove
+
+000002595    541                  ENTER_FRAME 0x558b19361a68
+000002596    541                  CALL_EXTERN 0x558af7c81500
+000002597    541                REF_CNT_LOCAL -- str 16
+000002598    541                  LEAVE_FRAME
+000002599    541                       RETURN 3
+
+
+Function: rtlftell
+
+000002600    541                  ENTER_FRAME 0x558b19361ad8
+000002601    541                  CALL_EXTERN 0x558af7c81490
+000002602    541                REF_CNT_LOCAL -- File 16
+000002603    541                  LEAVE_FRAME
+000002604    541                       RETURN 3
+
+
+Function: rtlfseek
+
+000002605    541                  ENTER_FRAME 0x558b19361b48
+000002606    541                  CALL_EXTERN 0x558af7c813e0
+000002607    541                REF_CNT_LOCAL -- File 32
+000002608    541                  LEAVE_FRAME
+000002609    541                       RETURN 5
+
+
+Function: rtlfclose
+
+000002610    541                  ENTER_FRAME 0x558b19361bd8
+000002611    541                  CALL_EXTERN 0x558af7c81200
+000002612    541                REF_CNT_LOCAL -- File 16
+000002613    541                  LEAVE_FRAME
+000002614    541                       RETURN 3
+
+
+Function: rtlfopen
+
+000002615    541                  ENTER_FRAME 0x558b19361c48
+000002616    541                  CALL_EXTERN 0x558af7c81160
+000002617    541                REF_CNT_LOCAL -- str 16
+000002618    541                REF_CNT_LOCAL -- str 24
+000002619    541                  LEAVE_FRAME
+000002620    541                       RETURN 4
+
+
+Function: rtlstderr
+
+000002621    541                  ENTER_FRAME 0x558b19361cc8
+000002622    541                  CALL_EXTERN 0x558af7c81130
+000002623    541                  LEAVE_FRAME
+000002624    541                       RETURN 2
+
+
+Function: rtlstdout
+
+000002625    541                  ENTER_FRAME 0x558b19361d28
+000002626    541                  CALL_EXTERN 0x558af7c81100
+000002627    541                  LEAVE_FRAME
+000002628    541                       RETURN 2
+
+
+Function: rtlstdin
+
+000002629    541                  ENTER_FRAME 0x558b19361d88
+000002630    541                  CALL_EXTERN 0x558af7c810d0
+000002631    541                  LEAVE_FRAME
+000002632    541                       RETURN 2
+
+
+Function: rtlheapsnapshot
+
+000002633    541                  ENTER_FRAME 0x558b19361de8
+000002634    541                  CALL_EXTERN 0x558af7c81cc0
+000002635    541                REF_CNT_LOCAL -- ^[]HeapSite 16
+000002636    541                  LEAVE_FRAME
+000002637    541                       RETURN 3
+
+
+Function: rtlmemcpy
+
+000002638    541                  ENTER_FRAME 0x558b19361e58
+000002639    541                  CALL_EXTERN 0x558af7c81090
+000002640    541                REF_CNT_LOCAL -- ^void 24
+000002641    541                REF_CNT_LOCAL -- ^void 32
+000002642    541                  LEAVE_FRAME
+000002643    541                       RETURN 5
+
+
+Function: rtltrace
+
+000002644    541                  ENTER_FRAME 0x558b19361ee8
+000002645    541                  CALL_EXTERN 0x558af7c81bd0
+000002646    541                REF_CNT_LOCAL -- ^ErrPos 16
+000002647    541                  LEAVE_FRAME
+000002648    541                       RETURN 4
+
+
+Module: /root/repo/benchmarks/sched.um
+
+000002649     32                         GOTO 2704
+
+
+Function: spawn
+
+000002650     10                  ENTER_FRAME 0x558b19337478
+000002651      7               PUSH_LOCAL_PTR 24
+000002652      7                   PUSH_LOCAL int 16
+000002653      7                 CALL_BUILTIN fiber make
+000002654      7               PUSH_LOCAL_PTR -32
+000002655      7                  SWAP_ASSIGN fiber 8
+000002656      8                    PUSH_ZERO 2
+000002657      8                   PUSH_LOCAL fiber -32
+000002658      8                      REF_CNT ++ fiber
+000002659      8                         CALL rtlspawn (2649)
+000002660      9                   PUSH_LOCAL fiber -32
+000002661      9                      REF_CNT ++ fiber
+000002662      9                      POP_REG RESULT
+000002663      9                REF_CNT_LOCAL -- fiber -32
+000002664     10                         GOTO 2666
+
+000002665     10                REF_CNT_LOCAL -- fiber -32
+
+000002666     10                REF_CNT_LOCAL -- fn () |...| 24
+000002667     10                  LEAVE_FRAME
+000002668     10                       RETURN 6
+
+000002669     32                         GOTO 2700
+
+
+Function: yield
+
+000002670     17                  ENTER_FRAME 0x558b193379b8
+000002671     16                    PUSH_ZERO 2
+000002672     16                         CALL rtlyield (2669)
+000002673     17                  LEAVE_FRAME
+000002674     17                       RETURN 2
+
+000002675     32                         GOTO 2696
+
+
+Function: sleep
+
+000002676     24                  ENTER_FRAME 0x558b19364948
+000002677     23                    PUSH_ZERO 2
+000002678     23                   PUSH_LOCAL real 16
+000002679     23                         CALL rtlsleep (2675)
+000002680     24                  LEAVE_FRAME
+000002681     24                       RETURN 3
+
+000002682     32                         GOTO 2691
+
+
+Function: join
+
+000002683     31                  ENTER_FRAME 0x558b19365448
+000002684     30                    PUSH_ZERO 2
+000002685     30                   PUSH_LOCAL fiber 16
+000002686     30                      REF_CNT ++ fiber
+000002687     30                         CALL rtljoin (2682)
+000002688     31                REF_CNT_LOCAL -- fiber 16
+000002689     31                  LEAVE_FRAME
+000002690     31                       RETURN 3
+
+
+Function: rtljoin
+
+000002691     32                  ENTER_FRAME 0x558b193654b8
+000002692     32                  CALL_EXTERN 0x558af7c81e30
+000002693     32                REF_CNT_LOCAL -- fiber 16
+000002694     32                  LEAVE_FRAME
+000002695     32                       RETURN 3
+
+
+Function: rtlsleep
+
+000002696     32                  ENTER_FRAME 0x558b19365528
+000002697     32                  CALL_EXTERN 0x558af7c81e10
+000002698     32                  LEAVE_FRAME
+000002699     32                       RETURN 3
+
+
+Function: rtlyield
+
+000002700     32                  ENTER_FRAME 0x558b19365598
+000002701     32                  CALL_EXTERN 0x558af7c81e00
+000002702     32                  LEAVE_FRAME
+000002703     32                       RETURN 2
+
+
+Function: rtlspawn
+
+000002704     32                  ENTER_FRAME 0x558b193655f8
+000002705     32                  CALL_EXTERN 0x558af7c81de0
+000002706     32                REF_CNT_LOCAL -- fiber 16
+000002707     32                  LEAVE_FRAME
+000002708     32                       RETURN 3
+
+
+Module: /root/repo/benchmarks/pipes.um
+
+
+Function: writer
+
+000002709     16                  ENTER_FRAME 0x558b19337c78
+000002710      9                         PUSH int 4096
+000002711      9               PUSH_LOCAL_PTR -40
+000002712      9                 CALL_BUILTIN []char make
+000002713      9               PUSH_LOCAL_PTR -88
+000002714      9                  SWAP_ASSIGN [] 24
+000002715     10                         PUSH int 0
+000002716     10               PUSH_LOCAL_PTR -96
+000002717     10                  SWAP_ASSIGN int 8
+
+000002718     10                   PUSH_LOCAL int -96
+000002719     10                   PUSH_LOCAL int 16
+000002720     14       GOTO_IF_GREATER_EQ_INT int 2765
+000002721     11               PUSH_LOCAL_PTR -88
+000002722     11                         PUSH int 0
+000002723     11             GET_DYNARRAY_PTR
+000002724     11                   PUSH_LOCAL int -96
+000002725     11                         PUSH int 256
+000002726     11                       BINARY % int
+000002727     11                 ASSERT_RANGE int char
+000002728     11                       ASSIGN char 1
+000002729     12                    PUSH_ZERO 2
+000002730     12                   PUSH_LOCAL int 24
+000002731     12               PUSH_LOCAL_PTR -88
+000002732     12               PUSH_LOCAL_PTR -112
+000002733     12                  SWAP_ASSIGN ^ 0
+000002734     12                         PUSH ^ 0x558b193666c8
+000002735     12               PUSH_LOCAL_PTR -104
+000002736     12                  SWAP_ASSIGN ^ 0
+000002737     12               PUSH_LOCAL_PTR -112
+000002738     12                      REF_CNT ++ interface
+000002739     12                 ASSIGN_PARAM interface 16
+000002740     12          PUSH_LOCAL_PTR_ZERO -176 64
+000002741     12                         CALL fdwrite (1963)
+000002742     12                     PUSH_REG RESULT
+000002743     12                          DUP
+000002744     12               PUSH_LOCAL_PTR -240
+000002745     12                  SWAP_ASSIGN struct 64
+000002746     12                          DUP
+000002747     12                        DEREF int
+000002748     12               PUSH_LOCAL_PTR -248
+000002749     12                  SWAP_ASSIGN int 8
+000002750     12                          DUP
+000002751     12                    GET_FIELD struct 8
+000002752     12                      REF_CNT ++ Err
+000002753     12               PUSH_LOCAL_PTR -304
+000002754     12                  SWAP_ASSIGN struct 56
+000002755     12                          POP 1
+000002756     13                    PUSH_ZERO 2
+000002757     13               PUSH_LOCAL_PTR -304
+000002758     13                      REF_CNT ++ Err
+000002759     13                 ASSIGN_PARAM struct 56
+000002760     13                         CALL exitif (105)
+000002761     14                REF_CNT_LOCAL -- Err -304
+000002762     14                REF_CNT_LOCAL -- { int Err } -240
+000002763     14                INC_LOCAL_INT -96
+000002764     14                         GOTO 2718
+
+000002765     15                    PUSH_ZERO 4
+000002766     15                   PUSH_LOCAL int 24
+000002767     15          PUSH_LOCAL_PTR_ZERO -360 56
+000002768     15                         CALL fdclose (2108)
+000002769     15                     PUSH_REG RESULT
+000002770     15                 ASSIGN_PARAM struct 56
+000002771     15                         CALL exitif (105)
+000002772     16                REF_CNT_LOCAL -- []char -88
+000002773     16                  LEAVE_FRAME
+000002774     16                       RETURN 4
+
+
+Function: reader
+
+000002775     28                  ENTER_FRAME 0x558b19365d18
+000002776     19                         PUSH int 16384
+000002777     19               PUSH_LOCAL_PTR -40
+000002778     19                 CALL_BUILTIN []char make
+000002779     19               PUSH_LOCAL_PTR -88
+000002780     19                  SWAP_ASSIGN [] 24
+
+000002781     20                         PUSH int 1
+000002782     26                  GOTO_IF_NOT 2825
+
+000002783     21                    PUSH_ZERO 2
+000002784     21                   PUSH_LOCAL int 24
+000002785     21               PUSH_LOCAL_PTR -88
+000002786     21               PUSH_LOCAL_PTR -104
+000002787     21                  SWAP_ASSIGN ^ 0
+000002788     21                         PUSH ^ 0x558b19366fd8
+000002789     21               PUSH_LOCAL_PTR -96
+000002790     21                  SWAP_ASSIGN ^ 0
+000002791     21               PUSH_LOCAL_PTR -104
+000002792     21                      REF_CNT ++ interface
+000002793     21                 ASSIGN_PARAM interface 16
+000002794     21          PUSH_LOCAL_PTR_ZERO -168 64
+000002795     21                         CALL fdread (1797)
+000002796     21                     PUSH_REG RESULT
+000002797     21                          DUP
+000002798     21               PUSH_LOCAL_PTR -232
+000002799     21                  SWAP_ASSIGN struct 64
+000002800     21                          DUP
+000002801     21                        DEREF int
+000002802     21               PUSH_LOCAL_PTR -240
+000002803     21                  SWAP_ASSIGN int 8
+000002804     21                          DUP
+000002805     21                    GET_FIELD struct 8
+000002806     21                      REF_CNT ++ Err
+000002807     21               PUSH_LOCAL_PTR -296
+000002808     21                  SWAP_ASSIGN struct 56
+000002809     21                          POP 1
+000002810     22                   PUSH_LOCAL int -296
+000002811     22                         PUSH int 0
+000002812     24               GOTO_IF_EQ_INT int 2816
+000002813     23                REF_CNT_LOCAL -- Err -296
+000002814     23                REF_CNT_LOCAL -- { int Err } -232
+000002815     26                         GOTO 2825
+
+000002816     25                   PUSH_LOCAL ^ 16
+000002817     25                          DUP
+000002818     25                        DEREF int
+000002819     25                   PUSH_LOCAL int -240
+000002820     25                      ADD_INT int
+000002821     25                       ASSIGN int 8
+000002822     26                REF_CNT_LOCAL -- Err -296
+000002823     26                REF_CNT_LOCAL -- { int Err } -232
+000002824     26                         GOTO 2781
+
+000002825     27                    PUSH_ZERO 4
+000002826     27                   PUSH_LOCAL int 24
+000002827     27          PUSH_LOCAL_PTR_ZERO -352 56
+000002828     27                         CALL fdclose (2108)
+000002829     27                     PUSH_REG RESULT
+000002830     27                 ASSIGN_PARAM struct 56
+000002831     27                         CALL exitif (105)
+000002832     28                REF_CNT_LOCAL -- []char -88
+000002833     28                REF_CNT_LOCAL -- ^int 16
+000002834     28                  LEAVE_FRAME
+000002835     28                       RETURN 4
+
+
+Function: test
+
+000002836     48                  ENTER_FRAME 0x558b19366318
+000002837     31                 CALL_BUILTIN int new
+000002838     31               PUSH_LOCAL_PTR -32
+000002839     31                  SWAP_ASSIGN ^ 8
+000002840     32                   PUSH_LOCAL int 24
+000002841     32               PUSH_LOCAL_PTR -56
+000002842     32                 CALL_BUILTIN []fiber make
+000002843     32               PUSH_LOCAL_PTR -104
+000002844     32                  SWAP_ASSIGN [] 24
+000002845     34                         PUSH int 0
+000002846     34               PUSH_LOCAL_PTR -112
+000002847     34                  SWAP_ASSIGN int 8
+
+000002848     34                   PUSH_LOCAL int -112
+000002849     34                   PUSH_LOCAL int 24
+000002850     40       GOTO_IF_GREATER_EQ_INT int 3003
+000002851     35                    PUSH_ZERO 2
+000002852     35          PUSH_LOCAL_PTR_ZERO -184 72
+000002853     35                         CALL pipe (1724)
+000002854     35                     PUSH_REG RESULT
+000002855     35                          DUP
+000002856     35               PUSH_LOCAL_PTR -256
+000002857     35                  SWAP_ASSIGN struct 72
+000002858     35                          DUP
+000002859     35                        DEREF int
+000002860     35               PUSH_LOCAL_PTR -264
+000002861     35                  SWAP_ASSIGN int 8
+000002862     35                          DUP
+000002863     35                    GET_FIELD int 8
+000002864     35               PUSH_LOCAL_PTR -272
+000002865     35                  SWAP_ASSIGN int 8
+000002866     35                          DUP
+000002867     35                    GET_FIELD struct 16
+000002868     35                      REF_CNT ++ Err
+000002869     35               PUSH_LOCAL_PTR -328
+000002870     35                  SWAP_ASSIGN struct 56
+000002871     35                          POP 1
+000002872     36                    PUSH_ZERO 2
+000002873     36               PUSH_LOCAL_PTR -328
+000002874     36                      REF_CNT ++ Err
+000002875     36                 ASSIGN_PARAM struct 56
+000002876     36                         CALL exitif (105)
+000002877     38               PUSH_LOCAL_PTR -104
+000002878     38                   PUSH_LOCAL int -112
+000002879     38             GET_DYNARRAY_PTR
+000002880     38                    PUSH_ZERO 2
+000002881     38               PUSH_LOCAL_PTR -352
+000002882     38                         ZERO 24
+000002883     38          PUSH_LOCAL_PTR_ZERO -368 16
+000002884     38                GET_FIELD_PTR 0
+000002885     38                   PUSH_LOCAL int -264
+000002886     38                       ASSIGN int 8
+000002887     38               PUSH_LOCAL_PTR -360
+000002888     38                   PUSH_LOCAL ^ -32
+000002889     38               REF_CNT_ASSIGN ^int
+000002890     38               PUSH_LOCAL_PTR -344
+000002891     38                   PUSH_LOCAL struct -368
+000002892     38                 CALL_BUILTIN struct new
+000002893     38                          DUP
+000002894     38                      POP_REG HEAP_COPY
+000002895     38          SWAP_REF_CNT_ASSIGN struct
+000002896     38                     PUSH_REG HEAP_COPY
+000002897     38               PUSH_LOCAL_PTR -384
+000002898     38                  SWAP_ASSIGN ^ 0
+000002899     38                         PUSH ^ 0x558b19368b18
+000002900     38               PUSH_LOCAL_PTR -376
+000002901     38                  SWAP_ASSIGN ^ 0
+000002902     38               PUSH_LOCAL_PTR -384
+000002903     38                       ASSIGN interface 16
+000002904     38                         GOTO 2927
+
+
+Function: <unknown>
+
+000002905     38                  ENTER_FRAME 0x558b19369458
+000002906     38                   PUSH_LOCAL interface 16
+000002907     38                  ASSERT_TYPE ^struct
+000002908     38                        DEREF struct
+000002909     38                          DUP
+000002910     38                        DEREF int
+000002911     38          PUSH_LOCAL_PTR_ZERO -24 8
+000002912     38                  SWAP_ASSIGN int 8
+000002913     38                          DUP
+000002914     38                    GET_FIELD ^ 8
+000002915     38          PUSH_LOCAL_PTR_ZERO -32 8
+000002916     38          SWAP_REF_CNT_ASSIGN ^int
+000002917     38                          POP 1
+000002918     38                    PUSH_ZERO 2
+000002919     38                   PUSH_LOCAL int -24
+000002920     38                   PUSH_LOCAL ^ -32
+000002921     38                      REF_CNT ++ ^int
+000002922     38                         CALL reader (2775)
+000002923     38                REF_CNT_LOCAL -- ^int -32
+000002924     38                REF_CNT_LOCAL -- interface 16
+000002925     38                  LEAVE_FRAME
+000002926     38                       RETURN 2
+
+000002927     38               PUSH_LOCAL_PTR -352
+000002928     38                         PUSH int 2905
+000002929     38                       ASSIGN fn 8
+000002930     38               PUSH_LOCAL_PTR -352
+000002931     38                      REF_CNT ++ fn () |...|
+000002932     38                 ASSIGN_PARAM fn |..| 24
+000002933     38                         PUSH int 0
+000002934     38                         CALL spawn (2650)
+000002935     38                     PUSH_REG RESULT
+000002936     38               REF_CNT_ASSIGN -- fiber
+000002937     39                    PUSH_ZERO 2
+000002938     39               PUSH_LOCAL_PTR -432
+000002939     39                         ZERO 24
+000002940     39          PUSH_LOCAL_PTR_ZERO -448 16
+000002941     39                GET_FIELD_PTR 0
+000002942     39                   PUSH_LOCAL int -272
+000002943     39                       ASSIGN int 8
+000002944     39               PUSH_LOCAL_PTR -440
+000002945     39                   PUSH_LOCAL int 16
+000002946     39                       ASSIGN int 8
+000002947     39               PUSH_LOCAL_PTR -424
+000002948     39                   PUSH_LOCAL struct -448
+000002949     39                 CALL_BUILTIN struct new
+000002950     39                          DUP
+000002951     39                      POP_REG HEAP_COPY
+000002952     39                  SWAP_ASSIGN struct 16
+000002953     39                     PUSH_REG HEAP_COPY
+000002954     39               PUSH_LOCAL_PTR -464
+000002955     39                  SWAP_ASSIGN ^ 0
+000002956     39                         PUSH ^ 0x558b193697b8
+000002957     39               PUSH_LOCAL_PTR -456
+000002958     39                  SWAP_ASSIGN ^ 0
+000002959     39               PUSH_LOCAL_PTR -464
+000002960     39                       ASSIGN interface 16
+000002961     39                         GOTO 2982
+
+
+Function: <unknown>
+
+000002962     39                  ENTER_FRAME 0x558b1936a0f8
+000002963     39                   PUSH_LOCAL interface 16
+000002964     39                  ASSERT_TYPE ^struct
+000002965     39                        DEREF struct
+000002966     39                          DUP
+000002967     39                        DEREF int
+000002968     39          PUSH_LOCAL_PTR_ZERO -24 8
+000002969     39                  SWAP_ASSIGN int 8
+000002970     39                          DUP
+000002971     39                    GET_FIELD int 8
+000002972     39          PUSH_LOCAL_PTR_ZERO -32 8
+000002973     39                  SWAP_ASSIGN int 8
+000002974     39                          POP 1
+000002975     39                    PUSH_ZERO 2
+000002976     39                   PUSH_LOCAL int -24
+000002977     39                   PUSH_LOCAL int -32
+000002978     39                         CALL writer (2709)
+000002979     39                REF_CNT_LOCAL -- interface 16
+000002980     39                  LEAVE_FRAME
+000002981     39                       RETURN 2
+
+000002982     39               PUSH_LOCAL_PTR -432
+000002983     39                         PUSH int 2962
+000002984     39                       ASSIGN fn 8
+000002985     39               PUSH_LOCAL_PTR -432
+000002986     39                      REF_CNT ++ fn () |...|
+000002987     39                 ASSIGN_PARAM fn |..| 24
+000002988     39                         PUSH int 0
+000002989     39                         CALL spawn (2650)
+000002990     39                     PUSH_REG RESULT
+000002991     39                          DUP
+000002992     39               PUSH_LOCAL_PTR -488
+000002993     39                  SWAP_ASSIGN fiber 8
+000002994     39                          POP 1
+000002995     40                REF_CNT_LOCAL -- fiber -488
+000002996     40                REF_CNT_LOCAL -- fn () |...| -432
+000002997     40                REF_CNT_LOCAL -- struct -368
+000002998     40                REF_CNT_LOCAL -- fn () |...| -352
+000002999     40                REF_CNT_LOCAL -- Err -328
+000003000     40                REF_CNT_LOCAL -- { int int Err } -256
+000003001     40                INC_LOCAL_INT -112
+000003002     40                         GOTO 2848
+
+000003003     42                         PUSH int 0
+000003004     42               PUSH_LOCAL_PTR -496
+000003005     42                  SWAP_ASSIGN int 8
+
+000003006     42                   PUSH_LOCAL int -496
+000003007     42                   PUSH_LOCAL int 24
+000003008     44       GOTO_IF_GREATER_EQ_INT int 3017
+000003009     43                    PUSH_ZERO 2
+000003010     43               PUSH_LOCAL_PTR -104
+000003011     43                   PUSH_LOCAL int -496
+000003012     43                 GET_DYNARRAY fiber
+000003013     43                      REF_CNT ++ fiber
+000003014     43                         CALL join (2683)
+000003015     44                INC_LOCAL_INT -496
+000003016     44                         GOTO 3006
+
+000003017     46                    PUSH_ZERO 2
+000003018     46                   PUSH_LOCAL ^ -32
+000003019     46                        DEREF int
+000003020     46                   PUSH_LOCAL int 24
+000003021     46                   PUSH_LOCAL int 16
+000003022     46                      MUL_INT int
+000003023     46                         PUSH int 4096
+000003024     46                      MUL_INT int
+000003025     46                       EQ_INT int
+000003026     46                 ASSIGN_PARAM bool 1
+000003027     46                         PUSH ^ 0x558b1933f0e0
+000003028     46                         CALL assert (182)
+000003029     47                         PUSH int 0
+000003030     47                         PUSH ^ (nil)
+000003031     47                  CALL_PRINTF printf 0
+000003032     47                          POP 1
+000003033     48                REF_CNT_LOCAL -- []fiber -104
+000003034     48                REF_CNT_LOCAL -- ^int -32
+000003035     48                  LEAVE_FRAME
+000003036     48                       RETURN 4
+
+
+Function: main
+
+000003037     55                  ENTER_FRAME 0x558b19367048
+000003038     51                    PUSH_ZERO 2
+000003039     51                         CALL clock (2430)
+000003040     51                     PUSH_REG RESULT
+000003041     51               PUSH_LOCAL_PTR -24
+000003042     51                  SWAP_ASSIGN real 8
+000003043     52                    PUSH_ZERO 2
+000003044     52                         PUSH int 500
+000003045     52                         PUSH int 1000
+000003046     52                         CALL test (2836)
+000003047     53                    PUSH_ZERO 2
+000003048     53                         CALL clock (2430)
+000003049     53                     PUSH_REG RESULT
+000003050     53               PUSH_LOCAL_PTR -32
+000003051     53                  SWAP_ASSIGN real 8
+000003052     54                         PUSH int 0
+000003053     54                         PUSH ^ (nil)
+000003054     54                         PUSH int 2048000000
+000003055     54                   PUSH_LOCAL real -32
+000003056     54                   PUSH_LOCAL real -24
+000003057     54                     SUB_REAL real
+000003058     54                 CALL_BUILTIN int makerealleft
+000003059     54                     DIV_REAL real
+000003060     54                         PUSH real 1e+06
+000003061     54                     DIV_REAL real
+000003062     54                  CALL_PRINTF printf 1
+000003063     54                          POP 1
+000003064     55                  LEAVE_FRAME
+000003065     55                       RETURN 2
+
+000003066     56               REF_CNT_GLOBAL -- [15]str fopenModes
+000003067     56               REF_CNT_GLOBAL -- []str stdErrMsg
+000003068     56               REF_CNT_GLOBAL -- []str rtlargv
+000003069     56                         HALT
\ No newline at end of file
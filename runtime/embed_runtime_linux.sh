@@ -1,2 +1,2 @@
-../umka_linux/umka um2h.um std.um fnc.um mat.um utf8.um
+../umka_linux/umka um2h.um std.um fnc.um mat.um utf8.um sched.um
 cp umka_runtime_src.h ../src
@@ -1,2 +1,2 @@
-..\umka_windows_mingw\umka.exe um2h.um std.um fnc.um mat.um utf8.um
+..\umka_windows_mingw\umka.exe um2h.um std.um fnc.um mat.um utf8.um sched.um
 copy umka_runtime_src.h ..\src
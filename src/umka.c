@@ -15,20 +15,45 @@ enum
 };
 
 
+static const double PROFILER_INTERVAL = 0.001;   // Seconds
+
+
 void help(void)
 {
     printf("%s\n", umkaGetVersion());
     printf("(C) Vasiliy Tereshkov, 2020-2026\n");
-    printf("Usage: umka [<parameters>] <file.um> [<script-parameters>]\n");
+    printf("Usage: umka [<parameters>] <file.um | file.umc> [<script-parameters>]\n");
     printf("Parameters:\n");
     printf("    -stack <stack-size>     - Set stack size\n");
     printf("    -asm                    - Write assembly listing\n");
+    printf("    -profile <file>         - Write sampling profile as folded stacks\n");
     printf("    -check                  - Compile only\n");
+    printf("    -compile <file.umc>     - Compile only and write precompiled image\n");
     printf("    -warn                   - Enable warnings\n");
     printf("    -sandbox                - Run in sandbox mode\n");
 }
 
 
+bool writeTextFile(const char *fileName, const char *buf)
+{
+    bool ok = false;
+
+    FILE *file = fopen(fileName, "w");
+    if (!file)
+        fprintf(stderr, "Error: Cannot open file %s\n", fileName);
+    else
+    {
+        if (buf[0] && fwrite(buf, strlen(buf), 1, file) != 1)
+            fprintf(stderr, "Error: Cannot write file %s\n", fileName);
+        else
+            ok = true;
+        fclose(file);
+    }
+
+    return ok;
+}
+
+
 bool writeAsmFile(Umka *umka, const char *mainPath)
 {
     bool ok = false;
@@ -43,19 +68,7 @@ bool writeAsmFile(Umka *umka, const char *mainPath)
         if (!asmBuf)
             fprintf(stderr, "Error: Cannot output assembly listing\n");
         else
-        {
-            FILE *asmFile = fopen(asmFileName, "w");
-            if (!asmFile)
-                fprintf(stderr, "Error: Cannot open file %s\n", asmFileName);
-            else
-            {
-                if (fwrite(asmBuf, strlen(asmBuf), 1, asmFile) != 1)
-                    fprintf(stderr, "Error: Cannot write file %s\n", asmFileName);
-                else
-                    ok = true;
-                fclose(asmFile);
-            }
-        }
+            ok = writeTextFile(asmFileName, asmBuf);
         free(asmFileName);
     }
 
@@ -63,6 +76,26 @@ bool writeAsmFile(Umka *umka, const char *mainPath)
 }
 
 
+bool isImageFile(const char *fileName)
+{
+    const char *ext = strrchr(fileName, '.');
+    return ext && strcmp(ext, ".umc") == 0;
+}
+
+
+bool writeProfileFile(Umka *umka, const char *profilePath)
+{
+    const char *profileBuf = umkaStopProfiler(umka);
+    if (!profileBuf)
+    {
+        fprintf(stderr, "Error: Cannot output profile\n");
+        return false;
+    }
+
+    return writeTextFile(profilePath, profileBuf);
+}
+
+
 void printCompileWarning(UmkaError *warning)
 {
     fprintf(stderr, "Warning %s (%d, %d): %s\n", warning->fileName, warning->line, warning->pos, warning->msg);
@@ -131,7 +164,9 @@ int main(int argc, char **argv)
     // Parse interpreter parameters
     int stackSize       = DEFAULT_STACK_SIZE;
     bool writeAsm       = false;
+    const char *profilePath = NULL;
     bool compileOnly    = false;
+    const char *imagePath = NULL;
     bool printWarnings  = false;
     bool isSandbox      = false;
 
@@ -160,11 +195,34 @@ int main(int argc, char **argv)
             writeAsm = true;
             i += 1;
         }
+        else if (strcmp(argv[i], "-profile") == 0)
+        {
+            if (i + 1 == argc)
+            {
+                fprintf(stderr, "No profile file name\n");
+                return 1;
+            }
+
+            profilePath = argv[i + 1];
+            i += 2;
+        }
         else if (strcmp(argv[i], "-check") == 0)
         {
             compileOnly = true;
             i += 1;
         }
+        else if (strcmp(argv[i], "-compile") == 0)
+        {
+            if (i + 1 == argc)
+            {
+                fprintf(stderr, "No image file name\n");
+                return 1;
+            }
+
+            imagePath = argv[i + 1];
+            compileOnly = true;
+            i += 2;
+        }
         else if (strcmp(argv[i], "-warn") == 0)
         {
             printWarnings = true;
@@ -186,21 +244,39 @@ int main(int argc, char **argv)
         return 1;
     }
 
+    // A precompiled image is loaded instead of being compiled, so its source is never read
+    const bool isImage = isImageFile(argv[i]);
+
     Umka *umka = umkaAlloc();
-    bool ok = umkaInit(umka, argv[i], NULL, stackSize, NULL, argc - i, argv + i, !isSandbox, !isSandbox, printWarnings ? printCompileWarning : NULL);
+    bool ok = umkaInit(umka, argv[i], isImage ? "" : NULL, stackSize, NULL, argc - i, argv + i, !isSandbox, !isSandbox, printWarnings ? printCompileWarning : NULL);
     int exitCode = 0;
 
     if (ok)
-        ok = umkaCompile(umka);
+        ok = isImage ? umkaLoadImage(umka, argv[i]) : umkaCompile(umka);
 
     if (ok)
     {
         if (writeAsm)
             ok = writeAsmFile(umka, argv[i]);
 
+        if (ok && imagePath)
+        {
+            ok = umkaSaveImage(umka, imagePath);
+            if (!ok)
+                printCompileError(umka);
+        }
+
         if (ok && !compileOnly)
+        {
+            if (profilePath)
+                umkaStartProfiler(umka, PROFILER_INTERVAL);
+
             exitCode = umkaRun(umka);
 
+            if (profilePath && !writeProfileFile(umka, profilePath) && !exitCode)
+                exitCode = 1;
+        }
+
         if (exitCode)
             printRuntimeError(umka);
     }
@@ -100,6 +100,47 @@ UMKA_API bool umkaCompile(Umka *umka)
 }
 
 
+UMKA_API bool umkaSaveImage(Umka *umka, const char *fileName)
+{
+    if (setjmp(umka->error.jumper) == 0)
+    {
+        compilerSaveImage(umka, fileName);
+        return true;
+    }
+    return false;
+}
+
+
+UMKA_API bool umkaLoadImage(Umka *umka, const char *fileName)
+{
+    if (setjmp(umka->error.jumper) == 0)
+    {
+        compilerLoadImage(umka, fileName);
+        return true;
+    }
+    return false;
+}
+
+
+UMKA_API bool umkaClone(Umka *umka, Umka *clone)
+{
+    memset(clone, 0, sizeof(Umka));
+
+    clone->error.handler = compileError;
+    clone->error.runtimeHandler = runtimeError;
+    clone->error.warningHandler = compileWarning;
+    clone->error.warningCallback = umka->error.warningCallback;
+    clone->error.context = clone;
+
+    if (setjmp(clone->error.jumper) == 0)
+    {
+        compilerClone(clone, umka);
+        return true;
+    }
+    return false;
+}
+
+
 UMKA_API int umkaRun(Umka *umka)
 {
     if (setjmp(umka->error.jumper) == 0)
@@ -206,6 +247,24 @@ UMKA_API void umkaSetHook(Umka *umka, UmkaHookEvent event, UmkaHookFunc hook)
 }
 
 
+UMKA_API bool umkaStartProfiler(Umka *umka, double interval)
+{
+    return vmStartProfiler(&umka->vm, interval);
+}
+
+
+UMKA_API char *umkaStopProfiler(Umka *umka)
+{
+    return vmStopProfiler(&umka->vm);
+}
+
+
+UMKA_API int umkaGetHeapSnapshot(Umka *umka, UmkaHeapSite *sites, int maxSites)
+{
+    return vmGetHeapSnapshot(&umka->vm, sites, maxSites);
+}
+
+
 UMKA_API void *umkaAllocData(Umka *umka, int size, UmkaExternFunc onFree)
 {
     return vmAllocData(&umka->vm, size, onFree);
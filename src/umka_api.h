@@ -118,6 +118,16 @@ typedef struct
 } UmkaError;
 
 
+typedef struct
+{
+    const char *fileName;
+    const char *fnName;
+    int line;
+    const UmkaType *type;           // Type of the allocated data, NULL if unknown
+    int64_t numChunks, size;        // Live heap chunks and their total size in bytes
+} UmkaHeapSite;
+
+
 typedef void (*UmkaWarningCallback)(UmkaError *warning);
 
 
@@ -159,6 +169,12 @@ typedef const UmkaType *(*UmkaGetFieldType)     (const UmkaType *structType, con
 typedef const UmkaType *(*UmkaGetMapKeyType)    (const UmkaType *mapType);
 typedef const UmkaType *(*UmkaGetMapItemType)   (const UmkaType *mapType);
 typedef bool (*UmkaAddClosure)                  (Umka *umka, const char *name, UmkaExternFunc func, void *upvalue);
+typedef bool (*UmkaStartProfiler)               (Umka *umka, double interval);
+typedef char *(*UmkaStopProfiler)               (Umka *umka);
+typedef int  (*UmkaGetHeapSnapshot)             (Umka *umka, UmkaHeapSite *sites, int maxSites);
+typedef bool (*UmkaSaveImage)                   (Umka *umka, const char *fileName);
+typedef bool (*UmkaLoadImage)                   (Umka *umka, const char *fileName);
+typedef bool (*UmkaClone)                       (Umka *umka, Umka *clone);
 
 
 typedef struct
@@ -201,6 +217,12 @@ typedef struct
     UmkaGetMapKeyType   umkaGetMapKeyType;
     UmkaGetMapItemType  umkaGetMapItemType;
     UmkaAddClosure      umkaAddClosure;   
+    UmkaStartProfiler   umkaStartProfiler;
+    UmkaStopProfiler    umkaStopProfiler;
+    UmkaGetHeapSnapshot umkaGetHeapSnapshot;
+    UmkaSaveImage       umkaSaveImage;
+    UmkaLoadImage       umkaLoadImage;
+    UmkaClone           umkaClone;
 } UmkaAPI;
 
 
@@ -242,6 +264,12 @@ UMKA_API const UmkaType *umkaGetFieldType   (const UmkaType *structType, const c
 UMKA_API const UmkaType *umkaGetMapKeyType  (const UmkaType *mapType);
 UMKA_API const UmkaType *umkaGetMapItemType (const UmkaType *mapType);
 UMKA_API bool umkaAddClosure                (Umka *umka, const char *name, UmkaExternFunc func, void *upvalue);
+UMKA_API bool umkaStartProfiler             (Umka *umka, double interval);
+UMKA_API char *umkaStopProfiler             (Umka *umka);
+UMKA_API int  umkaGetHeapSnapshot           (Umka *umka, UmkaHeapSite *sites, int maxSites);
+UMKA_API bool umkaSaveImage                 (Umka *umka, const char *fileName);
+UMKA_API bool umkaLoadImage                 (Umka *umka, const char *fileName);
+UMKA_API bool umkaClone                     (Umka *umka, Umka *clone);
 
 
 static inline UmkaAPI *umkaGetAPI(Umka *umka)
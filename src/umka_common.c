@@ -18,6 +18,9 @@
 #include "umka_types.h"
 
 
+const char unknownName[] = "<unknown>";
+
+
 // Errors
 
 void errorReportInit(UmkaError *report, Storage *storage, const char *fileName, const char *fnName, int line, int pos, int code, const char *format, va_list args)
@@ -90,7 +93,7 @@ void *storageAdd(Storage *storage, int64_t size)
 
 char *storageAddStr(Storage *storage, int64_t len)
 {
-    StrDimensions dims = {.len = len, .capacity = len + 1};
+    StrDimensions dims = {.hash = STR_HASH_READ_ONLY, .len = len, .capacity = len + 1};
 
     char *dimsAndData = storageAdd(storage, sizeof(StrDimensions) + dims.capacity);
     *(StrDimensions *)dimsAndData = dims;
@@ -213,6 +216,30 @@ static void *moduleLoadImplLibFunc(void *lib, const char *name)
 }
 
 
+static void moduleOpenImplLib(Modules *modules, Module *module)
+{
+    module->implLib = NULL;
+
+    if (modules->implLibsEnabled)
+    {
+        char libPath[2 + 2 * DEFAULT_STR_LEN + 8 + 4 + 1];
+
+        const char *pathPrefix = modulePathIsAbsolute(module->path) ? "" : "./";
+
+        // First, search for an implementation library with an OS-specific suffix
+        sprintf(libPath, "%s%s%s%s.umi", pathPrefix, module->folder, module->name, moduleImplLibSuffix());
+        module->implLib = moduleLoadImplLib(libPath);
+
+        // If not found, search for an implementation library without suffix
+        if (!module->implLib)
+        {
+            sprintf(libPath, "%s%s%s.umi", pathPrefix, module->folder, module->name);
+            module->implLib = moduleLoadImplLib(libPath);
+        }
+    }
+}
+
+
 void moduleInit(Modules *modules, Storage *storage, bool implLibsEnabled, Error *error)
 {
     for (int i = 0; i < MAX_MODULES; i++)
@@ -313,23 +340,7 @@ int moduleAdd(Modules *modules, const char *path)
     strncpy(module->name, name, DEFAULT_STR_LEN);
     module->name[DEFAULT_STR_LEN] = 0;
 
-    if (modules->implLibsEnabled)
-    {
-        char libPath[2 + 2 * DEFAULT_STR_LEN + 8 + 4 + 1];
-
-        const char *pathPrefix = modulePathIsAbsolute(module->path) ? "" : "./";
-
-        // First, search for an implementation library with an OS-specific suffix
-        sprintf(libPath, "%s%s%s%s.umi", pathPrefix, module->folder, module->name, moduleImplLibSuffix());
-        module->implLib = moduleLoadImplLib(libPath);
-
-        // If not found, search for an implementation library without suffix
-        if (!module->implLib)
-        {
-            sprintf(libPath, "%s%s%s.umi", pathPrefix, module->folder, module->name);
-            module->implLib = moduleLoadImplLib(libPath);
-        }
-    }
+    moduleOpenImplLib(modules, module);
 
     // Self-import
     module->importAlias[modules->numModules] = storageAdd(modules->storage, DEFAULT_STR_LEN + 1);
@@ -342,6 +353,14 @@ int moduleAdd(Modules *modules, const char *path)
 }
 
 
+void moduleReopenImplLibs(Modules *modules)
+{
+    // Implementation library handles are not valid after a module list has been restored from a precompiled image
+    for (int i = 0; i < modules->numModules; i++)
+        moduleOpenImplLib(modules, modules->module[i]);
+}
+
+
 const ModuleSource *moduleFindSource(const Modules *modules, const char *path)
 {
     for (int i = 0; i < modules->numModuleSources; i++)
@@ -534,6 +553,8 @@ void blocksEnterFn(Blocks *blocks, const struct tagIdent *fn, bool hasUpvalues)
     blocks->item[blocks->top].block = blocks->numBlocks++;
     blocks->item[blocks->top].fn = fn;
     blocks->item[blocks->top].localVarSize = 0;
+    blocks->item[blocks->top].tempSlots = 0;
+    blocks->item[blocks->top].maxTempSlots = 0;
     blocks->item[blocks->top].hasReturn = false;
     blocks->item[blocks->top].hasUpvalues = hasUpvalues;
 }
@@ -565,6 +586,38 @@ int blocksCurrent(const Blocks *blocks)
 }
 
 
+static BlockStackSlot *blocksFindFn(Blocks *blocks)
+{
+    for (int i = blocks->top; i >= 1; i--)
+        if (blocks->item[i].fn)
+            return &blocks->item[i];
+    return NULL;
+}
+
+
+void blocksReserveTempSlots(Blocks *blocks, int slots)
+{
+    // Temporaries at the global scope live on the main fiber stack, which never grows
+    BlockStackSlot *fnBlock = blocksFindFn(blocks);
+    if (!fnBlock)
+        return;
+
+    fnBlock->tempSlots += slots;
+    if (fnBlock->tempSlots > fnBlock->maxTempSlots)
+        fnBlock->maxTempSlots = fnBlock->tempSlots;
+}
+
+
+void blocksReleaseTempSlots(Blocks *blocks, int slots)
+{
+    BlockStackSlot *fnBlock = blocksFindFn(blocks);
+    if (!fnBlock)
+        return;
+
+    fnBlock->tempSlots -= slots;
+}
+
+
 // Externals
 
 void externalInit(Externals *externals, Storage *storage)
@@ -19,17 +19,40 @@ enum
     MAX_PARAMS          = 16,
     MAX_BLOCK_NESTING   = 100,
     MAX_GOTOS           = 100,
+    MAX_COMPARE_STEPS   = 32,
+    MAX_CONCAT_OPERANDS = 16,
 };
 
 
 enum
 {
-    MAP_NODE_FIELD_LEN      = 0,
-    MAP_NODE_FIELD_PRIORITY = 1,
-    MAP_NODE_FIELD_KEY      = 2,
-    MAP_NODE_FIELD_DATA     = 3,
-    MAP_NODE_FIELD_LEFT     = 4,
-    MAP_NODE_FIELD_RIGHT    = 5,
+    STR_HASH_NONE       = 0,        // Not computed yet
+    STR_HASH_READ_ONLY  = 1,        // Not cached, since the string may be shared by several instances
+};
+
+
+enum
+{
+    MAP_NODE_FIELD_LEN          = 0,
+    MAP_NODE_FIELD_NUM_DELETED  = 1,
+    MAP_NODE_FIELD_ENTRIES      = 2,
+};
+
+
+enum
+{
+    MAP_ENTRY_FIELD_HASH    = 0,
+    MAP_ENTRY_FIELD_DATA    = 1,
+    MAP_ENTRY_FIELD_KEY     = 2,
+};
+
+
+enum
+{
+    INTERFACE_FIELD_SELF            = 0,
+    INTERFACE_FIELD_SELFTYPE        = 1,
+    INTERFACE_FIELD_ITABLE          = 2,    // Only in interfaces with methods
+    INTERFACE_FIELD_FIRST_METHOD    = 3,    // Method fields are offsets into the interface table, not into the interface
 };
 
 
@@ -38,30 +61,72 @@ typedef struct tagUmka Umka;
 
 typedef struct
 {
+    uint64_t hash;                      // Cached hash of the string contents, or STR_HASH_NONE, or STR_HASH_READ_ONLY
     int64_t len, capacity;
 } StrDimensions;
 
 
-typedef StrDimensions DynArrayDimensions;
+typedef struct
+{
+    int64_t len, capacity;
+} DynArrayDimensions;
 
 
 typedef UmkaDynArray(void) DynArray;    // The C equivalent of the Umka dynamic array type. Must have 8 byte alignment. Allocated chunk should start at (char *)data - sizeof(DynArrayDimensions)
-typedef UmkaAny Interface;              // The C equivalent of the Umka interface type. Methods are omitted - do not use sizeof() for non-empty interfaces
+typedef UmkaAny Interface;              // The C equivalent of the Umka interface type. The method table pointer is omitted - use InterfaceWithMethods for non-empty interfaces
 typedef UmkaClosure Closure;            // The C equivalent of the Umka closure type
 
 
-typedef struct tagMapNode               // The C equivalent of the Umka map base type
+typedef struct tagInterfaceTable        // Method entry points shared by all interface values with the same self type and interface type
+{
+    const struct tagType *selfType, *interfaceType;
+    struct tagInterfaceTable *nextInterned;                 // Next table built by the compiler
+    struct tagInterfaceTable *firstDerived, *nextDerived;   // Tables built at run time by interface-to-interface conversions
+    int64_t entryOffset[];
+} InterfaceTable;
+
+
+typedef struct                          // The C equivalent of the Umka interface type with methods
+{
+    void *self;
+    const struct tagType *selfType;
+    const InterfaceTable *itable;
+} InterfaceWithMethods;
+
+
+typedef struct                          // The C equivalent of the Umka map entry type
+{
+    uint64_t hash;                      // Cached key hash
+    void *data;                         // Null for empty entries
+    char key[];                         // Stored in place. The entry size depends on the key type
+} MapEntry;
+
+
+typedef struct tagMapNode               // The C equivalent of the Umka map node type
 {   
-    int64_t len;                        // Non-zero for the root node only
-    int64_t priority;                   // Random priority for rebalancing
-    void *key, *data;
-    struct tagMapNode *left, *right;
+    int64_t len;
+    int64_t numDeleted;                 // Total number of deleted entries. Allows for...in loops to skip the items deleted during iteration
+    DynArray entries;                   // Array of MapEntry. Open addressing hash table with linear probing. The number of entries is a power of two
 } MapNode;
 
 
 typedef UmkaMap Map;                    // The C equivalent of the Umka map type. Must have 8 byte alignment
 
 
+typedef struct                          // The C equivalent of the Umka map iterator item type used by for...in loops
+{
+    void *data;                         // Not ref-counted. Valid while numDeleted of the map node is equal to numDeleted of the iterator
+    char key[];
+} MapIteratorItem;
+
+
+typedef struct                          // The C equivalent of the Umka map iterator type used by for...in loops
+{
+    int64_t numDeleted;                 // Total number of deleted map entries when the iterator was created
+    DynArray items;                     // Array of MapIteratorItem sorted by key
+} MapIterator;
+
+
 typedef struct                          // The C equivalent of the Umka file type
 {
     FILE *stream;
@@ -76,6 +141,9 @@ typedef struct
 } DebugInfo;
 
 
+extern const char unknownName[];        // The only static string a DebugInfo may point to. Precompiled images rely on it
+
+
 typedef struct
 {
     void (*handler)(Umka *umka, const char *format, ...);
@@ -138,6 +206,8 @@ typedef struct
     int block;
     const struct tagIdent *fn;
     int localVarSize;           // For function blocks only
+    int tempSlots;              // For function blocks only. Stack slots currently occupied by parameters and other large temporaries
+    int maxTempSlots;           // For function blocks only
     bool hasReturn;
     bool hasUpvalues;
 } BlockStackSlot;
@@ -191,6 +261,7 @@ typedef struct      // Appended to the end of ParamLayout
 typedef struct      // Appended to the end of ParamTypes 
 {
     int64_t localVarSlots;
+    int64_t tempSlots;          // Stack space reserved on entry for parameters and other large temporaries
 } LocalVarLayout;
 
 
@@ -239,6 +310,7 @@ void  moduleNameFromPath        (const Modules *modules, const char *path, char
 int   moduleFind                (const Modules *modules, const char *path);
 int   moduleFindImported        (const Modules *modules, const Blocks *blocks, const char *alias);
 int   moduleAdd                 (Modules *modules, const char *path);
+void  moduleReopenImplLibs      (Modules *modules);
 const ModuleSource *moduleFindSource(const Modules *modules, const char *path);
 void  moduleAddSource           (Modules *modules, const char *path, const char *source, bool trusted);
 void *moduleGetImplLibFunc      (const Module  *module,  const char *name);
@@ -253,6 +325,8 @@ void blocksEnter  (Blocks *blocks);
 void blocksReenter(Blocks *blocks);
 void blocksLeave  (Blocks *blocks);
 int  blocksCurrent(const Blocks *blocks);
+void blocksReserveTempSlots(Blocks *blocks, int slots);
+void blocksReleaseTempSlots(Blocks *blocks, int slots);
 
 void externalInit       (Externals *externals, Storage *storage);
 External *externalFind  (const Externals *externals, const char *name);
@@ -277,6 +351,32 @@ static inline int64_t align(int64_t size, int64_t alignment)
 }
 
 
+static inline uint64_t hashBits(uint64_t bits)
+{
+    // SplitMix64 finalizer
+    bits ^= bits >> 30;
+    bits *= 0xBF58476D1CE4E5B9ULL;
+    bits ^= bits >> 27;
+    bits *= 0x94D049BB133111EBULL;
+    bits ^= bits >> 31;
+    return bits;
+}
+
+
+static inline uint64_t hashStr(const char *str)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char *ch = str; *ch; ch++)
+        hash = (hash ^ (unsigned char)(*ch)) * 1099511628211ULL;
+
+    hash = hashBits(hash);
+
+    // Reserved values cannot be cached hashes
+    return (hash > STR_HASH_READ_ONLY) ? hash : hash + STR_HASH_READ_ONLY + 1;
+}
+
+
 static inline StrDimensions *getStrDims(const char *str)
 {
     return (StrDimensions *)(str - sizeof(StrDimensions));
@@ -56,6 +56,12 @@ static void compilerSetAPI(Umka *umka)
     umka->api.umkaGetMapKeyType     = umkaGetMapKeyType;
     umka->api.umkaGetMapItemType    = umkaGetMapItemType; 
     umka->api.umkaAddClosure        = umkaAddClosure;        
+    umka->api.umkaStartProfiler     = umkaStartProfiler;
+    umka->api.umkaStopProfiler      = umkaStopProfiler;
+    umka->api.umkaGetHeapSnapshot   = umkaGetHeapSnapshot;
+    umka->api.umkaSaveImage         = umkaSaveImage;
+    umka->api.umkaLoadImage         = umkaLoadImage;
+    umka->api.umkaClone             = umkaClone;
 }
 
 
@@ -161,6 +167,10 @@ static void compilerDeclareExternalFuncs(Umka *umka, bool fileSystemEnabled)
     externalAdd(&umka->externals, "rtlremove",      fileSystemEnabled ? &rtlremove : &rtlremoveSandbox,   NULL, true);
     externalAdd(&umka->externals, "rtlfeof",        fileSystemEnabled ? &rtlfeof   : &rtlfeofSandbox,     NULL, true);
     externalAdd(&umka->externals, "rtlfflush",      &rtlfflush,                                           NULL, true);
+    externalAdd(&umka->externals, "rtlpipe",        fileSystemEnabled ? &rtlpipe    : &rtlpipeSandbox,    NULL, true);
+    externalAdd(&umka->externals, "rtlfdread",      fileSystemEnabled ? &rtlfdread  : &rtlfdreadSandbox,  NULL, true);
+    externalAdd(&umka->externals, "rtlfdwrite",     fileSystemEnabled ? &rtlfdwrite : &rtlfdwriteSandbox, NULL, true);
+    externalAdd(&umka->externals, "rtlfdclose",     fileSystemEnabled ? &rtlfdclose : &rtlfdcloseSandbox, NULL, true);
     externalAdd(&umka->externals, "rtltime",        &rtltime,                                             NULL, true);
     externalAdd(&umka->externals, "rtlclock",       &rtlclock,                                            NULL, true);
     externalAdd(&umka->externals, "rtllocaltime",   &rtllocaltime,                                        NULL, true);
@@ -169,6 +179,11 @@ static void compilerDeclareExternalFuncs(Umka *umka, bool fileSystemEnabled)
     externalAdd(&umka->externals, "rtlgetenv",      fileSystemEnabled ? &rtlgetenv : &rtlgetenvSandbox,   NULL, true);
     externalAdd(&umka->externals, "rtlsystem",      fileSystemEnabled ? &rtlsystem : &rtlsystemSandbox,   NULL, true);
     externalAdd(&umka->externals, "rtltrace",       &rtltrace,                                            NULL, true);
+    externalAdd(&umka->externals, "rtlheapsnapshot",&rtlheapsnapshot,                                     NULL, true);
+    externalAdd(&umka->externals, "rtlspawn",       &rtlspawn,                                            NULL, true);
+    externalAdd(&umka->externals, "rtlyield",       &rtlyield,                                            NULL, true);
+    externalAdd(&umka->externals, "rtlsleep",       &rtlsleep,                                            NULL, true);
+    externalAdd(&umka->externals, "rtljoin",        &rtljoin,                                             NULL, true);
 }
 
 
@@ -208,12 +223,12 @@ void compilerInit(Umka *umka, const char *fileName, const char *sourceString, in
     genInit      (&umka->gen, &umka->storage, &umka->debug, &umka->error);
     vmInit       (&umka->vm, &umka->storage, stackSize, fileSystemEnabled, &umka->error);
 
-    vmReset(&umka->vm, umka->gen.code, umka->gen.debugPerInstr);
+    vmReset(&umka->vm, umka->gen.code, umka->gen.ip, umka->gen.debugPerInstr);
 
     umka->lex.fileName = "<unknown>";
     umka->lex.tok.line = 1;
     umka->lex.tok.pos = 1;
-    umka->debug.fnName = "<unknown>";
+    umka->debug.fnName = unknownName;
 
     char filePath[DEFAULT_STR_LEN + 1] = "";
     moduleAssertRegularizePath(&umka->modules, fileName, umka->modules.curFolder, filePath, DEFAULT_STR_LEN + 1);
@@ -227,18 +242,19 @@ void compilerInit(Umka *umka, const char *fileName, const char *sourceString, in
     compilerDeclareBuiltinIdents(umka);
     compilerDeclareExternalFuncs(umka, fileSystemEnabled);
 
-    // Command-line-arguments
-    Type *argvType = typeAdd(&umka->types, &umka->blocks, TYPE_ARRAY);
+    // Command-line-arguments. A dynamic array, so that a precompiled image could accept any number of them
+    Type *argvType = typeAdd(&umka->types, &umka->blocks, TYPE_DYNARRAY);
     typeSetBase(argvType, umka->types.predecl.strType);
-    typeAssertResizeArray(&umka->types, argvType, argc);
 
     const Ident *rtlargv = identAllocVar(&umka->idents, &umka->types, &umka->modules, &umka->blocks, "rtlargv", argvType, true);
-    char **argArray = (char **)rtlargv->ptr;
+    DynArray *argArray = (DynArray *)rtlargv->ptr;
+    *argArray = *storageAddDynArray(&umka->storage, argvType, argc);
 
     for (int i = 0; i < argc; i++)
     {
-        argArray[i] = storageAddStr(&umka->storage, strlen(argv[i]));
-        strcpy(argArray[i], argv[i]);
+        char **arg = (char **)argArray->data + i;
+        *arg = storageAddStr(&umka->storage, strlen(argv[i]));
+        strcpy(*arg, argv[i]);
     }
 
     // Embedded standard library modules
@@ -248,7 +264,7 @@ void compilerInit(Umka *umka, const char *fileName, const char *sourceString, in
         char runtimeModulePath[DEFAULT_STR_LEN + 1] = "";
         moduleAssertRegularizePath(&umka->modules, runtimeModuleNames[i], umka->modules.curFolder, runtimeModulePath, DEFAULT_STR_LEN + 1);
 
-        const bool runtimeModuleTrusted = strcmp(runtimeModuleNames[i], "std.um") == 0;
+        const bool runtimeModuleTrusted = strcmp(runtimeModuleNames[i], "std.um") == 0 || strcmp(runtimeModuleNames[i], "sched.um") == 0;
         moduleAddSource(&umka->modules, runtimeModulePath, runtimeModuleSources[i], runtimeModuleTrusted);
     }
 }
@@ -260,7 +276,10 @@ void compilerFree(Umka *umka)
         vmCleanup(&umka->vm);
 
     vmFree      (&umka->vm);
-    moduleFree  (&umka->modules);
+
+    if (!umka->original)
+        moduleFree(&umka->modules);
+
     storageFree (&umka->storage);
 
     compilerRestoreCodepage(umka);
@@ -270,14 +289,15 @@ void compilerFree(Umka *umka)
 void compilerCompile(Umka *umka)
 {
     parseProgram(umka);
-    vmReset(&umka->vm, umka->gen.code, umka->gen.debugPerInstr);
+    vmReset(&umka->vm, umka->gen.code, umka->gen.ip, umka->gen.debugPerInstr);
+    umka->isCompiled = true;
 }
 
 
 void compilerRun(Umka *umka)
 {
     if (umka->mainFn.entryOffset > 0)
-        vmCall(&umka->vm, &umka->mainFn);
+        vmRun(&umka->vm, &umka->mainFn);
 }
 
 
@@ -350,7 +370,701 @@ void compilerMakeFuncContext(Umka *umka, const Type *fnType, int entryOffset, Um
     const int paramSlots = typeParamSizeTotal(&umka->types, fnType->sig) / sizeof(Slot);
     fn->params = (UmkaStackSlot *)storageAdd(&umka->storage, (paramSlots + 4) * sizeof(Slot)) + 4;          // + 4 slots for compatibility with umkaGetParam()
 
-    *vmGetStackFrameLayout(fn->params) = typeMakeStackFrameLayout(&umka->types, fnType->sig, 0);
+    *vmGetStackFrameLayout(fn->params) = typeMakeStackFrameLayout(&umka->types, fnType->sig, 0, 0);
 
     fn->result = storageAdd(&umka->storage, sizeof(Slot));
 }
+
+
+// Precompiled images
+
+#define IMAGE_MAGIC     "UMKAIMG"
+
+
+typedef enum
+{
+    IMAGE_RELOC_STORAGE,                // Pointer into a storage chunk
+    IMAGE_RELOC_UMKA,                   // Pointer into the Umka instance
+    IMAGE_RELOC_UNKNOWN_NAME,           // Pointer to the placeholder for missing file and function names
+    IMAGE_RELOC_EXTERNAL_ENTRY,         // External function entry point, resolved by name
+    IMAGE_RELOC_EXTERNAL_UPVALUE,       // External function upvalue, resolved by name
+    IMAGE_RELOC_IMPL_LIB_FUNC,          // Implementation library function, resolved by module and name
+} ImageRelocKind;
+
+
+typedef struct
+{
+    char magic[8];
+    char version[32];
+    int64_t umkaSize, typeSize, identSize, instructionSize, numOpcodes;     // The image is only valid for the interpreter build with the same data layout
+    int64_t numChunks, numRelocs, numNames;
+} ImageHeader;
+
+
+typedef struct                          // Storage chunks never exceed INT_MAX bytes, so 32-bit fields suffice
+{
+    int32_t kind;
+    int32_t chunk;                      // Chunk containing the pointer, or -1 for the Umka instance
+    int32_t offset;                     // Pointer offset within the chunk or the Umka instance
+    int32_t target;                     // Target chunk for IMAGE_RELOC_STORAGE, target module for IMAGE_RELOC_IMPL_LIB_FUNC
+    int32_t targetOffset;               // Pointer offset within the target chunk or the Umka instance
+    int32_t name;                       // Name index for external and implementation library functions
+} ImageReloc;
+
+
+typedef char ImageName[DEFAULT_STR_LEN + 1];
+
+
+typedef struct
+{
+    char *data;
+    int64_t size;
+    int64_t index;                      // Index in the image, or -1 if not reachable from the Umka instance
+} ImageChunk;
+
+
+typedef struct
+{
+    void *entry;
+    int module;
+    const char *name;
+} ImageImplLibFunc;
+
+
+typedef struct
+{
+    Umka *umka;
+    ImageChunk *chunks;                 // Sorted by address
+    ImageChunk **reachableChunks;       // In image order
+    int64_t numChunks, numReachableChunks;
+    ImageReloc *relocs;
+    int64_t numRelocs, relocCapacity;
+    ImageName *names;
+    int64_t numNames, nameCapacity;
+    ImageImplLibFunc *implLibFuncs;
+    int64_t numImplLibFuncs;
+} ImageWriter;
+
+
+static void compilerCopyImageMembers(Umka *dest, const Umka *src)
+{
+    // Only the compilation results are stored in an image. Module sources, externals and the VM state belong to the instance that loads the image
+    memcpy(dest->modules.module, src->modules.module, sizeof(src->modules.module));
+    dest->modules.numModules = src->modules.numModules;
+    strcpy(dest->modules.curFolder, src->modules.curFolder);
+
+    dest->blocks = src->blocks;
+    dest->types  = src->types;
+    dest->idents = src->idents;
+    dest->consts = src->consts;
+    dest->gen    = src->gen;
+    dest->mainFn = src->mainFn;
+}
+
+
+static void compilerFillImageHeader(ImageHeader *header)
+{
+    memset(header, 0, sizeof(ImageHeader));
+
+    strcpy(header->magic, IMAGE_MAGIC);
+    strncpy(header->version, umkaGetVersion(), sizeof(header->version) - 1);
+
+    header->umkaSize        = sizeof(Umka);
+    header->typeSize        = sizeof(Type);
+    header->identSize       = sizeof(Ident);
+    header->instructionSize = sizeof(Instruction);
+    header->numOpcodes      = OP_HALT + 1;
+}
+
+
+static int compilerCompareImageChunks(const void *a, const void *b)
+{
+    const char *dataA = ((const ImageChunk *)a)->data;
+    const char *dataB = ((const ImageChunk *)b)->data;
+    return (dataA > dataB) - (dataA < dataB);
+}
+
+
+static int64_t compilerAddImageName(ImageWriter *writer, const char *name)
+{
+    for (int64_t i = 0; i < writer->numNames; i++)
+        if (strcmp(writer->names[i], name) == 0)
+            return i;
+
+    if (writer->numNames == writer->nameCapacity)
+    {
+        writer->nameCapacity = 2 * writer->nameCapacity;
+        writer->names = storageRealloc(&writer->umka->storage, writer->names, writer->nameCapacity * sizeof(ImageName));
+    }
+
+    strncpy(writer->names[writer->numNames], name, DEFAULT_STR_LEN);
+    writer->names[writer->numNames][DEFAULT_STR_LEN] = 0;
+    return writer->numNames++;
+}
+
+
+static ImageChunk *compilerFindImageChunk(ImageWriter *writer, const char *ptr)
+{
+    int64_t left = 0, right = writer->numChunks - 1;
+
+    while (left <= right)
+    {
+        const int64_t mid = (left + right) / 2;
+        ImageChunk *chunk = &writer->chunks[mid];
+
+        if (ptr < chunk->data)
+            right = mid - 1;
+        else if (ptr > chunk->data + chunk->size)
+            left = mid + 1;
+        else
+            return chunk;
+    }
+
+    return NULL;
+}
+
+
+static bool compilerGetImageReloc(ImageWriter *writer, const void *ptr, ImageReloc *reloc)
+{
+    // Any word that holds an address of a storage chunk, of the Umka instance or of an external function is considered a pointer
+    if (!ptr)
+        return false;
+
+    ImageChunk *chunk = compilerFindImageChunk(writer, ptr);
+    if (chunk)
+    {
+        if (chunk->index < 0)
+        {
+            chunk->index = writer->numReachableChunks;
+            writer->reachableChunks[writer->numReachableChunks++] = chunk;
+        }
+
+        reloc->kind = IMAGE_RELOC_STORAGE;
+        reloc->target = chunk->index;
+        reloc->targetOffset = (const char *)ptr - chunk->data;
+        return true;
+    }
+
+    if ((const char *)ptr >= (const char *)writer->umka && (const char *)ptr < (const char *)writer->umka + sizeof(Umka))
+    {
+        reloc->kind = IMAGE_RELOC_UMKA;
+        reloc->targetOffset = (const char *)ptr - (const char *)writer->umka;
+        return true;
+    }
+
+    if (ptr == unknownName)
+    {
+        reloc->kind = IMAGE_RELOC_UNKNOWN_NAME;
+        return true;
+    }
+
+    for (int64_t i = 0; i < writer->numImplLibFuncs; i++)
+        if (ptr == writer->implLibFuncs[i].entry)
+        {
+            reloc->kind = IMAGE_RELOC_IMPL_LIB_FUNC;
+            reloc->target = writer->implLibFuncs[i].module;
+            reloc->name = compilerAddImageName(writer, writer->implLibFuncs[i].name);
+            return true;
+        }
+
+    for (const External *external = writer->umka->externals.first; external; external = external->next)
+    {
+        if (ptr == external->entry)
+        {
+            reloc->kind = IMAGE_RELOC_EXTERNAL_ENTRY;
+            reloc->name = compilerAddImageName(writer, external->name);
+            return true;
+        }
+
+        if (ptr == external->upvalue)
+        {
+            reloc->kind = IMAGE_RELOC_EXTERNAL_UPVALUE;
+            reloc->name = compilerAddImageName(writer, external->name);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+static void compilerScanImageBlock(ImageWriter *writer, const char *data, int64_t size, int64_t chunk)
+{
+    for (int64_t offset = 0; offset + (int64_t)sizeof(void *) <= size; offset += sizeof(void *))
+    {
+        ImageReloc reloc = {.chunk = chunk, .offset = offset};
+        if (!compilerGetImageReloc(writer, *(void * const *)(data + offset), &reloc))
+            continue;
+
+        if (writer->numRelocs == writer->relocCapacity)
+        {
+            writer->relocCapacity = 2 * writer->relocCapacity;
+            writer->relocs = storageRealloc(&writer->umka->storage, writer->relocs, writer->relocCapacity * sizeof(ImageReloc));
+        }
+
+        writer->relocs[writer->numRelocs++] = reloc;
+    }
+}
+
+
+void compilerSaveImage(Umka *umka, const char *fileName)
+{
+    ImageWriter writer = {.umka = umka, .relocCapacity = 1024, .nameCapacity = 64};
+
+    writer.relocs = storageAdd(&umka->storage, writer.relocCapacity * sizeof(ImageReloc));
+    writer.names = storageAdd(&umka->storage, writer.nameCapacity * sizeof(ImageName));
+
+    // Collect storage chunks, except the ones allocated by the writer itself
+    for (const StorageChunk *chunk = umka->storage.first; chunk; chunk = chunk->next)
+        writer.numChunks++;
+
+    writer.chunks = storageAdd(&umka->storage, writer.numChunks * sizeof(ImageChunk));
+    writer.reachableChunks = storageAdd(&umka->storage, writer.numChunks * sizeof(ImageChunk *));
+
+    int64_t numChunks = 0;
+    for (StorageChunk *chunk = umka->storage.first; chunk; chunk = chunk->next)
+    {
+        if (chunk->data == (char *)writer.chunks || chunk->data == (char *)writer.reachableChunks || chunk->data == (char *)writer.relocs || chunk->data == (char *)writer.names)
+            continue;
+
+        if (numChunks < writer.numChunks)
+            writer.chunks[numChunks++] = (ImageChunk){.data = chunk->data, .size = chunk->size, .index = -1};
+    }
+
+    writer.numChunks = numChunks;
+    qsort(writer.chunks, writer.numChunks, sizeof(ImageChunk), compilerCompareImageChunks);
+
+    // Collect implementation library functions
+    for (const Ident *ident = umka->idents.first; ident; ident = ident->next)
+        writer.numImplLibFuncs++;
+
+    writer.implLibFuncs = storageAdd(&umka->storage, (writer.numImplLibFuncs + 1) * sizeof(ImageImplLibFunc));
+    writer.numImplLibFuncs = 0;
+
+    for (const Ident *ident = umka->idents.first; ident; ident = ident->next)
+    {
+        void *entry = moduleGetImplLibFunc(umka->modules.module[ident->module], ident->name);
+        if (entry)
+            writer.implLibFuncs[writer.numImplLibFuncs++] = (ImageImplLibFunc){.entry = entry, .module = ident->module, .name = ident->name};
+    }
+
+    // Find all chunks reachable from the compilation results and all pointers to be relocated
+    Umka *snapshot = storageAdd(&umka->storage, sizeof(Umka));
+    compilerCopyImageMembers(snapshot, umka);
+    compilerScanImageBlock(&writer, (const char *)snapshot, sizeof(Umka), -1);
+
+    for (int64_t i = 0; i < writer.numReachableChunks; i++)
+        compilerScanImageBlock(&writer, writer.reachableChunks[i]->data, writer.reachableChunks[i]->size, i);
+
+    // Write image
+    ImageHeader header;
+    compilerFillImageHeader(&header);
+    header.numChunks = writer.numReachableChunks;
+    header.numRelocs = writer.numRelocs;
+    header.numNames = writer.numNames;
+
+    FILE *file = fopen(fileName, "wb");
+    if (!file)
+        umka->error.handler(umka->error.context, "Cannot open file %s", fileName);
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(snapshot, sizeof(Umka), 1, file) == 1;
+
+    for (int64_t i = 0; ok && i < writer.numReachableChunks; i++)
+    {
+        const ImageChunk *chunk = writer.reachableChunks[i];
+        ok = fwrite(&chunk->size, sizeof(chunk->size), 1, file) == 1 && (chunk->size == 0 || fwrite(chunk->data, chunk->size, 1, file) == 1);
+    }
+
+    if (ok && writer.numRelocs > 0)
+        ok = fwrite(writer.relocs, writer.numRelocs * sizeof(ImageReloc), 1, file) == 1;
+
+    if (ok && writer.numNames > 0)
+        ok = fwrite(writer.names, writer.numNames * sizeof(ImageName), 1, file) == 1;
+
+    fclose(file);
+
+    if (!ok)
+        umka->error.handler(umka->error.context, "Cannot write file %s", fileName);
+
+    storageRemove(&umka->storage, snapshot);
+    storageRemove(&umka->storage, writer.implLibFuncs);
+    storageRemove(&umka->storage, writer.reachableChunks);
+    storageRemove(&umka->storage, writer.chunks);
+    storageRemove(&umka->storage, writer.names);
+    storageRemove(&umka->storage, writer.relocs);
+}
+
+
+static const Ident *compilerFindImageArgv(const Idents *idents)
+{
+    for (const Ident *ident = idents->first; ident; ident = ident->next)
+        if (ident->module == 0 && ident->kind == IDENT_VAR && strcmp(ident->name, "rtlargv") == 0)
+            return ident;
+    return NULL;
+}
+
+
+static const char *compilerReadImage(Umka *umka, const char *fileName, const char **pos, const char *end, int64_t size)
+{
+    if (size < 0 || size > end - *pos)
+        umka->error.handler(umka->error.context, "Invalid image %s", fileName);
+
+    const char *data = *pos;
+    *pos += size;
+    return data;
+}
+
+
+void compilerLoadImage(Umka *umka, const char *fileName)
+{
+    // Read file
+    FILE *file = fopen(fileName, "rb");
+    if (!file)
+        umka->error.handler(umka->error.context, "Cannot open file %s", fileName);
+
+    fseek(file, 0, SEEK_END);
+    const int64_t bufLen = ftell(file);
+    rewind(file);
+
+    char *buf = storageAdd(&umka->storage, bufLen > 0 ? bufLen : 1);
+    const bool ok = bufLen > 0 && fread(buf, bufLen, 1, file) == 1;
+    fclose(file);
+
+    if (!ok)
+        umka->error.handler(umka->error.context, "Cannot read file %s", fileName);
+
+    const char *pos = buf, *end = buf + bufLen;
+
+    // Check header
+    ImageHeader header, expectedHeader;
+    memcpy(&header, compilerReadImage(umka, fileName, &pos, end, sizeof(ImageHeader)), sizeof(ImageHeader));
+    compilerFillImageHeader(&expectedHeader);
+
+    if (memcmp(header.magic, expectedHeader.magic, sizeof(header.magic)) != 0)
+        umka->error.handler(umka->error.context, "Invalid image %s", fileName);
+
+    if (memcmp(&header, &expectedHeader, offsetof(ImageHeader, numChunks)) != 0)
+        umka->error.handler(umka->error.context, "Image %s was built by an incompatible interpreter", fileName);
+
+    if (header.numChunks < 0 || header.numRelocs < 0 || header.numNames < 0)
+        umka->error.handler(umka->error.context, "Invalid image %s", fileName);
+
+    // Restore storage chunks
+    Umka *snapshot = storageAdd(&umka->storage, sizeof(Umka));
+    memcpy(snapshot, compilerReadImage(umka, fileName, &pos, end, sizeof(Umka)), sizeof(Umka));
+
+    char **chunks = storageAdd(&umka->storage, (header.numChunks + 1) * sizeof(char *));
+    int64_t *chunkSizes = storageAdd(&umka->storage, (header.numChunks + 1) * sizeof(int64_t));
+
+    for (int64_t i = 0; i < header.numChunks; i++)
+    {
+        memcpy(&chunkSizes[i], compilerReadImage(umka, fileName, &pos, end, sizeof(int64_t)), sizeof(int64_t));
+        const char *data = compilerReadImage(umka, fileName, &pos, end, chunkSizes[i]);
+
+        chunks[i] = storageAdd(&umka->storage, chunkSizes[i]);
+        memcpy(chunks[i], data, chunkSizes[i]);
+    }
+
+    const ImageReloc *relocs = (const ImageReloc *)compilerReadImage(umka, fileName, &pos, end, header.numRelocs * sizeof(ImageReloc));
+    const ImageName *names = (const ImageName *)compilerReadImage(umka, fileName, &pos, end, header.numNames * sizeof(ImageName));
+
+    // Relocate pointers. Implementation library functions can only be resolved once the modules are restored
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int64_t i = 0; i < header.numRelocs; i++)
+        {
+            ImageReloc reloc;
+            memcpy(&reloc, &relocs[i], sizeof(ImageReloc));
+
+            if ((reloc.kind == IMAGE_RELOC_IMPL_LIB_FUNC) != (pass == 1))
+                continue;
+
+            char *base = (reloc.chunk == -1) ? (char *)snapshot : (reloc.chunk >= 0 && reloc.chunk < header.numChunks) ? chunks[reloc.chunk] : NULL;
+            const int64_t size = (reloc.chunk == -1) ? (int64_t)sizeof(Umka) : base ? chunkSizes[reloc.chunk] : 0;
+
+            if (!base || reloc.offset < 0 || reloc.offset + (int64_t)sizeof(void *) > size)
+                umka->error.handler(umka->error.context, "Invalid image %s", fileName);
+
+            const char *name = (reloc.name >= 0 && reloc.name < header.numNames) ? names[reloc.name] : "";
+            void *ptr = NULL;
+
+            switch (reloc.kind)
+            {
+                case IMAGE_RELOC_STORAGE:
+                {
+                    if (reloc.target < 0 || reloc.target >= header.numChunks || reloc.targetOffset < 0 || reloc.targetOffset > chunkSizes[reloc.target])
+                        umka->error.handler(umka->error.context, "Invalid image %s", fileName);
+
+                    ptr = chunks[reloc.target] + reloc.targetOffset;
+                    break;
+                }
+                case IMAGE_RELOC_UMKA:
+                {
+                    if (reloc.targetOffset < 0 || reloc.targetOffset >= (int64_t)sizeof(Umka))
+                        umka->error.handler(umka->error.context, "Invalid image %s", fileName);
+
+                    ptr = (char *)umka + reloc.targetOffset;
+                    break;
+                }
+                case IMAGE_RELOC_UNKNOWN_NAME:
+                {
+                    ptr = (void *)unknownName;
+                    break;
+                }
+                case IMAGE_RELOC_EXTERNAL_ENTRY:
+                case IMAGE_RELOC_EXTERNAL_UPVALUE:
+                {
+                    const External *external = externalFind(&umka->externals, name);
+                    if (!external)
+                        umka->error.handler(umka->error.context, "Unresolved prototype of %s", name);
+
+                    ptr = (reloc.kind == IMAGE_RELOC_EXTERNAL_ENTRY) ? external->entry : external->upvalue;
+                    break;
+                }
+                case IMAGE_RELOC_IMPL_LIB_FUNC:
+                {
+                    if (reloc.target < 0 || reloc.target >= umka->modules.numModules)
+                        umka->error.handler(umka->error.context, "Invalid image %s", fileName);
+
+                    ptr = moduleGetImplLibFunc(umka->modules.module[reloc.target], name);
+                    if (!ptr)
+                        umka->error.handler(umka->error.context, "Unresolved prototype of %s", name);
+                    break;
+                }
+                default:
+                    umka->error.handler(umka->error.context, "Invalid image %s", fileName);
+            }
+
+            memcpy(base + reloc.offset, &ptr, sizeof(void *));
+        }
+
+        if (pass == 0)
+        {
+            // Keep the command-line arguments of this instance
+            const Ident *rtlargv = compilerFindImageArgv(&umka->idents);
+            const Ident *imageRtlargv = compilerFindImageArgv(&snapshot->idents);
+
+            if (!rtlargv || !imageRtlargv)
+                umka->error.handler(umka->error.context, "Invalid image %s", fileName);
+
+            *(DynArray *)imageRtlargv->ptr = *(DynArray *)rtlargv->ptr;
+
+            compilerCopyImageMembers(umka, snapshot);
+            moduleReopenImplLibs(&umka->modules);
+        }
+    }
+
+    storageRemove(&umka->storage, chunkSizes);
+    storageRemove(&umka->storage, chunks);
+    storageRemove(&umka->storage, snapshot);
+    storageRemove(&umka->storage, buf);
+
+    vmReset(&umka->vm, umka->gen.code, umka->gen.ip, umka->gen.debugPerInstr);
+    umka->isCompiled = true;
+}
+
+
+// Clones
+
+typedef struct
+{
+    char *data;
+    int64_t size;
+    const Type *type;               // For global variables
+    char *copy;
+} CloneBlock;
+
+
+static int compilerCompareCloneBlocks(const void *a, const void *b)
+{
+    const char *dataA = ((const CloneBlock *)a)->data;
+    const char *dataB = ((const CloneBlock *)b)->data;
+    return (dataA > dataB) - (dataA < dataB);
+}
+
+
+static void compilerCopyCloneConstData(Umka *umka, char *data, const Type *type)
+{
+    if (!type->isGarbageCollected)
+        return;
+
+    switch (type->kind)
+    {
+        case TYPE_STR:
+        {
+            char **str = (char **)data;
+            if (!*str)
+                break;
+
+            const int64_t size = sizeof(StrDimensions) + getStrDims(*str)->capacity;
+            char *dimsAndData = storageAdd(&umka->storage, size);
+            memcpy(dimsAndData, getStrDims(*str), size);
+
+            *str = dimsAndData + sizeof(StrDimensions);
+            break;
+        }
+        case TYPE_ARRAY:
+        {
+            for (int i = 0; i < type->numItems; i++)
+                compilerCopyCloneConstData(umka, data + i * type->base->size, type->base);
+            break;
+        }
+        case TYPE_DYNARRAY:
+        {
+            DynArray *array = (DynArray *)data;
+            if (!array->data)
+                break;
+
+            const int64_t size = sizeof(DynArrayDimensions) + getDims(array)->capacity * array->itemSize;
+            char *dimsAndData = storageAdd(&umka->storage, size);
+            memcpy(dimsAndData, getDims(array), size);
+
+            array->data = dimsAndData + sizeof(DynArrayDimensions);
+
+            for (int64_t i = 0; i < getDims(array)->len; i++)
+                compilerCopyCloneConstData(umka, (char *)array->data + i * array->itemSize, type->base);
+            break;
+        }
+        case TYPE_STRUCT:
+        {
+            for (int i = 0; i < type->numItems; i++)
+                compilerCopyCloneConstData(umka, data + type->field[i]->offset, type->field[i]->type);
+            break;
+        }
+        default:
+            break;      // Maps, pointers, interfaces and closures cannot refer to the storage in constant expressions
+    }
+}
+
+
+static char *compilerFindCloneBlockCopy(const CloneBlock *blocks, int64_t numBlocks, char *ptr)
+{
+    int64_t left = 0, right = numBlocks - 1;
+
+    while (left <= right)
+    {
+        const int64_t mid = (left + right) / 2;
+
+        if (ptr < blocks[mid].data)
+            right = mid - 1;
+        else if (ptr >= blocks[mid].data + blocks[mid].size)
+            left = mid + 1;
+        else
+            return blocks[mid].copy + (ptr - blocks[mid].data);
+    }
+
+    return NULL;
+}
+
+
+void compilerClone(Umka *umka, Umka *original)
+{
+    if (!original->isCompiled)
+        umka->error.handler(umka->error.context, "Only a compiled instance can be cloned");
+
+    compilerSetCodepage(umka);
+    compilerSetAPI(umka);
+
+    umka->original = original;
+
+    // The modules, types, identifiers and debug information are shared with the original instance and never modified. The code is copied below
+    umka->modules   = original->modules;
+    umka->blocks    = original->blocks;
+    umka->externals = original->externals;
+    umka->lex       = original->lex;
+    umka->types     = original->types;
+    umka->idents    = original->idents;
+    umka->consts    = original->consts;
+    umka->gen       = original->gen;
+    umka->debug     = original->debug;
+
+    storageInit(&umka->storage, &umka->error);
+
+    umka->modules.storage   = &umka->storage;
+    umka->modules.error     = &umka->error;
+    umka->blocks.error      = &umka->error;
+    umka->externals.storage = &umka->storage;
+    umka->lex.storage       = &umka->storage;
+    umka->lex.debug         = &umka->debug;
+    umka->lex.error         = &umka->error;
+    umka->types.storage     = &umka->storage;
+    umka->types.error       = &umka->error;
+    umka->idents.storage    = &umka->storage;
+    umka->idents.debug      = &umka->debug;
+    umka->idents.error      = &umka->error;
+    umka->consts.error      = &umka->error;
+    umka->gen.storage       = &umka->storage;
+    umka->gen.debug         = &umka->debug;
+    umka->gen.error         = &umka->error;
+
+    vmInit(&umka->vm, &umka->storage, original->vm.mainFiber->stackSize, original->vm.mainFiber->fileSystemEnabled, &umka->error);
+
+    // Global variables and interface tables are the only data modified at run time, so each clone gets its own copies
+    int64_t numBlocks = 0;
+
+    for (const Ident *ident = original->idents.first; ident; ident = ident->next)
+        if (ident->isGloballyAllocated)
+            numBlocks++;
+
+    for (const InterfaceTable *itable = original->types.firstInterfaceTable; itable; itable = itable->nextInterned)
+        numBlocks++;
+
+    CloneBlock *blocks = storageAdd(&umka->storage, (numBlocks + 1) * sizeof(CloneBlock));
+    numBlocks = 0;
+
+    for (const Ident *ident = original->idents.first; ident; ident = ident->next)
+        if (ident->isGloballyAllocated)
+            blocks[numBlocks++] = (CloneBlock){.data = ident->ptr, .size = typeSize(&original->types, ident->type), .type = ident->type};
+
+    for (InterfaceTable *itable = original->types.firstInterfaceTable; itable; itable = itable->nextInterned)
+    {
+        const int numMethods = itable->interfaceType->numItems - INTERFACE_FIELD_FIRST_METHOD;
+        blocks[numBlocks++] = (CloneBlock){.data = (char *)itable, .size = sizeof(InterfaceTable) + numMethods * sizeof(int64_t)};
+    }
+
+    for (int64_t i = 0; i < numBlocks; i++)
+    {
+        blocks[i].copy = storageAdd(&umka->storage, blocks[i].size);
+        memcpy(blocks[i].copy, blocks[i].data, blocks[i].size);
+
+        // The constant initializers may have put dynamic arrays and strings to the original storage. Dynamic arrays can be appended to in place
+        if (blocks[i].type)
+            compilerCopyCloneConstData(umka, blocks[i].copy, blocks[i].type);
+    }
+
+    for (InterfaceTable *itable = original->types.firstInterfaceTable; itable; itable = itable->nextInterned)
+        ((InterfaceTable *)compilerFindCloneBlockCopy(blocks, numBlocks, (char *)itable))->firstDerived = NULL;
+
+    qsort(blocks, numBlocks, sizeof(CloneBlock), compilerCompareCloneBlocks);
+
+    // Only the instructions that take global addresses should refer to the copies
+    umka->gen.code = storageAdd(&umka->storage, original->gen.ip * sizeof(Instruction));
+    memcpy(umka->gen.code, original->gen.code, original->gen.ip * sizeof(Instruction));
+
+    for (int ip = 0; ip < umka->gen.ip; ip++)
+    {
+        Instruction *instr = &umka->gen.code[ip];
+        if (instr->opcode != OP_PUSH && instr->opcode != OP_PUSH_GLOBAL && instr->opcode != OP_REF_CNT_GLOBAL)
+            continue;
+
+        char *copy = compilerFindCloneBlockCopy(blocks, numBlocks, instr->operand.ptrVal);
+        if (copy)
+            instr->operand.ptrVal = copy;
+    }
+
+    storageRemove(&umka->storage, blocks);
+
+    vmReset(&umka->vm, umka->gen.code, umka->gen.ip, umka->gen.debugPerInstr);
+    umka->isCompiled = true;
+
+    // The function contexts store the parameters, so they cannot be shared either
+    if (original->mainFn.entryOffset > 0)
+    {
+        const int paramSlots = getParamLayout(*vmGetStackFrameLayout(original->mainFn.params))->numParamSlots;
+
+        umka->mainFn.entryOffset = original->mainFn.entryOffset;
+        umka->mainFn.params = (UmkaStackSlot *)storageAdd(&umka->storage, (paramSlots + 4) * sizeof(Slot)) + 4;
+        *vmGetStackFrameLayout(umka->mainFn.params) = *vmGetStackFrameLayout(original->mainFn.params);
+        umka->mainFn.result = storageAdd(&umka->storage, sizeof(Slot));
+    }
+}
@@ -33,6 +33,12 @@ typedef struct tagUmka
 
     // main() context
     UmkaFuncContext mainFn;
+
+    // Program has been compiled from source or loaded from an image
+    bool isCompiled;
+
+    // Instance the compiled program is shared with (clones only)
+    Umka *original;
     
     // Arbitrary metadata
     void *metadata;
@@ -52,5 +58,8 @@ bool compilerAddModule          (Umka *umka, const char *fileName, const char *s
 bool compilerAddClosure         (Umka *umka, const char *name, UmkaExternFunc func, void *upvalue);
 bool compilerGetFunc            (Umka *umka, const char *moduleName, const char *funcName, UmkaFuncContext *fn);
 void compilerMakeFuncContext    (Umka *umka, const Type *fnType, int entryOffset, UmkaFuncContext *fn);
+void compilerSaveImage          (Umka *umka, const char *fileName);
+void compilerLoadImage          (Umka *umka, const char *fileName);
+void compilerClone              (Umka *umka, Umka *original);
 
 #endif // UMKA_COMPILER_H_INCLUDED
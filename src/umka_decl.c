@@ -380,7 +380,7 @@ static const Type *parseMapType(Umka *umka)
     if (!typeValidOperator(keyType, TOK_EQEQ))
         umka->error.handler(umka->error.context, "Map key type is not comparable");
 
-    const Type *ptrKeyType = typeAddPtrTo(&umka->types, &umka->blocks, keyType);
+    typeMakeComparePlan(&umka->types, keyType);
 
     lexEat(&umka->lex, TOK_RBRACKET);
 
@@ -390,18 +390,25 @@ static const Type *parseMapType(Umka *umka)
 
     const Type *ptrItemType = typeAddPtrTo(&umka->types, &umka->blocks, itemType);
 
-    // The map base type is the Umka equivalent of MapNode
+    // The Umka equivalent of MapEntry. Keys are stored in place, items are not, since the item type may be a forward type
+    Type *entryType = typeAdd(&umka->types, &umka->blocks, TYPE_STRUCT);
+
+    typeAddField(&umka->types, entryType, umka->types.predecl.uintType, "#hash");
+    typeAddField(&umka->types, entryType, ptrItemType,                  "#data");
+    typeAddField(&umka->types, entryType, keyType,                      "#key");
+
+    Type *entriesType = typeAdd(&umka->types, &umka->blocks, TYPE_DYNARRAY);
+    typeSetBase(entriesType, entryType);
+
+    // The map base type is a pointer to the Umka equivalent of MapNode
     Type *nodeType = typeAdd(&umka->types, &umka->blocks, TYPE_STRUCT);
     const Type *ptrNodeType = typeAddPtrTo(&umka->types, &umka->blocks, nodeType);
 
     typeAddField(&umka->types, nodeType, umka->types.predecl.intType, "#len");
-    typeAddField(&umka->types, nodeType, umka->types.predecl.intType, "#priority");
-    typeAddField(&umka->types, nodeType, ptrKeyType,                  "#key");
-    typeAddField(&umka->types, nodeType, ptrItemType,                 "#data");
-    typeAddField(&umka->types, nodeType, ptrNodeType,                 "#left");
-    typeAddField(&umka->types, nodeType, ptrNodeType,                 "#right");
+    typeAddField(&umka->types, nodeType, umka->types.predecl.intType, "#numdeleted");
+    typeAddField(&umka->types, nodeType, entriesType,                 "#entries");
 
-    typeSetBase(type, nodeType);
+    typeSetBase(type, ptrNodeType);
     return type;
 }
 
@@ -436,6 +443,16 @@ static const Type *parseStructType(Umka *umka)
 }
 
 
+static void doAddInterfaceMethod(Umka *umka, Type *type, const Type *methodType, const char *methodName)
+{
+    // The method table pointer is only needed in interfaces with methods, so that interface {} remains equivalent to any
+    if (type->numItems == INTERFACE_FIELD_ITABLE)
+        typeAddField(&umka->types, type, umka->types.predecl.ptrVoidType, "#itable");
+
+    typeAddField(&umka->types, type, methodType, methodName);
+}
+
+
 // interfaceType = "interface" "{" {(ident signature | qualIdent) ";"} "}"
 static const Type *parseInterfaceType(Umka *umka)
 {
@@ -468,7 +485,7 @@ static const Type *parseInterfaceType(Umka *umka)
             typeAddParam(&umka->types, methodType->sig, umka->types.predecl.ptrVoidType, "#self", (Const){0});
             parseSignature(umka, methodType->sig);
 
-            typeAddField(&umka->types, type, methodType, methodName);
+            doAddInterfaceMethod(umka, type, methodType, methodName);
         }
         else
         {
@@ -478,12 +495,12 @@ static const Type *parseInterfaceType(Umka *umka)
             if (embeddedType->kind != TYPE_INTERFACE)
                 umka->error.handler(umka->error.context, "Interface type expected");
 
-            for (int i = 2; i < embeddedType->numItems; i++)    // Skip #self and #selftype in embedded interface
+            for (int i = INTERFACE_FIELD_FIRST_METHOD; i < embeddedType->numItems; i++)    // Skip #self, #selftype and #itable in embedded interface
             {
                 Type *methodType = typeAdd(&umka->types, &umka->blocks, TYPE_FN);
                 typeDeepCopy(&umka->storage, methodType, embeddedType->field[i]->type);
 
-                typeAddField(&umka->types, type, methodType, embeddedType->field[i]->name);
+                doAddInterfaceMethod(umka, type, methodType, embeddedType->field[i]->name);
             }
         }
 
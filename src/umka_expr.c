@@ -65,9 +65,39 @@ static bool doTryRemoveCopyResultToTempVar(Umka *umka)
 }
 
 
+bool doTryMoveFromTempVar(Umka *umka, const Type *type)
+{
+    // Optimization: If the right-hand side is a composite literal, its temporary variable is never used again
+    // The left-hand side can take over the references held by the temporary variable, so they need not be incremented here and decremented on exit
+
+    if (!umka->idents.lastTempVarForLiteral)
+        return false;
+
+    const int tempVarOffset = genTryMoveFromTempVar(&umka->gen);
+    if (tempVarOffset == 0 || tempVarOffset != umka->idents.lastTempVarForLiteral->offset)
+        return false;
+
+    // A pointer to the temporary variable does not take over anything
+    if (!typeEquivalent(type, umka->idents.lastTempVarForLiteral->type))
+        return false;
+
+    umka->idents.lastTempVarForLiteral->isUsed = false;
+    return true;
+}
+
+
+void doReserveTempItem(Umka *umka, const Type *itemType)
+{
+    // Built-in functions that sort the items of a collection need temporary stack space for a single item
+    const int slots = align(typeSize(&umka->types, itemType), sizeof(Slot)) / sizeof(Slot);
+    blocksReserveTempSlots(&umka->blocks, slots);
+    blocksReleaseTempSlots(&umka->blocks, slots);
+}
+
+
 void doTryOptimizeIncRefCnt(Umka *umka, const Type *type)
 {
-    if (doTryRemoveCopyResultToTempVar(umka))
+    if (doTryRemoveCopyResultToTempVar(umka) || doTryMoveFromTempVar(umka, type))
     {
         // Nothing to do
     }
@@ -78,7 +108,7 @@ void doTryOptimizeIncRefCnt(Umka *umka, const Type *type)
 
 void doTryOptimizeRefCntAssign(Umka *umka, const Type *type, bool isOldLhsValid)
 {
-    if (doTryRemoveCopyResultToTempVar(umka))
+    if (doTryRemoveCopyResultToTempVar(umka) || doTryMoveFromTempVar(umka, type))
     {    
         if (isOldLhsValid)
             genLeftRefCntAssign(&umka->gen, type);
@@ -351,6 +381,41 @@ static void doDynArrayToDynArrayConv(Umka *umka, const Type *dest, const Type **
 }
 
 
+static const InterfaceTable *doGetInterfaceTable(Umka *umka, const Type *dest, const Type *src)
+{
+    InterfaceTable *itable = typeFindInterfaceTable(&umka->types, src, dest);
+    if (itable)
+        return itable;
+
+    itable = typeAddInterfaceTable(&umka->types, src, dest);
+
+    for (int i = INTERFACE_FIELD_FIRST_METHOD; i < dest->numItems; i++)
+    {
+        const char *name = dest->field[i]->name;
+
+        const Type *rcvType = src->base;
+        int rcvTypeModule = rcvType->typeIdent ? rcvType->typeIdent->module : -1;
+
+        const Ident *srcMethod = identFind(&umka->idents, &umka->modules, &umka->blocks, rcvTypeModule, name, src, true);
+        if (!srcMethod)
+        {
+            char srcBuf[DEFAULT_STR_LEN + 1], destBuf[DEFAULT_STR_LEN + 1];
+            umka->error.handler(umka->error.context, "Cannot convert %s to %s: method %s is not implemented", typeSpelling(src, srcBuf), typeSpelling(dest, destBuf), name);
+        }
+
+        if (!typeCompatible(dest->field[i]->type, srcMethod->type))
+        {
+            char srcBuf[DEFAULT_STR_LEN + 1], destBuf[DEFAULT_STR_LEN + 1];
+            umka->error.handler(umka->error.context, "Cannot convert %s to %s: method %s has incompatible signature", typeSpelling(src, srcBuf), typeSpelling(dest, destBuf), name);
+        }
+
+        itable->entryOffset[i - INTERFACE_FIELD_FIRST_METHOD] = srcMethod->offset;
+    }
+
+    return itable;
+}
+
+
 static void doPtrToInterfaceConv(Umka *umka, const Type *dest, const Type **src, Const *constant)
 {
     if (constant)
@@ -376,36 +441,18 @@ static void doPtrToInterfaceConv(Umka *umka, const Type *dest, const Type **src,
         genPushLocalPtr(&umka->gen, destOffset + selfType->offset);             // Push dest.#selftype pointer
         genSwapAssign(&umka->gen, TYPE_PTR, 0);                                 // Assign to dest.#selftype
 
-        // Assign to methods
-        for (int i = 2; i < dest->numItems; i++)
+        // Assign to #itable (shared by all conversions from the same type to the same interface)
+        if (dest->numItems > INTERFACE_FIELD_ITABLE)
         {
-            const char *name = dest->field[i]->name;
-
-            const Type *rcvType = (*src)->base;
-            if (rcvType->kind == TYPE_NULL)
-                genPushIntConst(&umka->gen, 0);                                 // Allow assigning null to a non-empty interface
-            else
-            {
-                int rcvTypeModule = rcvType->typeIdent ? rcvType->typeIdent->module : -1;
-
-                const Ident *srcMethod = identFind(&umka->idents, &umka->modules, &umka->blocks, rcvTypeModule, name, *src, true);
-                if (!srcMethod)
-                {
-                    char srcBuf[DEFAULT_STR_LEN + 1], destBuf[DEFAULT_STR_LEN + 1];
-                    umka->error.handler(umka->error.context, "Cannot convert %s to %s: method %s is not implemented", typeSpelling(*src, srcBuf), typeSpelling(dest, destBuf), name);
-                }
+            const Field *itable = dest->field[INTERFACE_FIELD_ITABLE];
 
-                if (!typeCompatible(dest->field[i]->type, srcMethod->type))
-                {
-                    char srcBuf[DEFAULT_STR_LEN + 1], destBuf[DEFAULT_STR_LEN + 1];
-                    umka->error.handler(umka->error.context, "Cannot convert %s to %s: method %s has incompatible signature", typeSpelling(*src, srcBuf), typeSpelling(dest, destBuf), name);
-                }
-
-                genPushIntConst(&umka->gen, srcMethod->offset);                 // Push src value
-            }
+            const InterfaceTable *itableVal = NULL;                             // Allow assigning null to a non-empty interface
+            if ((*src)->base->kind != TYPE_NULL)
+                itableVal = doGetInterfaceTable(umka, dest, *src);
 
-            genPushLocalPtr(&umka->gen, destOffset + dest->field[i]->offset);   // Push dest.method pointer
-            genSwapAssign(&umka->gen, TYPE_FN, 0);                              // Assign to dest.method
+            genPushGlobalPtr(&umka->gen, (InterfaceTable *)itableVal);          // Push src table
+            genPushLocalPtr(&umka->gen, destOffset + itable->offset);           // Push dest.#itable pointer
+            genSwapAssign(&umka->gen, TYPE_PTR, 0);                             // Assign to dest.#itable
         }
 
         genPushLocalPtr(&umka->gen, destOffset);
@@ -437,28 +484,44 @@ static void doInterfaceToInterfaceConv(Umka *umka, const Type *dest, const Type
     genPushLocalPtr(&umka->gen, destOffset + selfType->offset);             // Push dest.#selftype pointer
     genSwapAssign(&umka->gen, TYPE_PTR, 0);                                 // Assign to dest.#selftype
 
-    // Assign to methods
-    for (int i = 2; i < dest->numItems; i++)
+    // Assign to #itable
+    if (dest->numItems > INTERFACE_FIELD_ITABLE)
     {
-        const char *name = dest->field[i]->name;
-        const Field *srcMethod = typeFindField(*src, name, NULL);
-        if (!srcMethod)
-        {
-            char srcBuf[DEFAULT_STR_LEN + 1], destBuf[DEFAULT_STR_LEN + 1];
-            umka->error.handler(umka->error.context, "Cannot convert %s to %s: method %s is not implemented", typeSpelling(*src, srcBuf), typeSpelling(dest, destBuf), name);
-        }
+        // If dest methods are the leading src methods, the src table can be shared. Otherwise, a table derived from it is needed
+        bool sameTable = true;
 
-        if (!typeCompatible(dest->field[i]->type, srcMethod->type))
+        for (int i = INTERFACE_FIELD_FIRST_METHOD; i < dest->numItems; i++)
         {
-            char srcBuf[DEFAULT_STR_LEN + 1], destBuf[DEFAULT_STR_LEN + 1];
-            umka->error.handler(umka->error.context, "Cannot convert %s to %s: method %s has incompatible signature", typeSpelling(*src, srcBuf), typeSpelling(dest, destBuf), name);
+            const char *name = dest->field[i]->name;
+            const Field *srcMethod = typeFindField(*src, name, NULL);
+            if (!srcMethod)
+            {
+                char srcBuf[DEFAULT_STR_LEN + 1], destBuf[DEFAULT_STR_LEN + 1];
+                umka->error.handler(umka->error.context, "Cannot convert %s to %s: method %s is not implemented", typeSpelling(*src, srcBuf), typeSpelling(dest, destBuf), name);
+            }
+
+            if (!typeCompatible(dest->field[i]->type, srcMethod->type))
+            {
+                char srcBuf[DEFAULT_STR_LEN + 1], destBuf[DEFAULT_STR_LEN + 1];
+                umka->error.handler(umka->error.context, "Cannot convert %s to %s: method %s has incompatible signature", typeSpelling(*src, srcBuf), typeSpelling(dest, destBuf), name);
+            }
+
+            if (srcMethod->offset != dest->field[i]->offset)
+                sameTable = false;
         }
 
+        const Field *srcItable = (*src)->field[INTERFACE_FIELD_ITABLE];
+        const Field *destItable = dest->field[INTERFACE_FIELD_ITABLE];
+
         genDup(&umka->gen);                                                 // Duplicate src pointer
-        genGetFieldPtr(&umka->gen, srcMethod->offset);                      // Get src.method pointer
-        genDeref(&umka->gen, TYPE_FN);                                      // Get src.method value (entry point)
-        genPushLocalPtr(&umka->gen, destOffset + dest->field[i]->offset);   // Push dest.method pointer
-        genSwapAssign(&umka->gen, TYPE_FN, 0);                              // Assign to dest.method
+        genGetFieldPtr(&umka->gen, srcItable->offset);                      // Get src.#itable pointer
+        genDeref(&umka->gen, TYPE_PTR);                                     // Get src.#itable value
+
+        if (!sameTable)
+            genConvertItable(&umka->gen, dest);                             // Get or build the table derived from src.#itable
+
+        genPushLocalPtr(&umka->gen, destOffset + destItable->offset);       // Push dest.#itable pointer
+        genSwapAssign(&umka->gen, TYPE_PTR, 0);                             // Assign to dest.#itable
     }
 
     genPop(&umka->gen);                                                     // Remove src pointer
@@ -769,6 +832,13 @@ static void doApplyStrCat(Umka *umka, Const *constant, const Const *rightConstan
 }
 
 
+static void doApplyStrCatN(Umka *umka, int numOperands)
+{
+    genStrConcatN(&umka->gen, numOperands);
+    doCopyResultToTempVar(umka, umka->types.predecl.strType);
+}
+
+
 void doApplyOperator(Umka *umka, const Type **type, const Type **rightType, Const *constant, Const *rightConstant, TokenKind op, bool apply, bool convertLhs)
 {
     // First, the right-hand side type is converted to the left-hand side type
@@ -857,9 +927,21 @@ static void parseBuiltinIOCall(Umka *umka, const Type **type, Const *constant, B
             formatLiteral = umka->lex.tok.strVal;
     }
 
-    *type = umka->types.predecl.strType;
-    parseExpr(umka, type, constant);
-    typeAssertCompatible(&umka->types, umka->types.predecl.strType, *type);
+    // printf(), fprintf() and sprintf() with a format string literal print each value with a format string part prepared at compile time.
+    // The format string itself is not pushed
+    const bool isPrintf = builtin == BUILTIN_PRINTF || builtin == BUILTIN_FPRINTF || builtin == BUILTIN_SPRINTF;
+    const bool hasFormatSegments = isPrintf && formatLiteral;
+
+    if (hasFormatSegments)
+    {
+        lexNext(&umka->lex);
+    }
+    else
+    {
+        *type = umka->types.predecl.strType;
+        parseExpr(umka, type, constant);
+        typeAssertCompatible(&umka->types, umka->types.predecl.strType, *type);
+    }
 
     // Values, if any
     int formatLen = -1, typeLetterPos = -1;
@@ -872,6 +954,8 @@ static void parseBuiltinIOCall(Umka *umka, const Type **type, Const *constant, B
         *type = NULL;
         parseExpr(umka, type, constant);
 
+        const char *segmentFormat = formatLiteral;
+
         if (formatLiteral)
         {
             if (!typeFormatStringValid(formatLiteral, &formatLen, &typeLetterPos, &expectedTypeKind, &formatStringTypeSize))
@@ -884,12 +968,17 @@ static void parseBuiltinIOCall(Umka *umka, const Type **type, Const *constant, B
         if (builtin == BUILTIN_SCANF || builtin == BUILTIN_FSCANF || builtin == BUILTIN_SSCANF)
             *type = (*type)->base;
 
-        genCallTypedBuiltin(&umka->gen, *type, builtin); 
+        if (hasFormatSegments)
+            genCallPrintf(&umka->gen, typeMakeFormatSegment(&umka->types, builtin, segmentFormat, *type));
+        else
+            genCallTypedBuiltin(&umka->gen, *type, builtin); 
     } // while
 
     // The rest of format string
     genPushIntConst(&umka->gen, 0);
 
+    const char *segmentFormat = formatLiteral;
+
     if (formatLiteral)
     {
         if (!typeFormatStringValid(formatLiteral, &formatLen, &typeLetterPos, &expectedTypeKind, &formatStringTypeSize))
@@ -903,9 +992,16 @@ static void parseBuiltinIOCall(Umka *umka, const Type **type, Const *constant, B
         *type = umka->types.predecl.voidType;
 
     typeAssertCompatibleIOBuiltin(&umka->types, expectedTypeKind, *type, builtin, true);
-    genCallTypedBuiltin(&umka->gen, umka->types.predecl.voidType, builtin);
 
-    genPop(&umka->gen);                         // Remove format string
+    if (hasFormatSegments)
+    {
+        genCallPrintf(&umka->gen, typeMakeFormatSegment(&umka->types, builtin, segmentFormat, NULL));
+    }
+    else
+    {
+        genCallTypedBuiltin(&umka->gen, umka->types.predecl.voidType, builtin);
+        genPop(&umka->gen);                     // Remove format string
+    }
 
     // Result
     if (builtin == BUILTIN_SPRINTF)
@@ -980,7 +1076,8 @@ static void parseBuiltinNewCall(Umka *umka, const Type **type, Const *constant)
         parseExpr(umka, &exprType, NULL);
         doAssertImplicitTypeConv(umka, *type, &exprType, NULL);
 
-        genRefCntAssign(&umka->gen, *type);
+        // New heap chunks are zeroed, so there is no old value to release
+        doTryOptimizeRefCntAssign(umka, *type, false);
     }
 
     *type = typeAddPtrTo(&umka->types, &umka->blocks, *type);
@@ -989,7 +1086,7 @@ static void parseBuiltinNewCall(Umka *umka, const Type **type, Const *constant)
 
 // fn make(type: Type, len: int): type
 // fn make(type: Type): type
-// fn make(type: Type, childFunc: fn()): type
+// fn make(type: Type, childFunc: fn() [, stackSize: int]): type
 static void parseBuiltinMakeCall(Umka *umka, const Type **type, Const *constant)
 {
     if (constant)
@@ -1025,6 +1122,18 @@ static void parseBuiltinMakeCall(Umka *umka, const Type **type, Const *constant)
         const Type *fiberClosureType = umka->types.predecl.fiberType->base;
         parseExpr(umka, &fiberClosureType, constant);
         doAssertImplicitTypeConv(umka, umka->types.predecl.fiberType->base, &fiberClosureType, NULL);
+
+        // Initial stack size (optional)
+        if (umka->lex.tok.kind == TOK_COMMA)
+        {
+            lexNext(&umka->lex);
+
+            const Type *stackSizeType = umka->types.predecl.intType;
+            parseExpr(umka, &stackSizeType, NULL);
+            typeAssertCompatible(&umka->types, umka->types.predecl.intType, stackSizeType);
+        }
+        else
+            genPushIntConst(&umka->gen, 0);
     }
     else
         umka->error.handler(umka->error.context, "Illegal type");
@@ -1253,6 +1362,8 @@ static void parseBuiltinSortCall(Umka *umka, const Type **type, Const *constant)
     const Type *compareOrFlagType = expectedCompareType;
     parseExpr(umka, &compareOrFlagType, NULL);
 
+    doReserveTempItem(umka, (*type)->base);
+
     if (typeEquivalent(compareOrFlagType, umka->types.predecl.boolType))
     {
         // "Fast" form
@@ -1271,6 +1382,8 @@ static void parseBuiltinSortCall(Umka *umka, const Type **type, Const *constant)
 
             lexNext(&umka->lex);
 
+            typeMakeComparePlan(&umka->types, field->type);
+
             genPushIntConst(&umka->gen, field->offset);
             genCallTypedBuiltin(&umka->gen, field->type, BUILTIN_SORTFAST);
         }
@@ -1279,6 +1392,8 @@ static void parseBuiltinSortCall(Umka *umka, const Type **type, Const *constant)
             // Item type is comparable
             typeAssertValidOperator(&umka->types, (*type)->base, TOK_LESS);
 
+            typeMakeComparePlan(&umka->types, (*type)->base);
+
             genPushIntConst(&umka->gen, 0);
             genCallTypedBuiltin(&umka->gen, (*type)->base, BUILTIN_SORTFAST);
         }
@@ -1561,6 +1676,7 @@ static void parseBuiltinKeysCall(Umka *umka, const Type **type, Const *constant)
     const int resultOffset = identAllocStack(&umka->idents, &umka->types, &umka->blocks, keysType);
     genPushLocalPtr(&umka->gen, resultOffset);
 
+    doReserveTempItem(umka, keysType->base);
     genCallTypedBuiltin(&umka->gen, keysType, BUILTIN_KEYS);
     *type = keysType;
 }
@@ -1817,6 +1933,10 @@ static void parseActualParamsAndCall(Umka *umka, const Type **type)
     if (typeStructured((*type)->sig->resultType))
         numPostHiddenParams++;
 
+    // Parameters stay on the stack until the call returns
+    const int paramSlots = typeParamSizeTotal(&umka->types, (*type)->sig) / sizeof(Slot);
+    blocksReserveTempSlots(&umka->blocks, paramSlots);
+
     if (umka->lex.tok.kind != TOK_RPAR)
     {
         while (1)
@@ -1904,13 +2024,14 @@ static void parseActualParamsAndCall(Umka *umka, const Type **type)
         genCall(&umka->gen, immediateEntryPoint);                                           // Direct call
     else if (immediateEntryPoint < 0)
     {
-        const int paramSlots = typeParamSizeTotal(&umka->types, (*type)->sig) / sizeof(Slot);
         genCallIndirect(&umka->gen, paramSlots);                                            // Indirect call
         genPop(&umka->gen);                                                                 // Pop entry point
     }
     else
         umka->error.handler(umka->error.context, "Called function is not defined");
 
+    blocksReleaseTempSlots(&umka->blocks, paramSlots);
+
     *type = (*type)->sig->resultType;
 
     lexEat(&umka->lex, TOK_RPAR);
@@ -2019,7 +2140,7 @@ static void parseArrayOrStructLiteral(Umka *umka, const Type **type, Const *cons
         fieldInitialized = storageAdd(&umka->storage, (*type)->numItems + 1);
 
     const int size = typeSize(&umka->types, *type);
-    const Ident *arrayOrStruct = NULL;
+    Ident *arrayOrStruct = NULL;
 
     if (constant)
     {
@@ -2096,7 +2217,15 @@ static void parseArrayOrStructLiteral(Umka *umka, const Type **type, Const *cons
         umka->error.handler(umka->error.context, "Too few elements in literal");
 
     if (!constant)
-        doPushVarPtr(umka, arrayOrStruct);
+    {
+        if (arrayOrStruct->block == 0)
+            doPushVarPtr(umka, arrayOrStruct);
+        else
+        {
+            umka->idents.lastTempVarForLiteral = arrayOrStruct;
+            genPushTempVarPtr(&umka->gen, arrayOrStruct->offset);
+        }
+    }
 
     // Allow closing brace on a new line
     if (umka->lex.tok.kind == TOK_IMPLICIT_SEMICOLON)
@@ -2612,13 +2741,16 @@ static void parseFieldSelector(Umka *umka, const Type **type, bool *isVar, bool
         const Field *field = typeAssertFindField(&umka->types, *type, umka->lex.tok.name, NULL);
         lexNext(&umka->lex);
 
-        // Save interface method's receiver to dedicated register
-        if (field->type->kind == TYPE_FN && field->type->sig->isInterfaceMethod)
+        // Save interface method's receiver to dedicated register and push method's entry point from the interface table
+        if ((*type)->kind == TYPE_INTERFACE && field->type->kind == TYPE_FN)
         {
-            genDup(&umka->gen);
-            genDeref(&umka->gen, TYPE_PTR);
-            genPopReg(&umka->gen, REG_SELF);
-        }        
+            genGetMethod(&umka->gen, field->offset);
+
+            *type = field->type;
+            *isVar = false;
+            *isCall = false;
+            return;
+        }
 
         genGetFieldPtr(&umka->gen, field->offset);
 
@@ -2940,6 +3072,9 @@ static void parseRelationTerm(Umka *umka, const Type **type, Const *constant)
 {
     parseTerm(umka, type, constant);
 
+    // Strings to be concatenated are left on the stack and then concatenated at once
+    int numStrOperands = 1;
+
     while (umka->lex.tok.kind == TOK_PLUS || umka->lex.tok.kind == TOK_MINUS ||
            umka->lex.tok.kind == TOK_OR   || umka->lex.tok.kind == TOK_XOR)
     {
@@ -2952,10 +3087,24 @@ static void parseRelationTerm(Umka *umka, const Type **type, Const *constant)
         else
             rightConstant = NULL;
 
+        const bool strCat = !constant && op == TOK_PLUS && (*type)->kind == TYPE_STR;
+
+        if (strCat && numStrOperands == MAX_CONCAT_OPERANDS)
+        {
+            doApplyStrCatN(umka, numStrOperands);
+            numStrOperands = 1;
+        }
+
         const Type *rightType = *type;
         parseTerm(umka, &rightType, rightConstant);
-        doApplyOperator(umka, type, &rightType, constant, rightConstant, op, true, true);
+        doApplyOperator(umka, type, &rightType, constant, rightConstant, op, !strCat, true);
+
+        if (strCat)
+            numStrOperands++;
     }
+
+    if (numStrOperands > 1)
+        doApplyStrCatN(umka, numStrOperands);
 }
 
 
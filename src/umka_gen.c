@@ -364,6 +364,14 @@ static bool optimizeUnary(CodeGen *gen, TokenKind tokKind, const Type *type)
         return true;
     }
 
+    // Optimization: PUSH_LOCAL_PTR + UNARY ++/-- (64-bit integer) -> INC_LOCAL_INT / DEC_LOCAL_INT
+    if (prev && prev->opcode == OP_PUSH_LOCAL_PTR && (tokKind == TOK_PLUSPLUS || tokKind == TOK_MINUSMINUS) && (type->kind == TYPE_INT || type->kind == TYPE_UINT))
+    {
+        prev->opcode = (tokKind == TOK_PLUSPLUS) ? OP_INC_LOCAL_INT : OP_DEC_LOCAL_INT;
+        genUnnotify(gen);
+        return true;
+    }
+
     return false;
 }
 
@@ -504,6 +512,111 @@ static bool optimizeCallBuiltin(CodeGen *gen, TypeKind typeKind, BuiltinFunc bui
 }
 
 
+static Opcode getFusedGotoIfOpcode(Opcode cmpOpcode, bool negate)
+{
+    // Integer comparisons can be negated exactly, so that GOTO_IF_NOT is also expressible as GOTO_IF
+    switch (cmpOpcode)
+    {
+        case OP_EQ_INT:             return negate ? OP_GOTO_IF_NOT_EQ_INT     : OP_GOTO_IF_EQ_INT;
+        case OP_NOT_EQ_INT:         return negate ? OP_GOTO_IF_EQ_INT         : OP_GOTO_IF_NOT_EQ_INT;
+        case OP_GREATER_INT:        return negate ? OP_GOTO_IF_LESS_EQ_INT    : OP_GOTO_IF_GREATER_INT;
+        case OP_LESS_INT:           return negate ? OP_GOTO_IF_GREATER_EQ_INT : OP_GOTO_IF_LESS_INT;
+        case OP_GREATER_EQ_INT:     return negate ? OP_GOTO_IF_LESS_INT       : OP_GOTO_IF_GREATER_EQ_INT;
+        case OP_LESS_EQ_INT:        return negate ? OP_GOTO_IF_GREATER_INT    : OP_GOTO_IF_LESS_EQ_INT;
+        default:                    return OP_NOP;
+    }
+}
+
+
+static bool optimizeGotoIfStub(CodeGen *gen, int dest, bool negate)
+{
+    // The instruction being fixed up is a stub produced by genCondGotoStub()
+    const Instruction *stub = &gen->code[gen->ip];
+
+    // Optimization: integer comparison + GOTO_IF / GOTO_IF_NOT -> GOTO_IF_<comparison>_INT
+    const Opcode opcode = getFusedGotoIfOpcode(stub->opcode, negate);
+    if (opcode != OP_NOP)
+    {
+        genUpdateLastJump(gen, gen->ip);
+        genUpdateLastJump(gen, dest);
+
+        const Instruction instr = {.opcode = opcode, .tokKind = TOK_NONE, .type = stub->type, .operand.intVal = dest};
+        genAddInstr(gen, &instr);
+        return true;
+    }
+
+    return false;
+}
+
+
+// Instruction specialization
+
+static Opcode specializeUnary(TokenKind tokKind, const Type *type)
+{
+    // Specialized opcodes for the most frequent operand types, OP_UNARY for all others
+    if (typeOrdinal(type))
+    {
+        switch (tokKind)
+        {
+            case TOK_MINUS:         return OP_NEG_INT;
+            case TOK_PLUSPLUS:      return (type->kind == TYPE_INT || type->kind == TYPE_UINT) ? OP_INC_INT : OP_UNARY;
+            case TOK_MINUSMINUS:    return (type->kind == TYPE_INT || type->kind == TYPE_UINT) ? OP_DEC_INT : OP_UNARY;
+            default:                return OP_UNARY;
+        }
+    }
+
+    if (typeReal(type))
+        return (tokKind == TOK_MINUS) ? OP_NEG_REAL : OP_UNARY;
+
+    return OP_UNARY;
+}
+
+
+static Opcode specializeBinary(TokenKind tokKind, const Type *type)
+{
+    // Specialized opcodes for the most frequent operand types, OP_BINARY for all others (strings, structures, arrays, etc.)
+    if (typeOrdinal(type))
+    {
+        // Unsigned comparisons cannot share the signed opcodes
+        const bool isUInt = type->kind == TYPE_UINT;
+
+        switch (tokKind)
+        {
+            case TOK_PLUS:          return OP_ADD_INT;
+            case TOK_MINUS:         return OP_SUB_INT;
+            case TOK_MUL:           return OP_MUL_INT;
+            case TOK_EQEQ:          return OP_EQ_INT;
+            case TOK_NOTEQ:         return OP_NOT_EQ_INT;
+            case TOK_GREATER:       return isUInt ? OP_BINARY : OP_GREATER_INT;
+            case TOK_LESS:          return isUInt ? OP_BINARY : OP_LESS_INT;
+            case TOK_GREATEREQ:     return isUInt ? OP_BINARY : OP_GREATER_EQ_INT;
+            case TOK_LESSEQ:        return isUInt ? OP_BINARY : OP_LESS_EQ_INT;
+            default:                return OP_BINARY;
+        }
+    }
+
+    if (typeReal(type))
+    {
+        switch (tokKind)
+        {
+            case TOK_PLUS:          return OP_ADD_REAL;
+            case TOK_MINUS:         return OP_SUB_REAL;
+            case TOK_MUL:           return OP_MUL_REAL;
+            case TOK_DIV:           return OP_DIV_REAL;
+            case TOK_EQEQ:          return OP_EQ_REAL;
+            case TOK_NOTEQ:         return OP_NOT_EQ_REAL;
+            case TOK_GREATER:       return OP_GREATER_REAL;
+            case TOK_LESS:          return OP_LESS_REAL;
+            case TOK_GREATEREQ:     return OP_GREATER_EQ_REAL;
+            case TOK_LESSEQ:        return OP_LESS_EQ_REAL;
+            default:                return OP_BINARY;
+        }
+    }
+
+    return OP_BINARY;
+}
+
+
 // Atomic VM instructions
 
 void genNop(CodeGen *gen)
@@ -744,7 +857,8 @@ void genUnary(CodeGen *gen, TokenKind tokKind, const Type *type)
 {
     if (!optimizeUnary(gen, tokKind, type))
     {
-        const Instruction instr = {.opcode = OP_UNARY, .tokKind = tokKind, .type = type};
+        const Opcode opcode = specializeUnary(tokKind, type);
+        const Instruction instr = {.opcode = opcode, .tokKind = (opcode == OP_UNARY) ? tokKind : TOK_NONE, .type = type};
         genAddInstr(gen, &instr);
     }
 }
@@ -754,12 +868,20 @@ void genBinary(CodeGen *gen, TokenKind tokKind, const Type *type)
 {
     if (!optimizeBinary(gen, tokKind, type))
     {
-        const Instruction instr = {.opcode = OP_BINARY, .tokKind = tokKind, .type = type};
+        const Opcode opcode = specializeBinary(tokKind, type);
+        const Instruction instr = {.opcode = opcode, .tokKind = (opcode == OP_BINARY) ? tokKind : TOK_NONE, .type = type};
         genAddInstr(gen, &instr);
     }
 }
 
 
+void genStrConcatN(CodeGen *gen, int numOperands)
+{
+    const Instruction instr = {.opcode = OP_STR_CONCAT_N, .tokKind = TOK_NONE, .typeKind = TYPE_NONE, .operand.intVal = numOperands};
+    genAddInstr(gen, &instr);
+}
+
+
 void genGetArrayPtr(CodeGen *gen, int itemSize, int len)
 {
     if (!optimizeGetArrayPtr(gen, itemSize, len))
@@ -794,6 +916,13 @@ void genGetFieldPtr(CodeGen *gen, int fieldOffset)
 }
 
 
+void genGetMethod(CodeGen *gen, int methodOffset)
+{
+    const Instruction instr = {.opcode = OP_GET_METHOD, .tokKind = TOK_NONE, .typeKind = TYPE_NONE, .operand.intVal = methodOffset};
+    genAddInstr(gen, &instr);
+}
+
+
 void genAssertType(CodeGen *gen, const Type *type)
 {
     const Instruction instr = {.opcode = OP_ASSERT_TYPE, .tokKind = TOK_NONE, .type = type};
@@ -808,6 +937,13 @@ void genAssertRange(CodeGen *gen, TypeKind destTypeKind, const Type *srcType)
 }
 
 
+void genConvertItable(CodeGen *gen, const Type *destType)
+{
+    const Instruction instr = {.opcode = OP_CONVERT_ITABLE, .tokKind = TOK_NONE, .type = destType};
+    genAddInstr(gen, &instr);
+}
+
+
 void genWeakenPtr(CodeGen *gen)
 {
     const Instruction instr = {.opcode = OP_WEAKEN_PTR, .tokKind = TOK_NONE, .typeKind = TYPE_NONE, .operand.intVal = 0};
@@ -893,6 +1029,13 @@ void genCallTypedBuiltin(CodeGen *gen, const Type *type, BuiltinFunc builtin)
 }
 
 
+void genCallPrintf(CodeGen *gen, const FormatSegment *segment)
+{
+    const Instruction instr = {.opcode = OP_CALL_PRINTF, .tokKind = TOK_NONE, .typeKind = TYPE_NONE, .operand.ptrVal = (FormatSegment *)segment};
+    genAddInstr(gen, &instr);
+}
+
+
 void genReturn(CodeGen *gen, int paramSlots)
 {
     const Instruction instr = {.opcode = OP_RETURN, .tokKind = TOK_NONE, .typeKind = TYPE_NONE, .operand.intVal = paramSlots};
@@ -949,7 +1092,8 @@ void genGoFromToIf(CodeGen *gen, int start, int dest)
 {
     int next = gen->ip;
     gen->ip = start;
-    genGotoIf(gen, dest);
+    if (!optimizeGotoIfStub(gen, dest, false))
+        genGotoIf(gen, dest);
     gen->ip = next;
 }
 
@@ -958,15 +1102,34 @@ void genGoFromToIfNot(CodeGen *gen, int start, int dest)
 {
     int next = gen->ip;
     gen->ip = start;
-    genGotoIfNot(gen, dest);
+    if (!optimizeGotoIfStub(gen, dest, true))
+        genGotoIfNot(gen, dest);
     gen->ip = next;
 }
 
 
-void genIfCondEpilog(CodeGen *gen)
+static void genCondGotoStub(CodeGen *gen)
 {
+    Instruction *prev = getPrevInstr(gen, 1);
+
+    // An integer comparison immediately preceding a conditional jump is moved into the stub, to be fused with the jump on fixup
+    if (prev && getFusedGotoIfOpcode(prev->opcode, false) != OP_NOP)
+    {
+        const Instruction cmp = *prev;
+        genRemoveInstr(gen);
+        genSavePos(gen);
+        genAddInstr(gen, &cmp);
+        return;
+    }
+
     genSavePos(gen);
-    genNop(gen);                                            // Goto "else" block start / statement end (stub)
+    genNop(gen);
+}
+
+
+void genIfCondEpilog(CodeGen *gen)
+{
+    genCondGotoStub(gen);                                   // Goto "else" block start / statement end (stub)
 }
 
 
@@ -1001,8 +1164,7 @@ void genCaseConstantCheck(CodeGen *gen, const Type *type, Const *constant)
     genPushReg(gen, REG_SWITCH_EXPR);                       // Compare switch expression to case constant
     genPushIntConst(gen, constant->intVal);
     genBinary(gen, TOK_EQEQ, type);
-    genSavePos(gen);
-    genNop(gen);                                            // Goto "case" block start (stub)
+    genCondGotoStub(gen);                                   // Goto "case" block start (stub)
 }
 
 
@@ -1058,8 +1220,7 @@ void genForCondProlog(CodeGen *gen)
 
 void genForCondEpilog(CodeGen *gen)
 {
-    genSavePos(gen);
-    genNop(gen);                                            // Goto post-statement end (stub)
+    genCondGotoStub(gen);                                   // Goto post-statement end (stub)
     genNop(gen);                                            // Goto statement end (stub)
 }
 
@@ -1200,6 +1361,30 @@ int genTryRemoveCopyResultToTempVar(CodeGen *gen)
 }
 
 
+void genPushTempVarPtr(CodeGen *gen, int offset)
+{
+    genPushLocalPtr(gen, offset);
+    genNotify(gen, GEN_NOTIFICATION_PUSH_TEMP_VAR_PTR);
+}
+
+
+int genTryMoveFromTempVar(CodeGen *gen)
+{
+    if (!genJustNotified(gen, GEN_NOTIFICATION_PUSH_TEMP_VAR_PTR))
+        return 0;
+
+    const Instruction *prev = getPrevInstr(gen, 1);
+
+    if (prev && prev->opcode == OP_PUSH_LOCAL_PTR)
+        return prev->operand.intVal;
+
+    if (prev && prev->opcode == OP_PUSH_LOCAL_PTR_ZERO)
+        return prev->operand.int32Val[0];
+
+    return 0;
+}
+
+
 
 // Assembly output
 
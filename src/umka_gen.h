@@ -17,7 +17,8 @@ typedef struct
 typedef enum
 {
     GEN_NOTIFICATION_NONE,
-    GEN_NOTIFICATION_COPY_RESULT_TO_TEMP_VAR
+    GEN_NOTIFICATION_COPY_RESULT_TO_TEMP_VAR,
+    GEN_NOTIFICATION_PUSH_TEMP_VAR_PTR
 } GenNotificationKind;
 
 
@@ -83,14 +84,17 @@ void genLeftRefCntAssign  (CodeGen *gen, const Type *type);
 
 void genUnary (CodeGen *gen, TokenKind tokKind, const Type *type);
 void genBinary(CodeGen *gen, TokenKind tokKind, const Type *type);
+void genStrConcatN(CodeGen *gen, int numOperands);
 
 void genGetArrayPtr   (CodeGen *gen, int itemSize, int len);
 void genGetDynArrayPtr(CodeGen *gen);
 void genGetMapPtr     (CodeGen *gen, const Type *mapType);
 void genGetFieldPtr   (CodeGen *gen, int fieldOffset);
+void genGetMethod     (CodeGen *gen, int methodOffset);
 
 void genAssertType   (CodeGen *gen, const Type *type);
 void genAssertRange  (CodeGen *gen, TypeKind destTypeKind, const Type *srcType);
+void genConvertItable(CodeGen *gen, const Type *destType);
 
 void genWeakenPtr    (CodeGen *gen);
 void genStrengthenPtr(CodeGen *gen);
@@ -104,6 +108,7 @@ void genCallIndirect        (CodeGen *gen, int paramSlots);
 void genCallExtern          (CodeGen *gen, void *entry);
 void genCallBuiltin         (CodeGen *gen, TypeKind typeKind, BuiltinFunc builtin);
 void genCallTypedBuiltin    (CodeGen *gen, const Type *type, BuiltinFunc builtin);
+void genCallPrintf          (CodeGen *gen, const FormatSegment *segment);
 void genReturn              (CodeGen *gen, int paramSlots);
 
 void genEnterFrame(CodeGen *gen, const StackFrameLayout *layout);
@@ -153,6 +158,9 @@ void genGotosEpilog (CodeGen *gen, Gotos *gotos);
 void genCopyResultToTempVar(CodeGen *gen, const Type *type, int offset);
 int  genTryRemoveCopyResultToTempVar(CodeGen *gen);
 
+void genPushTempVarPtr(CodeGen *gen, int offset);
+int  genTryMoveFromTempVar(CodeGen *gen);
+
 int genAsm(CodeGen *gen, const Idents *idents, char *buf, int size);
 
 #endif // UMKA_GEN_H_INCLUDED
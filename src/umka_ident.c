@@ -17,10 +17,60 @@ static void identTempName(Idents *idents, char *buf)
 }
 
 
+static uint64_t identHash(const char *name)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char *ch = name; *ch; ch++)
+        hash = (hash ^ (unsigned char)(*ch)) * 1099511628211ULL;
+    return hash;
+}
+
+
+static Ident **identBucket(const Idents *idents, uint64_t hash)
+{
+    return &idents->bucket[hash & (idents->numBuckets - 1)];
+}
+
+
+static void identGrow(Idents *idents)
+{
+    const int64_t numBuckets = 2 * idents->numBuckets;
+    Ident **bucket = storageAdd(idents->storage, numBuckets * sizeof(Ident *));
+
+    for (int64_t i = 0; i < idents->numBuckets; i++)
+    {
+        Ident *ident = idents->bucket[i];
+        while (ident)
+        {
+            Ident *next = ident->nextInBucket;
+
+            // Append to the tail of the new chain to keep it sorted by block scope
+            Ident **tail = &bucket[ident->hash & (numBuckets - 1)];
+            while (*tail)
+                tail = &(*tail)->nextInBucket;
+
+            ident->nextInBucket = NULL;
+            *tail = ident;
+
+            ident = next;
+        }
+    }
+
+    storageRemove(idents->storage, idents->bucket);
+    idents->bucket = bucket;
+    idents->numBuckets = numBuckets;
+}
+
+
 void identInit(Idents *idents, Storage *storage, DebugInfo *debug, Error *error)
 {
     idents->first = NULL;
+    idents->numBuckets = IDENT_MIN_BUCKETS;
+    idents->bucket = storageAdd(storage, idents->numBuckets * sizeof(Ident *));
+    idents->numIdents = 0;
     idents->lastTempVarForResult = NULL;
+    idents->lastTempVarForLiteral = NULL;
     idents->tempVarNameSuffix = 0;
     idents->storage = storage;
     idents->debug = debug;
@@ -33,12 +83,22 @@ void identFree(Idents *idents, int block)
     while (idents->first && idents->first->block == block)
     {
         identWarnIfUnused(idents, idents->first);
+
+        Ident **prevInBucket = identBucket(idents, idents->first->hash);
+        while (*prevInBucket != idents->first)
+            prevInBucket = &(*prevInBucket)->nextInBucket;
+
+        *prevInBucket = idents->first->nextInBucket;
+        idents->numIdents--;
         
         Ident *next = idents->first->next;
 
         if (idents->first->isGloballyAllocated)
             storageRemove(idents->storage, idents->first->ptr);
 
+        if (idents->first == idents->lastTempVarForLiteral)
+            idents->lastTempVarForLiteral = NULL;
+
         storageRemove(idents->storage, idents->first);
         idents->first = next;
     }
@@ -47,6 +107,7 @@ void identFree(Idents *idents, int block)
 
 void identMoveBefore(Idents *idents, const Ident *next)
 {
+    // The moved identifier is a temporary one with a unique name, so its position in the hash chain does not matter
     for (Ident *ident = idents->first; ident; ident = ident->next)
     {
         if (ident->next == next)
@@ -66,10 +127,12 @@ void identMoveBefore(Idents *idents, const Ident *next)
 
 static const Ident *identFindEx(const Idents *idents, const Modules *modules, const Blocks *blocks, int module, const char *name, const Type *rcvType, bool markAsUsed, bool isModule)
 {
+    const uint64_t hash = identHash(name);
+
     // Identifiers are always sorted by block scope, deepest (current) block first
-    for (const Ident *ident = idents->first; ident; ident = ident->next)
+    for (const Ident *ident = *identBucket(idents, hash); ident; ident = ident->nextInBucket)
     {
-        if ((ident->kind == IDENT_MODULE) == isModule && strcmp(ident->name, name) == 0)
+        if (ident->hash == hash && (ident->kind == IDENT_MODULE) == isModule && strcmp(ident->name, name) == 0)
         {
             // What we found has correct name and block scope, check module scope
             const bool identModuleValid = (ident->module == 0 && blocks->module == module) ||                                                // Universe module
@@ -233,6 +296,7 @@ static Ident *identAdd(Idents *idents, const Modules *modules, const Blocks *blo
 
     strncpy(ident->name, name, MAX_IDENT_LEN);
     ident->name[MAX_IDENT_LEN] = 0;
+    ident->hash = identHash(ident->name);
 
     ident->type                = type;
     ident->module              = blocks->module;
@@ -248,6 +312,13 @@ static Ident *identAdd(Idents *idents, const Modules *modules, const Blocks *blo
     ident->next   = idents->first;
     idents->first = ident;
 
+    Ident **bucket = identBucket(idents, ident->hash);
+    ident->nextInBucket = *bucket;
+    *bucket = ident;
+
+    if (++idents->numIdents > idents->numBuckets)
+        identGrow(idents);
+
     return ident;
 }
 
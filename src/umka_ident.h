@@ -5,6 +5,12 @@
 #include "umka_vm.h"
 
 
+enum
+{
+    IDENT_MIN_BUCKETS = 1024,           // Initial hash table size
+};
+
+
 typedef enum
 {
     // Built-in functions are treated specially, all other functions are either constants or variables of "fn" type
@@ -20,6 +26,7 @@ typedef struct tagIdent
 {
     IdentKind kind;
     IdentName name;
+    uint64_t hash;                      // Name hash
     const Type *type;
     int module, block;                  // Place of definition (global identifiers are in block 0)
     bool isExported, isGloballyAllocated, isUsed, isTemporary, isGarbageCollected;
@@ -33,14 +40,18 @@ typedef struct tagIdent
         int64_t moduleVal;              // For modules
     };
     DebugInfo debug;
-    struct tagIdent *next;
+    struct tagIdent *next;              // Next identifier in the list sorted by block scope
+    struct tagIdent *nextInBucket;      // Next identifier with the same hash table index. Chains are sorted by block scope as well
 } Ident;
 
 
 typedef struct tagIdents
 {
     Ident *first;
+    Ident **bucket;                     // Hash table of identifier chains
+    int64_t numBuckets, numIdents;      // The number of buckets is a power of two
     Ident *lastTempVarForResult;
+    Ident *lastTempVarForLiteral;
     int tempVarNameSuffix;
     Storage *storage;
     DebugInfo *debug;
@@ -159,7 +159,7 @@ int lexInit(Lexer *lex, Storage *storage, DebugInfo *debug, const char *fileName
     lex->prevTok = lex->tok;
     lex->debug = debug;
     lex->debug->fileName = lex->fileName;
-    lex->debug->fnName = "<unknown>";
+    lex->debug->fnName = unknownName;
     lex->debug->line = lex->line;
 
     return bufLen;
@@ -871,6 +871,9 @@ static void lexStrLiteral(Lexer *lex)
 
     lex->tok.strVal = storageAddStr(lex->storage, size - 1);
     lexStrLiteralAndGetSize(lex);
+
+    // The literal cannot be modified, so its hash can be computed in advance
+    getStrDims(lex->tok.strVal)->hash = hashStr(lex->tok.strVal);
 }
 
 
@@ -3,9 +3,19 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
 
 #include "umka_common.h"
+#include "umka_vm.h"
 #include "umka_runtime.h"
+#include "umka_compiler.h"
 
 
 static void rtlOnFreeFile(UmkaStackSlot *params, UmkaStackSlot *result)
@@ -251,6 +261,112 @@ void rtlfflush(UmkaStackSlot *params, UmkaStackSlot *result)
 }
 
 
+void rtlpipe(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    int64_t *fds = umkaGetParam(params, 0)->ptrVal;
+
+    int pipeFds[2] = {-1, -1};
+
+#ifdef _WIN32
+    int64_t res = _pipe(pipeFds, 65536, _O_BINARY);
+#else
+    // Both ends are non-blocking, so that reading and writing can suspend the current fiber instead of the whole program
+    int64_t res = pipe(pipeFds);
+    if (res == 0)
+    {
+        fcntl(pipeFds[0], F_SETFL, fcntl(pipeFds[0], F_GETFL) | O_NONBLOCK);
+        fcntl(pipeFds[1], F_SETFL, fcntl(pipeFds[1], F_GETFL) | O_NONBLOCK);
+    }
+#endif
+
+    fds[0] = pipeFds[0];
+    fds[1] = pipeFds[1];
+
+    umkaGetResult(params, result)->intVal = res;
+}
+
+
+void rtlpipeSandbox(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    umkaGetResult(params, result)->intVal = -1;
+}
+
+
+void rtlfdread(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    VM *vm = &umkaGetInstance(result)->vm;
+    const int fd = umkaGetParam(params, 0)->intVal;
+    void *buf = umkaGetParam(params, 1)->ptrVal;
+    const int cnt = umkaGetParam(params, 2)->intVal;
+
+#ifdef _WIN32
+    int64_t res = _read(fd, buf, cnt);
+#else
+    int64_t res = read(fd, buf, cnt);
+    if (res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        vmSchedWaitIO(vm, fd, false);
+        res = RTL_IO_SUSPENDED;
+    }
+#endif
+
+    umkaGetResult(params, result)->intVal = res;
+}
+
+
+void rtlfdreadSandbox(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    umkaGetResult(params, result)->intVal = -1;
+}
+
+
+void rtlfdwrite(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    VM *vm = &umkaGetInstance(result)->vm;
+    const int fd = umkaGetParam(params, 0)->intVal;
+    const char *buf = umkaGetParam(params, 1)->ptrVal;
+    const int pos = umkaGetParam(params, 2)->intVal;
+    const int cnt = umkaGetParam(params, 3)->intVal;
+
+#ifdef _WIN32
+    int64_t res = _write(fd, buf + pos, cnt);
+#else
+    int64_t res = write(fd, buf + pos, cnt);
+    if (res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        vmSchedWaitIO(vm, fd, true);
+        res = RTL_IO_SUSPENDED;
+    }
+#endif
+
+    umkaGetResult(params, result)->intVal = res;
+}
+
+
+void rtlfdwriteSandbox(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    umkaGetResult(params, result)->intVal = -1;
+}
+
+
+void rtlfdclose(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    const int fd = umkaGetParam(params, 0)->intVal;
+
+#ifdef _WIN32
+    umkaGetResult(params, result)->intVal = _close(fd);
+#else
+    umkaGetResult(params, result)->intVal = close(fd);
+#endif
+}
+
+
+void rtlfdcloseSandbox(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    umkaGetResult(params, result)->intVal = -1;
+}
+
+
 void rtltime(UmkaStackSlot *params, UmkaStackSlot *result)
 {
     umkaGetResult(params, result)->intVal = time(NULL);
@@ -355,3 +471,70 @@ void rtltrace(UmkaStackSlot *params, UmkaStackSlot *result)
         umkaGetResult(params, result)->intVal = -1;
 }
 
+
+void rtlheapsnapshot(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    DynArray *sites = umkaGetParam(params, 0)->ptrVal;
+    const Type *sitesType = umkaGetBaseType(umkaGetParamType(params, 0));
+
+    Umka *umka = umkaGetInstance(result);
+
+    // Take the snapshot before allocating the result
+    const int numSites = umkaGetHeapSnapshot(umka, NULL, 0);
+    UmkaHeapSite *heapSites = malloc(numSites * sizeof(UmkaHeapSite) + 1);
+    umkaGetHeapSnapshot(umka, heapSites, numSites);
+
+    umkaMakeDynArray(umka, sites, sitesType, numSites);
+
+    for (int i = 0; i < numSites; i++)
+    {
+        char typeBuf[DEFAULT_STR_LEN + 1];
+        RTLHeapSite *site = &((RTLHeapSite *)sites->data)[i];
+
+        site->fileName  = umkaMakeStr(umka, heapSites[i].fileName);
+        site->fnName    = umkaMakeStr(umka, heapSites[i].fnName);
+        site->line      = heapSites[i].line;
+        site->typeName  = umkaMakeStr(umka, heapSites[i].type ? typeSpelling(heapSites[i].type, typeBuf) : "?");
+        site->numChunks = heapSites[i].numChunks;
+        site->size      = heapSites[i].size;
+    }
+
+    free(heapSites);
+}
+
+
+// The scheduler functions get the virtual machine of the calling instance. They may switch to another fiber before returning
+
+void rtlspawn(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    VM *vm = &umkaGetInstance(result)->vm;
+    Fiber *fiber = umkaGetParam(params, 0)->ptrVal;
+
+    vmSchedSpawn(vm, fiber);
+}
+
+
+void rtlyield(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    VM *vm = &umkaGetInstance(result)->vm;
+    vmSchedYield(vm);
+}
+
+
+void rtlsleep(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    VM *vm = &umkaGetInstance(result)->vm;
+    const double delay = umkaGetParam(params, 0)->realVal;
+
+    vmSchedSleep(vm, delay);
+}
+
+
+void rtljoin(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    VM *vm = &umkaGetInstance(result)->vm;
+    Fiber *fiber = umkaGetParam(params, 0)->ptrVal;
+
+    vmSchedJoin(vm, fiber);
+}
+
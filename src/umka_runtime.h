@@ -4,6 +4,12 @@
 #include "umka_api.h"
 
 
+enum
+{
+    RTL_IO_SUSPENDED = -2,      // The fiber has been suspended until the file descriptor gets ready. The call should be repeated
+};
+
+
 typedef struct
 {
     int64_t second, minute, hour;
@@ -21,6 +27,16 @@ typedef struct
 } RTLErrPos;
 
 
+typedef struct
+{
+    char *fileName;
+    char *fnName;
+    int64_t line;
+    char *typeName;
+    int64_t numChunks, size;
+} RTLHeapSite;
+
+
 void rtlmemcpy          (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtlstdin           (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtlstdout          (UmkaStackSlot *params, UmkaStackSlot *result);
@@ -42,6 +58,14 @@ void rtlremoveSandbox   (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtlfeof            (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtlfeofSandbox     (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtlfflush          (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlpipe            (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlpipeSandbox     (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlfdread          (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlfdreadSandbox   (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlfdwrite         (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlfdwriteSandbox  (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlfdclose         (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlfdcloseSandbox  (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtltime            (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtlclock           (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtllocaltime       (UmkaStackSlot *params, UmkaStackSlot *result);
@@ -52,5 +76,10 @@ void rtlgetenvSandbox   (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtlsystem          (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtlsystemSandbox   (UmkaStackSlot *params, UmkaStackSlot *result);
 void rtltrace           (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlheapsnapshot    (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlspawn           (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlyield           (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtlsleep           (UmkaStackSlot *params, UmkaStackSlot *result);
+void rtljoin            (UmkaStackSlot *params, UmkaStackSlot *result);
 
 #endif // UMKA_RUNTIME_H_INCLUDED
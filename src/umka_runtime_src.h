@@ -3,7 +3,7 @@
 
 // This is an automatically generated file. Do not edit it
 
-static const char *runtimeModuleNames[] = {"std.um", "fnc.um", "mat.um", "utf8.um"};
+static const char *runtimeModuleNames[] = {"std.um", "fnc.um", "mat.um", "utf8.um", "sched.um"};
 
 static const char *runtimeModuleSources[] = {
 
@@ -108,6 +108,73 @@ static const char *runtimeModuleSources[] = {
 "    return {}    \n"
 "}\n"
 "\n"
+"type (\n"
+"    HeapSite* = struct {\n"
+"        file: str\n"
+"        func: str\n"
+"        line: int\n"
+"        typeName: str\n"
+"        count: int\n"
+"        size: int\n"
+"    }\n"
+"\n"
+"    HeapSiteKey = struct {\n"
+"        file: str\n"
+"        line: int\n"
+"        typeName: str\n"
+"    }\n"
+")\n"
+"\n"
+"fn rtlheapsnapshot(sites: ^[]HeapSite)\n"
+"\n"
+"fn heapsnapshot*(): []HeapSite {\n"
+"    var sites: []HeapSite\n"
+"    rtlheapsnapshot(&sites)\n"
+"    return sites\n"
+"}\n"
+"\n"
+"fn heapdiff*(before, after: []HeapSite): []HeapSite {\n"
+"    diff := map[HeapSiteKey]HeapSite{}\n"
+"\n"
+"    for _, site in after {\n"
+"        diff[{site.file, site.line, site.typeName}] = site\n"
+"    }\n"
+"\n"
+"    for _, site in before {\n"
+"        key := HeapSiteKey{site.file, site.line, site.typeName}\n"
+"        if !validkey(diff, key) {\n"
+"            diff[key] = {site.file, site.func, site.line, site.typeName, 0, 0}\n"
+"        }\n"
+"        diff[key].count -= site.count\n"
+"        diff[key].size -= site.size\n"
+"    }\n"
+"\n"
+"    var sites: []HeapSite\n"
+"    for _, site in diff {\n"
+"        if site.count != 0 || site.size != 0 {\n"
+"            sites = append(sites, site)\n"
+"        }\n"
+"    }\n"
+"\n"
+"    sort(sites, fn (a, b: ^HeapSite): int {\n"
+"        // Largest sites first\n"
+"        if a.size != b.size {\n"
+"            return a.size < b.size ? 1 : -1\n"
+"        }\n"
+"        if a.file != b.file {\n"
+"            return a.file < b.file ? -1 : 1\n"
+"        }\n"
+"        if a.line != b.line {\n"
+"            return a.line - b.line\n"
+"        }\n"
+"        if a.typeName != b.typeName {\n"
+"            return a.typeName < b.typeName ? -1 : 1\n"
+"        }\n"
+"        return 0\n"
+"    })\n"
+"    return sites\n"
+"}\n"
+"\n"
 "// Input/output\n"
 "\n"
 "type (\n"
@@ -212,10 +279,7 @@ static const char *runtimeModuleSources[] = {
 "fn rtlfread (buf: ^void, size, cnt: int, f: File): int\n"
 "fn rtlfwrite(buf: ^void, size, cnt: int, f: File): int\n"
 "\n"
-"fn freadwrite(f: File, buf: any, reading: bool): (int, Err) {\n"
-"    if f == null {\n"
-"        return 0, stderror(.nullf)\n"
-"    }\n"
+"fn rawbuf(buf: any): (^void, int, Err) {\n"
 "    var data: ^void\n"
 "    var length: int \n"
 "    switch bytes := type(buf) {\n"
@@ -224,16 +288,26 @@ static const char *runtimeModuleSources[] = {
 "        case ^[]char:  length = len(bytes^); if length > 0 {data = &bytes[0]}\n"
 "        default:\n"
 "            if selfhasptr(buf) {\n"
-"                return 0, stderror(.ptr)\n"
+"                return null, 0, stderror(.ptr)\n"
 "            }\n"
 "            length, data = sizeofself(buf), selfptr(buf)\n"
 "    }\n"
+"    return data, length, stderror(.ok)\n"
+"}\n"
+"\n"
+"fn freadwrite(f: File, buf: any, reading: bool): (int, Err) {\n"
+"    if f == null {\n"
+"        return 0, stderror(.nullf)\n"
+"    }\n"
+"    data, length, err := rawbuf(buf)\n"
+"    if err.code != 0 {\n"
+"        return 0, err\n"
+"    }\n"
 "    if length == 0 || data == null {\n"
 "        return 0, stderror(.ok)\n"
 "    }\n"
 "    size := reading ? rtlfread(data, 1, length, f) : rtlfwrite(data, 1, length, f)\n"
-"    err := size == length ? stderror(.ok) : stderror(.eof)\n"
-"    return size, err\n"
+"    return size, size == length ? stderror(.ok) : stderror(.eof)\n"
 "}\n"
 "\n"
 "fn fread*(f: File, buf: any): (int, Err) {\n"
@@ -268,6 +342,62 @@ static const char *runtimeModuleSources[] = {
 "    return freadwrite(f, buf, false)\n"
 "}\n"
 "\n"
+"// Reading and writing file descriptors suspend the current fiber, rather than the whole program, until the file descriptor gets ready\n"
+"\n"
+"const ioSuspended = -2\n"
+"\n"
+"fn rtlpipe(fds: ^[2]int): int\n"
+"\n"
+"fn pipe*(): (int, int, Err) {\n"
+"    var fds: [2]int\n"
+"    if rtlpipe(&fds) != 0 {\n"
+"        return -1, -1, stderror(.eof)\n"
+"    }\n"
+"    return fds[0], fds[1], stderror(.ok)\n"
+"}\n"
+"\n"
+"fn rtlfdread (fd: int, buf: ^void, cnt: int): int\n"
+"fn rtlfdwrite(fd: int, buf: ^void, pos, cnt: int): int\n"
+"fn rtlfdclose(fd: int): int\n"
+"\n"
+"fn fdread*(fd: int, buf: any): (int, Err) {\n"
+"    data, length, err := rawbuf(buf)\n"
+"    if err.code != 0 {\n"
+"        return 0, err\n"
+"    }\n"
+"    if length == 0 || data == null {\n"
+"        return 0, stderror(.ok)\n"
+"    }\n"
+"    size := ioSuspended\n"
+"    for size == ioSuspended {\n"
+"        size = rtlfdread(fd, data, length)\n"
+"    }\n"
+"    return size > 0 ? size : 0, size > 0 ? stderror(.ok) : stderror(.eof)\n"
+"}\n"
+"\n"
+"fn fdwrite*(fd: int, buf: any): (int, Err) {\n"
+"    data, length, err := rawbuf(buf)\n"
+"    if err.code != 0 {\n"
+"        return 0, err\n"
+"    }\n"
+"    pos := 0\n"
+"    for pos < length {\n"
+"        size := rtlfdwrite(fd, data, pos, length - pos)\n"
+"        if size == ioSuspended {\n"
+"            continue\n"
+"        }\n"
+"        if size <= 0 {\n"
+"            return pos, stderror(.eof)\n"
+"        }\n"
+"        pos += size\n"
+"    }\n"
+"    return pos, stderror(.ok)\n"
+"}\n"
+"\n"
+"fn fdclose*(fd: int): Err {\n"
+"    return rtlfdclose(fd) == 0 ? stderror(.ok) : stderror(.eof)\n"
+"}\n"
+"\n"
 "fn println*(s: str): int {\n"
 "    return printf(\"%s\\n\", s)\n"
 "}\n"
@@ -694,6 +824,41 @@ static const char *runtimeModuleSources[] = {
 "\n"
 "    return count\n"
 "}\n"
+" ",
+
+// sched.um
+
+"// Umka cooperative fiber scheduler\n"
+"\n"
+"fn rtlspawn(fib: fiber)\n"
+"\n"
+"// Makes a fiber for calling f and appends it to the run queue. The current fiber continues execution\n"
+"fn spawn*(f: fn(), stackSize: int = 0): fiber {\n"
+"    fib := make(fiber, f, stackSize)\n"
+"    rtlspawn(fib)\n"
+"    return fib\n"
+"}\n"
+"\n"
+"fn rtlyield()\n"
+"\n"
+"// Appends the current fiber to the run queue and switches to the first fiber in the queue\n"
+"fn yield*() {\n"
+"    rtlyield()\n"
+"}\n"
+"\n"
+"fn rtlsleep(delay: real)\n"
+"\n"
+"// Suspends the current fiber for at least delay seconds\n"
+"fn sleep*(delay: real) {\n"
+"    rtlsleep(delay)\n"
+"}\n"
+"\n"
+"fn rtljoin(fib: fiber)\n"
+"\n"
+"// Suspends the current fiber until fib finishes\n"
+"fn join*(fib: fiber) {\n"
+"    rtljoin(fib)\n"
+"}\n"
 " "
 };
 
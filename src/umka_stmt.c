@@ -12,7 +12,7 @@ static void parseStmtList(Umka *umka);
 static void parseBlock(Umka *umka);
 
 
-static void doGarbageCollectionAt(Umka *umka, int block)
+static void doGarbageCollectionAt(Umka *umka, int block, const Ident *movedIdent)
 {
     bool blockFound = false;
 
@@ -20,10 +20,10 @@ static void doGarbageCollectionAt(Umka *umka, int block)
     {
         if (ident->block == block)
             blockFound = true;
-        else if (blockFound)
+        else if (blockFound || ident->block < block)     // Outer blocks always have lower numbers
             break;
 
-        if (blockFound && ident->isGarbageCollected && (!ident->isTemporary || ident->isUsed))
+        if (blockFound && ident->isGarbageCollected && (!ident->isTemporary || ident->isUsed) && ident != movedIdent)
         {
             if (ident->block == 0)
                 genRefCntGlobal(&umka->gen, TOK_MINUSMINUS, ident->ptr, ident->type);
@@ -37,15 +37,21 @@ static void doGarbageCollectionAt(Umka *umka, int block)
 void doGarbageCollection(Umka *umka)
 {
     // Collect garbage in the current scope
-    doGarbageCollectionAt(umka, blocksCurrent(&umka->blocks));
+    doGarbageCollectionAt(umka, blocksCurrent(&umka->blocks), NULL);
 }
 
 
-void doGarbageCollectionDownToBlock(Umka *umka, int block)
+static void doGarbageCollectionDownToBlockExcept(Umka *umka, int block, const Ident *movedIdent)
 {
-    // Collect garbage over all scopes down to the specified block (not inclusive)
+    // Collect garbage over all scopes down to the specified block (not inclusive), except the variable whose references have been moved elsewhere
     for (int i = umka->blocks.top; i >= 1 && umka->blocks.item[i].block != block; i--)
-        doGarbageCollectionAt(umka, umka->blocks.item[i].block);
+        doGarbageCollectionAt(umka, umka->blocks.item[i].block, movedIdent);
+}
+
+
+void doGarbageCollectionDownToBlock(Umka *umka, int block)
+{
+    doGarbageCollectionDownToBlockExcept(umka, block, NULL);
 }
 
 
@@ -90,6 +96,10 @@ void doResolveExtern(Umka *umka)
                 if (!fn)
                     umka->error.handler(umka->error.context, "Unresolved prototype of %s", ident->name);
 
+                // Attribute the stub code, including the heap chunks allocated by the external function, to the function
+                const char *prevDebugFnName = umka->lex.debug->fnName;
+                umka->lex.debug->fnName = ident->type->sig->isMethod ? identMethodNameWithRcv(&umka->idents, ident) : ident->name;
+
                 blocksEnterFn(&umka->blocks, ident, false);
                 genEntryPoint(&umka->gen, ident->prototypeOffset);
                 genEnterFrameStub(&umka->gen);
@@ -117,13 +127,15 @@ void doResolveExtern(Umka *umka)
 
                 doGarbageCollection(umka);
 
-                const StackFrameLayout *layout = typeMakeStackFrameLayout(&umka->types, ident->type->sig, 0);
+                const StackFrameLayout *layout = typeMakeStackFrameLayout(&umka->types, ident->type->sig, 0, 0);
                 
                 genLeaveFrameFixup(&umka->gen, layout);
                 genReturn(&umka->gen, getParamLayout(layout)->numParamSlots);
 
                 identFree(&umka->idents, blocksCurrent(&umka->blocks));
                 blocksLeave(&umka->blocks);
+
+                umka->lex.debug->fnName = prevDebugFnName;
             }
 
             identWarnIfUnused(&umka->idents, ident);
@@ -952,7 +964,7 @@ static void parseForInHeader(Umka *umka, ForPostStmt *postStmt)
         genPop(&umka->gen);
     }
 
-    // Declare variable for the collection index (for maps, it will be used for indexing keys())
+    // Declare variable for the collection index (for maps, it will be used for indexing the map iterator items)
     const char *indexName = (collectionType->kind == TYPE_MAP) ? "#index" : indexOrKeyName;
     
     postStmt->indexIdent = identAllocVar(&umka->idents, &umka->types, &umka->modules, &umka->blocks, indexName, umka->types.predecl.intType, false);
@@ -962,7 +974,9 @@ static void parseForInHeader(Umka *umka, ForPostStmt *postStmt)
     identSetUsed(postStmt->indexIdent);                    // Do not warn about unused index
     doZeroVar(umka, postStmt->indexIdent);
 
-    const Ident *keyIdent = NULL, *keysIdent = NULL;
+    const Ident *keyIdent = NULL, *mapIterIdent = NULL;
+    const Field *mapIterItemsField = NULL, *mapIterItemDataField = NULL, *mapIterItemKeyField = NULL;
+
     if (collectionType->kind == TYPE_MAP)
     {
         // Declare variable for the map key
@@ -970,22 +984,31 @@ static void parseForInHeader(Umka *umka, ForPostStmt *postStmt)
         identSetUsed(keyIdent);                            // Do not warn about unused key
         doZeroVar(umka, keyIdent);
 
-        // Declare variable for the map keys
-        Type *keysType = typeAdd(&umka->types, &umka->blocks, TYPE_DYNARRAY);
-        typeSetBase(keysType, typeMapKey(collectionType));
+        // Declare variable for the map iterator, i.e., the Umka equivalent of MapIterator. Its items are sorted by key and give item addresses without map lookups
+        Type *mapIterItemType = typeAdd(&umka->types, &umka->blocks, TYPE_STRUCT);
+        mapIterItemDataField = typeAddField(&umka->types, mapIterItemType, umka->types.predecl.uintType, "#data");     // Not a pointer, as it is not ref-counted
+        mapIterItemKeyField  = typeAddField(&umka->types, mapIterItemType, typeMapKey(collectionType), "#key");
+
+        Type *mapIterItemsType = typeAdd(&umka->types, &umka->blocks, TYPE_DYNARRAY);
+        typeSetBase(mapIterItemsType, mapIterItemType);
 
-        keysIdent = identAllocVar(&umka->idents, &umka->types, &umka->modules, &umka->blocks, "#keys", keysType, false);
-        doZeroVar(umka, keysIdent);
+        Type *mapIterType = typeAdd(&umka->types, &umka->blocks, TYPE_STRUCT);
+        typeAddField(&umka->types, mapIterType, umka->types.predecl.intType, "#numdeleted");
+        mapIterItemsField = typeAddField(&umka->types, mapIterType, mapIterItemsType, "#items");
 
-        // Call keys()
-        const int resultOffset = identAllocStack(&umka->idents, &umka->types, &umka->blocks, keysType);
+        mapIterIdent = identAllocVar(&umka->idents, &umka->types, &umka->modules, &umka->blocks, "#mapiter", mapIterType, false);
+        doZeroVar(umka, mapIterIdent);
+
+        // Call mapiter()
+        const int resultOffset = identAllocStack(&umka->idents, &umka->types, &umka->blocks, mapIterType);
         doPushVarPtr(umka, collectionIdent);        // Map
         genPushLocalPtr(&umka->gen, resultOffset);  // Pointer to result (hidden parameter)
-        genCallTypedBuiltin(&umka->gen, keysType, BUILTIN_KEYS);
+        doReserveTempItem(umka, mapIterItemType);
+        genCallTypedBuiltin(&umka->gen, mapIterType, BUILTIN_MAPITER);
 
-        // Assign map keys
-        doPushVarPtr(umka, keysIdent);
-        genSwapAssign(&umka->gen, keysType->kind, typeSize(&umka->types, keysType));
+        // Assign map iterator
+        doPushVarPtr(umka, mapIterIdent);
+        genSwapAssign(&umka->gen, mapIterType->kind, typeSize(&umka->types, mapIterType));
     }
 
     const Ident *itemIdent = NULL;
@@ -1010,22 +1033,35 @@ static void parseForInHeader(Umka *umka, ForPostStmt *postStmt)
 
     genWhileCondProlog(&umka->gen);
 
-    // Implicit conditional expression: #index < #len
-    doPushVarPtr(umka, postStmt->indexIdent);
-    genDeref(&umka->gen, TYPE_INT);
-    doPushVarPtr(umka, lenIdent);
-    genDeref(&umka->gen, TYPE_INT);
-    genBinary(&umka->gen, TOK_LESS, umka->types.predecl.intType);
+    if (collectionType->kind == TYPE_MAP)
+    {
+        // Implicit conditional expression: mapnext(&#mapiter, &#index, #collection) - skips the items deleted during iteration
+        doPushVarPtr(umka, mapIterIdent);
+        doPushVarPtr(umka, postStmt->indexIdent);
+        doPushVarPtr(umka, collectionIdent);
+        genCallTypedBuiltin(&umka->gen, mapIterIdent->type, BUILTIN_MAPNEXT);
+    }
+    else
+    {
+        // Implicit conditional expression: #index < #len
+        doPushVarPtr(umka, postStmt->indexIdent);
+        genDeref(&umka->gen, TYPE_INT);
+        doPushVarPtr(umka, lenIdent);
+        genDeref(&umka->gen, TYPE_INT);
+        genBinary(&umka->gen, TOK_LESS, umka->types.predecl.intType);
+    }
 
     genWhileCondEpilog(&umka->gen);
 
     if (collectionType->kind == TYPE_MAP)
     {
-        // Assign key = #keys[#index]
-        doPushVarPtr(umka, keysIdent);
+        // Assign key = #mapiter.#items[#index].#key
+        doPushVarPtr(umka, mapIterIdent);
+        genGetFieldPtr(&umka->gen, mapIterItemsField->offset);
         doPushVarPtr(umka, postStmt->indexIdent);
         genDeref(&umka->gen, TYPE_INT);
         genGetDynArrayPtr(&umka->gen);
+        genGetFieldPtr(&umka->gen, mapIterItemKeyField->offset);
         genDeref(&umka->gen, keyIdent->type->kind);
 
         doPushVarPtr(umka, keyIdent);
@@ -1035,29 +1071,33 @@ static void parseForInHeader(Umka *umka, ForPostStmt *postStmt)
     // Assign collection item
     if (itemIdent)
     {
-        doPushVarPtr(umka, collectionIdent);
-        genDeref(&umka->gen, collectionIdent->type->kind);
-
         if (collectionType->kind == TYPE_MAP)
         {
-            // Push item key
-            doPushVarPtr(umka, keyIdent);
-            genDeref(&umka->gen, keyIdent->type->kind);
+            // Push item pointer #mapiter.#items[#index].#data
+            doPushVarPtr(umka, mapIterIdent);
+            genGetFieldPtr(&umka->gen, mapIterItemsField->offset);
+            doPushVarPtr(umka, postStmt->indexIdent);
+            genDeref(&umka->gen, TYPE_INT);
+            genGetDynArrayPtr(&umka->gen);
+            genGetFieldPtr(&umka->gen, mapIterItemDataField->offset);
+            genDeref(&umka->gen, TYPE_UINT);
         }
         else
         {
+            doPushVarPtr(umka, collectionIdent);
+            genDeref(&umka->gen, collectionIdent->type->kind);
+
             // Push item index
             doPushVarPtr(umka, postStmt->indexIdent);
             genDeref(&umka->gen, TYPE_INT);
-        }
 
-        switch (collectionType->kind)
-        {
-            case TYPE_ARRAY:     genGetArrayPtr(&umka->gen, typeSize(&umka->types, collectionType->base), collectionType->numItems); break;
-            case TYPE_DYNARRAY:  genGetDynArrayPtr(&umka->gen);                                                                      break;
-            case TYPE_STR:       genGetArrayPtr(&umka->gen, typeSize(&umka->types, umka->types.predecl.charType), INT_MAX);                        break; // No range checking
-            case TYPE_MAP:       genGetMapPtr(&umka->gen, collectionType);                                                           break;
-            default:             break;
+            switch (collectionType->kind)
+            {
+                case TYPE_ARRAY:     genGetArrayPtr(&umka->gen, typeSize(&umka->types, collectionType->base), collectionType->numItems); break;
+                case TYPE_DYNARRAY:  genGetDynArrayPtr(&umka->gen);                                                                      break;
+                case TYPE_STR:       genGetArrayPtr(&umka->gen, typeSize(&umka->types, umka->types.predecl.charType), INT_MAX);                        break; // No range checking
+                default:             break;
+            }
         }
 
         // Get collection item value
@@ -1157,6 +1197,29 @@ static void parseContinueStmt(Umka *umka)
 }
 
 
+static const Ident *doFindReturnedLocalVar(Umka *umka)
+{
+    // Check if the whole return expression is a garbage-collected local variable declared in the function body
+    if (umka->lex.tok.kind != TOK_IDENT)
+        return NULL;
+
+    Lexer lookaheadLex = umka->lex;
+    lexNext(&lookaheadLex);
+    if (lookaheadLex.tok.kind != TOK_SEMICOLON && lookaheadLex.tok.kind != TOK_IMPLICIT_SEMICOLON && lookaheadLex.tok.kind != TOK_RBRACE)
+        return NULL;
+
+    const Ident *ident = identFind(&umka->idents, &umka->modules, &umka->blocks, umka->blocks.module, umka->lex.tok.name, NULL, false);
+    if (!ident || ident->kind != IDENT_VAR || ident->block == 0 || !ident->isGarbageCollected)
+        return NULL;
+
+    // Parameters and upvalues are collected after the common return point, so they cannot be moved
+    if (ident->block == umka->gen.returns->block)
+        return NULL;
+
+    return ident;
+}
+
+
 // returnStmt = "return" [exprList].
 static void parseReturnStmt(Umka *umka)
 {
@@ -1176,13 +1239,29 @@ static void parseReturnStmt(Umka *umka)
         umka->error.handler(umka->error.context, "Function block not found");
 
     const Type *type = sig->resultType;
+    const Ident *returnedVar = NULL;
+
     if (umka->lex.tok.kind != TOK_SEMICOLON && umka->lex.tok.kind != TOK_IMPLICIT_SEMICOLON && umka->lex.tok.kind != TOK_RBRACE)
+    {
+        returnedVar = doFindReturnedLocalVar(umka);
         parseExprList(umka, &type, NULL);
+    }
     else
         type = umka->types.predecl.voidType;
 
     doAssertImplicitTypeConv(umka, sig->resultType, &type, NULL);
 
+    // Optimization: The returned local variable or composite literal is never used again, so the result can take over its references
+    bool referencesMoved = false;
+
+    if (returnedVar && typeEquivalent(returnedVar->type, sig->resultType))
+        referencesMoved = true;
+    else
+    {
+        returnedVar = NULL;
+        referencesMoved = doTryMoveFromTempVar(umka, sig->resultType);
+    }
+
     // Check non-64-bit ordinal and real types for overflow
     if (sig->resultType->kind != type->kind && typeNarrow(sig->resultType))
         genAssertRange(&umka->gen, sig->resultType->kind, type);
@@ -1204,11 +1283,12 @@ static void parseReturnStmt(Umka *umka)
 
     if (sig->resultType->kind != TYPE_VOID)
     {
-        doTryOptimizeIncRefCnt(umka, sig->resultType);
+        if (!referencesMoved)
+            doTryOptimizeIncRefCnt(umka, sig->resultType);
         genPopReg(&umka->gen, REG_RESULT);
     }
 
-    doGarbageCollectionDownToBlock(umka, umka->gen.returns->block);
+    doGarbageCollectionDownToBlockExcept(umka, umka->gen.returns->block, returnedVar);
     genGotosAddStub(&umka->gen, umka->gen.returns);
 }
 
@@ -1287,7 +1367,7 @@ void parseFnBlock(Umka *umka, Ident *fn, const Type *upvaluesStructType)
             umka->lex.debug->fnName = fn->name;
     }
     else
-        umka->lex.debug->fnName = "<unknown>";
+        umka->lex.debug->fnName = unknownName;
 
     if (fn->prototypeOffset >= 0)
     {
@@ -1365,7 +1445,8 @@ void parseFnBlock(Umka *umka, Ident *fn, const Type *upvaluesStructType)
     identFree(&umka->idents, blocksCurrent(&umka->blocks));
 
     const int64_t localVarSlots = align(umka->blocks.item[umka->blocks.top].localVarSize, sizeof(Slot)) / sizeof(Slot);
-    const StackFrameLayout *layout = typeMakeStackFrameLayout(&umka->types, fn->type->sig, localVarSlots);
+    const int64_t tempSlots = umka->blocks.item[umka->blocks.top].maxTempSlots;
+    const StackFrameLayout *layout = typeMakeStackFrameLayout(&umka->types, fn->type->sig, localVarSlots, tempSlots);
     
     genLeaveFrameFixup(&umka->gen, layout);
     genReturn(&umka->gen, getParamLayout(layout)->numParamSlots);
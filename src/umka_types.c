@@ -103,7 +103,9 @@ static void typeInitPredeclared(Types *types, const Blocks *blocks)
 void typeInit(Types *types, const Blocks *blocks, Storage *storage, Error *error)
 {
     types->first = NULL;
+    types->firstInterfaceTable = NULL;
     types->forwardTypesEnabled = false;
+    types->firstBeforeForward = NULL;
     types->storage = storage;
     types->error = error;
 
@@ -217,6 +219,9 @@ static int typeSizeRecompute(const Type *type)
             int size = 0;
             for (int i = 0; i < type->numItems; i++)
             {
+                if (type->kind == TYPE_INTERFACE && i >= INTERFACE_FIELD_FIRST_METHOD)
+                    break;
+
                 const int fieldSize = typeSizeRecompute(type->field[i]->type);
                 size = align(size + fieldSize, typeAlignmentRecompute(type->field[i]->type));
             }
@@ -271,6 +276,9 @@ static int typeAlignmentRecompute(const Type *type)
             int alignment = 1;
             for (int i = 0; i < type->numItems; i++)
             {
+                if (type->kind == TYPE_INTERFACE && i >= INTERFACE_FIELD_FIRST_METHOD)
+                    break;
+
                 const int fieldAlignment = typeAlignmentRecompute(type->field[i]->type);
                 if (fieldAlignment > alignment)
                     alignment = fieldAlignment;
@@ -627,8 +635,10 @@ void typeEnableForward(Types *types, bool enable)
 {
     types->forwardTypesEnabled = enable;
 
-    if (!enable)
-        for (const Type *type = types->first; type; type = type->next)
+    if (enable)
+        types->firstBeforeForward = types->first;
+    else
+        for (const Type *type = types->first; type != types->firstBeforeForward; type = type->next)
             if (type->kind == TYPE_FORWARD)
                 types->error->handler(types->error->context, "Unresolved forward declaration of %s", (Ident *)(type->typeIdent)->name);
 }
@@ -694,8 +704,13 @@ const Field *typeAddField(const Types *types, Type *structType, const Type *fiel
     if (fieldType->kind == TYPE_VOID)
         types->error->handler(types->error->context, "Void field %s is not allowed", name);
 
+    // Interface methods are stored in a shared interface table rather than in the interface itself
+    const bool isInterfaceMethod = structType->kind == TYPE_INTERFACE && structType->numItems >= INTERFACE_FIELD_FIRST_METHOD;
+
     int minNextFieldOffset = 0;
-    if (structType->numItems > 0)
+    if (isInterfaceMethod)
+        minNextFieldOffset = offsetof(InterfaceTable, entryOffset) + (structType->numItems - INTERFACE_FIELD_FIRST_METHOD) * sizeof(int64_t);
+    else if (structType->numItems > 0)
     {
         const Field *lastField = structType->field[structType->numItems - 1];
         minNextFieldOffset = lastField->offset + lastField->type->size;
@@ -720,6 +735,9 @@ const Field *typeAddField(const Types *types, Type *structType, const Type *fiel
     structType->numItems++;
     structType->field[structType->numItems - 1] = field;
 
+    if (isInterfaceMethod)
+        return field;
+
     if (structType->alignment < fieldType->alignment)
         structType->alignment = fieldType->alignment;
 
@@ -732,6 +750,30 @@ const Field *typeAddField(const Types *types, Type *structType, const Type *fiel
 }
 
 
+InterfaceTable *typeFindInterfaceTable(const Types *types, const Type *selfType, const Type *interfaceType)
+{
+    for (InterfaceTable *itable = types->firstInterfaceTable; itable; itable = itable->nextInterned)
+        if (typeEquivalent(itable->selfType, selfType) && typeEquivalent(itable->interfaceType, interfaceType))
+            return itable;
+    return NULL;
+}
+
+
+InterfaceTable *typeAddInterfaceTable(Types *types, const Type *selfType, const Type *interfaceType)
+{
+    const int numMethods = interfaceType->numItems - INTERFACE_FIELD_FIRST_METHOD;
+
+    InterfaceTable *itable = storageAdd(types->storage, sizeof(InterfaceTable) + numMethods * sizeof(int64_t));
+    itable->selfType = selfType;
+    itable->interfaceType = interfaceType;
+
+    itable->nextInterned = types->firstInterfaceTable;
+    types->firstInterfaceTable = itable;
+
+    return itable;
+}
+
+
 const EnumConst *typeFindEnumConst(const Type *enumType, const char *name)
 {
     if (typeEnum(enumType))
@@ -847,7 +889,7 @@ int typeParamOffset(const Types *types, const Signature *sig, int index)
 }
 
 
-const StackFrameLayout *typeMakeStackFrameLayout(const Types *types, const Signature *sig, int64_t localVarSlots)
+const StackFrameLayout *typeMakeStackFrameLayout(const Types *types, const Signature *sig, int64_t localVarSlots, int64_t tempSlots)
 {
     StackFrameLayout *layout = storageAdd(types->storage, STACK_FRAME_LAYOUT_SIZE(sig->numParams));
 
@@ -868,11 +910,134 @@ const StackFrameLayout *typeMakeStackFrameLayout(const Types *types, const Signa
         
     LocalVarLayout *localVarLayout = (LocalVarLayout *)getLocalVarLayout(layout);
     localVarLayout->localVarSlots = localVarSlots;
+    localVarLayout->tempSlots = tempSlots;
     
     return layout;
 }
 
 
+static bool typeAddCompareSteps(const Type *type, int offset, CompareStep *steps, int *numSteps)
+{
+    if (type->kind == TYPE_ARRAY || type->kind == TYPE_STRUCT)
+    {
+        for (int i = 0; i < type->numItems; i++)
+        {
+            const Type *itemType = (type->kind == TYPE_ARRAY) ? type->base : type->field[i]->type;
+            const int itemOffset = (type->kind == TYPE_ARRAY) ? (i * itemType->size) : type->field[i]->offset;
+
+            if (!typeAddCompareSteps(itemType, offset + itemOffset, steps, numSteps))
+                return false;
+        }
+        return true;
+    }
+
+    if (*numSteps >= MAX_COMPARE_STEPS)
+        return false;
+
+    CompareStep *step = &steps[(*numSteps)++];
+    step->offset = offset;
+    step->type = type;
+
+    switch (type->kind)
+    {
+        case TYPE_INT8:     step->kind = COMPARE_INT8;      break;
+        case TYPE_INT16:    step->kind = COMPARE_INT16;     break;
+        case TYPE_INT32:    step->kind = COMPARE_INT32;     break;
+        case TYPE_INT:      step->kind = COMPARE_INT;       break;
+        case TYPE_UINT8:
+        case TYPE_BOOL:
+        case TYPE_CHAR:     step->kind = COMPARE_UINT8;     break;
+        case TYPE_UINT16:   step->kind = COMPARE_UINT16;    break;
+        case TYPE_UINT32:   step->kind = COMPARE_UINT32;    break;
+        case TYPE_UINT:
+        case TYPE_WEAKPTR:  step->kind = COMPARE_UINT;      break;
+        case TYPE_REAL32:   step->kind = COMPARE_REAL32;    break;
+        case TYPE_REAL:     step->kind = COMPARE_REAL;      break;
+        case TYPE_PTR:      step->kind = COMPARE_PTR;       break;
+        case TYPE_STR:      step->kind = COMPARE_STR;       break;
+        default:            step->kind = COMPARE_GENERIC;   break;
+    }
+
+    return true;
+}
+
+
+const ComparePlan *typeMakeComparePlan(const Types *types, const Type *type)
+{
+    if (type->comparePlan)
+        return type->comparePlan;
+
+    CompareStep steps[MAX_COMPARE_STEPS];
+    int numSteps = 0;
+
+    // Too complex types are compared as a whole
+    if (!typeAddCompareSteps(type, 0, steps, &numSteps))
+    {
+        steps[0] = (CompareStep){.kind = COMPARE_GENERIC, .offset = 0, .type = type};
+        numSteps = 1;
+    }
+
+    ComparePlan *plan = storageAdd(types->storage, sizeof(ComparePlan) + numSteps * sizeof(CompareStep));
+
+    plan->numSteps = numSteps;
+    memcpy(plan->step, steps, numSteps * sizeof(CompareStep));
+
+    // Find the leading integers and pointers not separated by padding
+    while (plan->firstStepAfterMemEqual < plan->numSteps)
+    {
+        const CompareStep *step = &plan->step[plan->firstStepAfterMemEqual];
+
+        const bool memComparable = step->kind != COMPARE_REAL32 && step->kind != COMPARE_REAL && step->kind != COMPARE_STR && step->kind != COMPARE_GENERIC;
+        if (!memComparable || step->offset != plan->memEqualSize)
+            break;
+
+        plan->memEqualSize += step->type->size;
+        plan->firstStepAfterMemEqual++;
+    }
+
+    // The type can be modified, since the plan does not change its semantics
+    ((Type *)type)->comparePlan = plan;
+    return plan;
+}
+
+
+const FormatSegment *typeMakeFormatSegment(const Types *types, BuiltinFunc builtin, const char *format, const Type *type)
+{
+    FormatSegment segment = {.builtin = builtin, .type = type};
+
+    int formatLen = -1, typeLetterPos = -1;
+    if (!typeFormatStringValid(format, &formatLen, &typeLetterPos, &segment.expectedTypeKind, &segment.size))
+        types->error->handler(types->error->context, "Invalid format string");
+
+    // The segment string is stored after the segment
+    FormatSegment *result = storageAdd(types->storage, sizeof(FormatSegment) + formatLen + 1);
+    char *segmentFormat = (char *)(result + 1);
+
+    memcpy(segmentFormat, format, formatLen);
+    segmentFormat[formatLen] = 0;
+
+    if (segment.expectedTypeKind == TYPE_INTERFACE && typeLetterPos >= 0 && typeLetterPos < formatLen)     // %v
+    {
+        // %hhv -> %  s
+        // %hv  -> % s
+        // %v   -> %s
+        // %lv  -> % s
+        // %llv -> %  s
+
+        segmentFormat[typeLetterPos] = 's';
+        if (segment.size != FORMAT_SIZE_NORMAL && typeLetterPos - 1 >= 0)
+            segmentFormat[typeLetterPos - 1] = ' ';
+        if ((segment.size == FORMAT_SIZE_LONG_LONG || segment.size == FORMAT_SIZE_SHORT_SHORT) && typeLetterPos - 2 >= 0)
+            segmentFormat[typeLetterPos - 2] = ' ';
+    }
+
+    segment.format = segmentFormat;
+    *result = segment;
+
+    return result;
+}
+
+
 const char *typeKindSpelling(TypeKind kind)
 {
     return spelling[kind];
@@ -95,6 +95,8 @@ typedef enum
     // Maps
     BUILTIN_VALIDKEY,
     BUILTIN_KEYS,
+    BUILTIN_MAPITER,        // Map to map iterator - implicit calls only
+    BUILTIN_MAPNEXT,        // Skip deleted map iterator items - implicit calls only
 
     // Fibers
     BUILTIN_RESUME,
@@ -139,6 +141,41 @@ typedef struct
 } Param;
 
 
+typedef enum
+{
+    COMPARE_INT8,
+    COMPARE_INT16,
+    COMPARE_INT32,
+    COMPARE_INT,
+    COMPARE_UINT8,
+    COMPARE_UINT16,
+    COMPARE_UINT32,
+    COMPARE_UINT,
+    COMPARE_REAL32,
+    COMPARE_REAL,
+    COMPARE_PTR,
+    COMPARE_STR,
+    COMPARE_GENERIC     // Anything that cannot be flattened, e.g., dynamic arrays
+} CompareStepKind;
+
+
+typedef struct
+{
+    CompareStepKind kind;
+    int offset;
+    const struct tagType *type;
+} CompareStep;
+
+
+typedef struct tagComparePlan       // Flattened comparison of structured or scalar values stored in memory
+{
+    int memEqualSize;               // Leading bytes that can be tested for equality with memcmp()
+    int firstStepAfterMemEqual;
+    int numSteps;
+    CompareStep step[];
+} ComparePlan;
+
+
 typedef struct
 {
     int numParams, numDefaultParams;
@@ -163,13 +200,14 @@ typedef struct tagType
     const struct tagType *sameAs;               // For types declared as type T = ...
     union
     {
-        const struct tagType *base;             // For pointers (value type), arrays (item type), maps (node type) and fibers (closure type)
+        const struct tagType *base;             // For pointers (value type), arrays (item type), maps (node pointer type) and fibers (closure type)
         const Field **field;                    // For structures, interfaces and closures
         const EnumConst **enumConst;            // For enumerations
         Signature *sig;                         // For functions, including methods
     };
     int size;
     int alignment;
+    const ComparePlan *comparePlan;             // For map keys and fast sorting
     const struct tagType *next;
 } Type;
 
@@ -210,7 +248,9 @@ typedef struct
 {
     const Type *first;
     PredeclaredTypes predecl;
+    InterfaceTable *firstInterfaceTable;
     bool forwardTypesEnabled;
+    const Type *firstBeforeForward;             // Forward types can only be found among the types added after it
     Storage *storage;
     Error *error;
 } Types;
@@ -226,6 +266,16 @@ typedef enum
 } FormatStringTypeSize;
 
 
+typedef struct              // Format string literal part printed by printf(), fprintf() or sprintf() together with one value, prepared at compile time
+{
+    BuiltinFunc builtin;
+    const char *format;                         // Format string part with at most one conversion. %v is replaced with %s
+    TypeKind expectedTypeKind;
+    FormatStringTypeSize size;
+    const Type *type;                           // Value type. Null for the trailing part
+} FormatSegment;
+
+
 void typeInit(Types *types, const Blocks *blocks, Storage *storage, Error *error);
 
 Type *typeAdd       (Types *types, const Blocks *blocks, TypeKind kind);
@@ -456,6 +506,9 @@ const Field *typeFindField        (const Type *structType, const char *name, int
 const Field *typeAssertFindField  (const Types *types, const Type *structType, const char *name, int *index);
 const Field *typeAddField         (const Types *types, Type *structType, const Type *fieldType, const char *fieldName);
 
+InterfaceTable *typeFindInterfaceTable (const Types *types, const Type *selfType, const Type *interfaceType);
+InterfaceTable *typeAddInterfaceTable  (Types *types, const Type *selfType, const Type *interfaceType);
+
 const EnumConst *typeFindEnumConst        (const Type *enumType, const char *name);
 const EnumConst *typeAssertFindEnumConst  (const Types *types, const Type *enumType, const char *name);
 const EnumConst *typeFindEnumConstByVal   (const Type *enumType, Const val);
@@ -468,7 +521,9 @@ int typeParamSizeUpTo   (const Types *types, const Signature *sig, int index);
 int typeParamSizeTotal  (const Types *types, const Signature *sig);
 int typeParamOffset     (const Types *types, const Signature *sig, int index);
 
-const StackFrameLayout *typeMakeStackFrameLayout(const Types *types, const Signature *sig, int64_t localVarSlots);
+const StackFrameLayout *typeMakeStackFrameLayout(const Types *types, const Signature *sig, int64_t localVarSlots, int64_t tempSlots);
+const ComparePlan *typeMakeComparePlan          (const Types *types, const Type *type);
+const FormatSegment *typeMakeFormatSegment      (const Types *types, BuiltinFunc builtin, const char *format, const Type *type);
 
 const char *typeKindSpelling(TypeKind kind);
 const char *typeSpelling    (const Type *type, char *buf);
@@ -476,21 +531,33 @@ const char *typeSpelling    (const Type *type, char *buf);
 bool typeFormatStringValid(const char *format, int *formatLen, int *typeLetterPos, TypeKind *typeKind, FormatStringTypeSize *size);
 
 
-static inline const Type *typeMapKey(const Type *mapType)
+static inline const Type *typeMapNodePtr(const Type *mapType)
 {
-    return mapType->base->field[MAP_NODE_FIELD_KEY]->type->base;
+    return mapType->base;
 }
 
 
-static inline const Type *typeMapItem(const Type *mapType)
+static inline const Type *typeMapEntries(const Type *mapType)
 {
-    return mapType->base->field[MAP_NODE_FIELD_DATA]->type->base;
+    return mapType->base->base->field[MAP_NODE_FIELD_ENTRIES]->type;
 }
 
 
-static inline const Type *typeMapNodePtr(const Type *mapType)
+static inline const Type *typeMapItemPtr(const Type *mapType)
+{
+    return typeMapEntries(mapType)->base->field[MAP_ENTRY_FIELD_DATA]->type;
+}
+
+
+static inline const Type *typeMapKey(const Type *mapType)
+{
+    return typeMapEntries(mapType)->base->field[MAP_ENTRY_FIELD_KEY]->type;
+}
+
+
+static inline const Type *typeMapItem(const Type *mapType)
 {
-    return mapType->base->field[MAP_NODE_FIELD_LEFT]->type;
+    return typeMapItemPtr(mapType)->base;
 }
 
 
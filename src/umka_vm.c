@@ -3,6 +3,7 @@
 //#define UMKA_VM_DEBUG
 //#define UMKA_STR_DEBUG
 //#define UMKA_REF_CNT_DEBUG
+//#define UMKA_VM_PAIR_STATS
 
 #ifdef UMKA_VM_DEBUG
     #define FORCE_INLINE
@@ -17,6 +18,11 @@
     #endif
 #endif
 
+// Threaded-code dispatch via computed goto (GNU C extension), with the portable switch dispatch as a fallback
+#if defined(__GNUC__) && !defined(__EMSCRIPTEN__) && !defined(UMKA_VM_DEBUG) && !defined(UMKA_VM_SWITCH_DISPATCH) && !defined(UMKA_VM_PAIR_STATS)
+    #define UMKA_VM_COMPUTED_GOTO
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -26,6 +32,13 @@
 #include <limits.h>
 #include <ctype.h>
 #include <inttypes.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <poll.h>
+#endif
 
 #include "umka_vm.h"
 #include "umka_ident.h"
@@ -58,6 +71,10 @@ Virtual machine stack layout (64-bit slots):
     ...
     Parameter N - 1
     ...                                              <- Stack origin + size
+
+Child fiber stacks start small and consist of segments. When a stack frame does not fit into the current segment, 
+the return address and parameters are moved to a new segment, followed by the frame itself. The new segment ends 
+with a StackSegment header that links it to the previous segment. Segments are never relocated
 */
 
 
@@ -87,7 +104,33 @@ static const char *opcodeSpelling [] =
     "REF_CNT_ASSIGN",
     "SWAP_REF_CNT_ASSIGN",
     "UNARY",
+    "NEG_INT",
+    "NEG_REAL",
+    "INC_INT",
+    "DEC_INT",
+    "INC_LOCAL_INT",
+    "DEC_LOCAL_INT",
     "BINARY",
+    "ADD_INT",
+    "SUB_INT",
+    "MUL_INT",
+    "EQ_INT",
+    "NOT_EQ_INT",
+    "GREATER_INT",
+    "LESS_INT",
+    "GREATER_EQ_INT",
+    "LESS_EQ_INT",
+    "ADD_REAL",
+    "SUB_REAL",
+    "MUL_REAL",
+    "DIV_REAL",
+    "EQ_REAL",
+    "NOT_EQ_REAL",
+    "GREATER_REAL",
+    "LESS_REAL",
+    "GREATER_EQ_REAL",
+    "LESS_EQ_REAL",
+    "STR_CONCAT_N",
     "GET_ARRAY_PTR",
     "GET_ARRAY",
     "GET_DYNARRAY_PTR",
@@ -96,17 +139,26 @@ static const char *opcodeSpelling [] =
     "GET_MAP",
     "GET_FIELD_PTR",
     "GET_FIELD",
+    "GET_METHOD",
     "ASSERT_TYPE",
     "ASSERT_RANGE",
+    "CONVERT_ITABLE",
     "WEAKEN_PTR",
     "STRENGTHEN_PTR",
     "GOTO",
     "GOTO_IF",
     "GOTO_IF_NOT",
+    "GOTO_IF_EQ_INT",
+    "GOTO_IF_NOT_EQ_INT",
+    "GOTO_IF_GREATER_INT",
+    "GOTO_IF_LESS_INT",
+    "GOTO_IF_GREATER_EQ_INT",
+    "GOTO_IF_LESS_EQ_INT",
     "CALL",
     "CALL_INDIRECT",
     "CALL_EXTERN",
     "CALL_BUILTIN",
+    "CALL_PRINTF",
     "RETURN",
     "ENTER_FRAME",
     "LEAVE_FRAME",
@@ -161,6 +213,8 @@ static const char *builtinSpelling [] =
     "valid",
     "validkey",
     "keys",
+    "mapiter",
+    "mapnext",
     "resume",
     "memusage",
     "leaksan",
@@ -199,6 +253,7 @@ static FORCE_INLINE UmkaStackSlot *doGetOnFreeParams(void *ptr)
     
     LocalVarLayout *localVarLayout = (LocalVarLayout *)getLocalVarLayout(layout);
     localVarLayout->localVarSlots = 0;
+    localVarLayout->tempSlots = 0;
 
     static UmkaStackSlot paramsBuf[4 + 1] = {0};
     UmkaStackSlot *params = paramsBuf + 4;
@@ -268,6 +323,83 @@ static FORCE_INLINE void candidatePop(RefCntCandidates *candidates, void **ptr,
 }
 
 
+static FORCE_INLINE void pageIndexInit(HeapPageIndex *index, Storage *storage)
+{
+    index->storage = storage;
+    index->capacity = 100;
+    index->byAddress = storageAdd(index->storage, index->capacity * sizeof(HeapPage *));
+    index->byId = storageAdd(index->storage, index->capacity * sizeof(HeapPage *));
+    index->numPages = 0;
+}
+
+
+static FORCE_INLINE int pageIndexFindByAddress(const HeapPageIndex *index, const void *ptr)
+{
+    // Find the last page that starts at or below ptr
+    int left = 0, right = index->numPages - 1, found = -1;
+    while (left <= right)
+    {
+        const int mid = (left + right) / 2;
+        if ((const void *)index->byAddress[mid]->data <= ptr)
+        {
+            found = mid;
+            left = mid + 1;
+        }
+        else
+            right = mid - 1;
+    }
+    return found;
+}
+
+
+static FORCE_INLINE int pageIndexFindById(const HeapPageIndex *index, int id)
+{
+    int left = 0, right = index->numPages - 1;
+    while (left <= right)
+    {
+        const int mid = (left + right) / 2;
+        if (index->byId[mid]->id == id)
+            return mid;
+
+        if (index->byId[mid]->id < id)
+            left = mid + 1;
+        else
+            right = mid - 1;
+    }
+    return -1;
+}
+
+
+static FORCE_INLINE void pageIndexAdd(HeapPageIndex *index, HeapPage *page)
+{
+    if (index->numPages >= index->capacity)
+    {
+        index->capacity *= 2;
+        index->byAddress = storageRealloc(index->storage, index->byAddress, index->capacity * sizeof(HeapPage *));
+        index->byId = storageRealloc(index->storage, index->byId, index->capacity * sizeof(HeapPage *));
+    }
+
+    const int pos = pageIndexFindByAddress(index, page->data) + 1;
+    memmove(&index->byAddress[pos + 1], &index->byAddress[pos], (index->numPages - pos) * sizeof(HeapPage *));
+    index->byAddress[pos] = page;
+
+    // Page IDs are issued in ascending order, so appending keeps the IDs sorted
+    index->byId[index->numPages++] = page;
+}
+
+
+static FORCE_INLINE void pageIndexRemove(HeapPageIndex *index, const HeapPage *page)
+{
+    const int addressPos = pageIndexFindByAddress(index, page->data);
+    memmove(&index->byAddress[addressPos], &index->byAddress[addressPos + 1], (index->numPages - addressPos - 1) * sizeof(HeapPage *));
+
+    const int idPos = pageIndexFindById(index, page->id);
+    memmove(&index->byId[idPos], &index->byId[idPos + 1], (index->numPages - idPos - 1) * sizeof(HeapPage *));
+
+    index->numPages--;
+}
+
+
 static FORCE_INLINE const StackFrameLayout *stackGetFrameLayout(const Slot *base)
 {
     return base[-2].ptrVal;
@@ -298,9 +430,19 @@ static FORCE_INLINE const Slot *stackGetFrameLocalVars(const Slot *base, const S
 }
 
 
+static FORCE_INLINE StackSegment *stackGetSegment(const Fiber *fiber, Slot *stack, int64_t stackSize)
+{
+    // The first segment has no header
+    if (fiber->stackBottom == stack + stackSize - 1)
+        return NULL;
+
+    return (StackSegment *)(stack + stackSize) - 1;
+}
+
+
 static FORCE_INLINE bool stackUnwind(Fiber *fiber, const Slot **base, int *ip)
 {
-    if (*base == fiber->stack + fiber->stackSize - 1)
+    if (*base == fiber->stackBottom)
         return false;
 
     const int returnOffset = stackGetFrameReturnOffset(*base);
@@ -316,24 +458,37 @@ static FORCE_INLINE bool stackUnwind(Fiber *fiber, const Slot **base, int *ip)
 
 static FORCE_INLINE void stackUpdateFrameRefCnt(Fiber *fiber, HeapPages *pages, void *ptr, int delta)
 {
-    if (ptr >= (void *)fiber->top && ptr < (void *)(fiber->stack + fiber->stackSize))
+    // Find the stack segment containing the pointer, if any
+    Slot *stack = fiber->stack, *top = fiber->top;
+    int64_t stackSize = fiber->stackSize;
+
+    while (ptr < (void *)top || ptr >= (void *)(stack + stackSize))
     {
-        if (fiber->base == fiber->stack + fiber->stackSize - 1)
+        const StackSegment *segment = stackGetSegment(fiber, stack, stackSize);
+        if (!segment)
             return;
-        
-        const Slot *base = fiber->base;
-        const StackFrameLayout *layout = stackGetFrameLayout(base);
 
-        while (ptr >= (void *)(stackGetFrameParams(base) + getParamLayout(layout)->numParamSlots))
-        {
-            if (UNLIKELY(!stackUnwind(fiber, &base, NULL)))
-                pages->error->runtimeHandler(pages->error->context, ERR_RUNTIME, "Illegal stack pointer");
+        stack = segment->prevStack;
+        stackSize = segment->prevStackSize;
+        top = segment->prevTop;
+    }
 
-            layout = stackGetFrameLayout(base);
-        }
+    if (fiber->base == fiber->stackBottom)
+        return;
+
+    // Find the stack frame containing the pointer, skipping the frames in other segments
+    const Slot *base = fiber->base;
+    const StackFrameLayout *layout = stackGetFrameLayout(base);
+
+    while (base < stack || base >= stack + stackSize || ptr >= (void *)(stackGetFrameParams(base) + getParamLayout(layout)->numParamSlots))
+    {
+        if (UNLIKELY(!stackUnwind(fiber, &base, NULL)))
+            pages->error->runtimeHandler(pages->error->context, ERR_RUNTIME, "Illegal stack pointer");
 
-        *stackGetFrameRefCnt(base) += delta;
+        layout = stackGetFrameLayout(base);
     }
+
+    *stackGetFrameRefCnt(base) += delta;
 }
 
 
@@ -397,6 +552,12 @@ static void pageInit(HeapPages *pages, Fiber *fiber, Storage *storage, Error *er
     pages->fiber = fiber;
     pages->leakSanLevel = 1;
     candidateInit(&pages->refCntCandidates, storage);
+    pageIndexInit(&pages->index, storage);
+
+    for (int i = 0; i < MEM_NUM_SIZE_CLASSES; i++)
+        pages->firstWithSpace[i] = NULL;
+    pages->sizeClassesWithSpace = 0;
+
     pages->error = error;
 }
 
@@ -458,8 +619,9 @@ static FORCE_INLINE HeapPage *pageFindRecycled(HeapPages *pages, int size)
         HeapPage *page = pages->firstRecycled;
         pages->firstRecycled = pages->firstRecycled->next;
         
+        // A much larger page would keep its memory for as long as it holds any small chunk
         const int recycledSize = page->numChunks * page->chunkSize;
-        if (recycledSize >= size)
+        if (recycledSize >= size && recycledSize <= 2 * size)
             return page;
 
         free(page);
@@ -476,11 +638,13 @@ static FORCE_INLINE bool pageMayBeReferencedByTemporaries(HeapPages *pages, cons
     // Naive Deutsch-Bobrow-style conservative stack scanning for temporaries referencing the page
     for (Fiber *fiber = pages->fiber; fiber; fiber = fiber->parent)
     {
-        if (fiber->base == fiber->stack + fiber->stackSize - 1)
+        if (fiber->base == fiber->stackBottom)
             continue;
         
         const Slot *base = fiber->base;
         const Slot *temporariesTop = fiber->top;
+        Slot *stack = fiber->stack;
+        int64_t stackSize = fiber->stackSize;
         do
         {
             const StackFrameLayout *layout = stackGetFrameLayout(base);
@@ -497,6 +661,15 @@ static FORCE_INLINE bool pageMayBeReferencedByTemporaries(HeapPages *pages, cons
             }
 
             temporariesTop = stackGetFrameParams(base) + getParamLayout(layout)->numParamSlots;
+
+            // The first frame of a segment has been called from the previous segment
+            const StackSegment *segment = stackGetSegment(fiber, stack, stackSize);
+            if (segment && temporariesTop == (const Slot *)segment)
+            {
+                temporariesTop = segment->prevTop;
+                stack = segment->prevStack;
+                stackSize = segment->prevStackSize;
+            }
         } while (stackUnwind(fiber, &base, NULL));    
     }
 
@@ -548,6 +721,58 @@ static FORCE_INLINE void pageMoveToBlacklisted(HeapPages *pages, HeapPage *page)
 }
 
 
+static FORCE_INLINE int pageSizeClass(int chunkSize)
+{
+    // Chunks of up to 2 KB have a size class for each size, larger chunks have a size class for each power of two
+    if (chunkSize <= 32 * MEM_MIN_HEAP_CHUNK)
+        return chunkSize / MEM_MIN_HEAP_CHUNK - 1;
+
+    int sizeClass = 32;
+    for (int size = (chunkSize - 1) / (32 * MEM_MIN_HEAP_CHUNK); size > 1; size /= 2)
+        sizeClass++;
+    return sizeClass;
+}
+
+
+static FORCE_INLINE bool pageHasSpace(const HeapPage *page)
+{
+    return page->numOccupiedChunks < page->numChunks;
+}
+
+
+static FORCE_INLINE void pageLinkWithSpace(HeapPages *pages, HeapPage *page)
+{
+    const int sizeClass = pageSizeClass(page->chunkSize);
+
+    page->prevWithSpace = NULL;
+    page->nextWithSpace = pages->firstWithSpace[sizeClass];
+
+    if (pages->firstWithSpace[sizeClass])
+        pages->firstWithSpace[sizeClass]->prevWithSpace = page;
+    pages->firstWithSpace[sizeClass] = page;
+
+    pages->sizeClassesWithSpace |= 1ULL << sizeClass;
+}
+
+
+static FORCE_INLINE void pageUnlinkWithSpace(HeapPages *pages, HeapPage *page)
+{
+    const int sizeClass = pageSizeClass(page->chunkSize);
+
+    if (page == pages->firstWithSpace[sizeClass])
+        pages->firstWithSpace[sizeClass] = page->nextWithSpace;
+
+    if (page->prevWithSpace)
+        page->prevWithSpace->nextWithSpace = page->nextWithSpace;
+
+    if (page->nextWithSpace)
+        page->nextWithSpace->prevWithSpace = page->prevWithSpace;
+
+    if (!pages->firstWithSpace[sizeClass])
+        pages->sizeClassesWithSpace &= ~(1ULL << sizeClass);
+}
+
+
 static FORCE_INLINE HeapPage *pageAdd(HeapPages *pages, int numChunks, int chunkSize)
 {
     const int size = numChunks * chunkSize;
@@ -585,6 +810,9 @@ static FORCE_INLINE HeapPage *pageAdd(HeapPages *pages, int numChunks, int chunk
 
     pages->lastAccessed = page;
 
+    pageIndexAdd(&pages->index, page);
+    pageLinkWithSpace(pages, page);
+
 #ifdef UMKA_REF_CNT_DEBUG
     fprintf(stderr, "Add page at %p\n", page->data);
 #endif
@@ -610,6 +838,11 @@ static FORCE_INLINE void pageRemove(HeapPages *pages, HeapPage *page, bool black
 
     if (page == pages->lastAccessed)
         pages->lastAccessed = pages->first; 
+
+    pageIndexRemove(&pages->index, page);
+
+    if (pageHasSpace(page))
+        pageUnlinkWithSpace(pages, page);
         
     if (blacklist)
         pageMoveToBlacklisted(pages, page);
@@ -648,10 +881,12 @@ static FORCE_INLINE HeapPage *pageFind(HeapPages *pages, void *ptr)
 
     if (pages->lastAccessed && pageContainsPtr(pages, pages->lastAccessed, ptr))
         return pages->lastAccessed;
-        
-    for (HeapPage *page = pages->first; page; page = page->next)
+
+    const int pos = pageIndexFindByAddress(&pages->index, ptr);
+    if (pos >= 0)
     {
-        if (page != pages->lastAccessed && pageContainsPtr(pages, page, ptr))
+        HeapPage *page = pages->index.byAddress[pos];
+        if (pageContainsPtr(pages, page, ptr))
         {
             pages->lastAccessed = page;
             return page;
@@ -664,41 +899,42 @@ static FORCE_INLINE HeapPage *pageFind(HeapPages *pages, void *ptr)
 
 static FORCE_INLINE HeapPage *pageFindForAlloc(HeapPages *pages, int chunkSize)
 {
-    HeapPage *bestPage = NULL;
-    int bestSize = INT_MAX;
+    const int sizeClass = pageSizeClass(chunkSize);
 
-    for (HeapPage *page = pages->first; page; page = page->next)
+    // Small size classes hold a single chunk size, so only large ones may need a search
+    for (HeapPage *page = pages->firstWithSpace[sizeClass]; page; page = page->nextWithSpace)
     {
-        if (page->numOccupiedChunks < page->numChunks)
+        if (page->chunkSize >= chunkSize)
         {
-            if (page->chunkSize == chunkSize)
-            {
-                pages->lastAccessed = page;
-                return page;
-            }
-
-            if (page->chunkSize > chunkSize && page->chunkSize < bestSize)
-            {
-                bestPage = page;
-                bestSize = page->chunkSize;
-            }
+            pages->lastAccessed = page;
+            return page;
         }
     }
 
-    if (bestPage)
-        pages->lastAccessed = bestPage;
-    return bestPage;
+    // Otherwise, take a page from the smallest larger size class
+    if (sizeClass + 1 >= MEM_NUM_SIZE_CLASSES)
+        return NULL;
+
+    uint64_t largerSizeClasses = pages->sizeClassesWithSpace >> (sizeClass + 1);
+    if (!largerSizeClasses)
+        return NULL;
+
+    int largerSizeClass = sizeClass + 1;
+    while (!(largerSizeClasses & 1))
+    {
+        largerSizeClasses >>= 1;
+        largerSizeClass++;
+    }
+
+    pages->lastAccessed = pages->firstWithSpace[largerSizeClass];
+    return pages->firstWithSpace[largerSizeClass];
 }
 
 
 static FORCE_INLINE HeapPage *pageFindById(HeapPages *pages, int id)
 {
-    for (HeapPage *page = pages->first; page; page = page->next)
-    {
-        if (page->id == id)
-            return page;
-    }
-    return NULL;
+    const int pos = pageIndexFindById(&pages->index, id);
+    return (pos >= 0) ? pages->index.byId[pos] : NULL;
 }
 
 
@@ -720,7 +956,10 @@ static FORCE_INLINE void *chunkAlloc(HeapPages *pages, int64_t size, const Type
         page = pageAdd(pages, numChunks, chunkSize);
     }
 
-    HeapChunk *chunk = (HeapChunk *)((char *)page->data + page->numOccupiedChunks * page->chunkSize);
+    HeapChunk *chunk = (HeapChunk *)((char *)page->data + page->numOccupiedChunks++ * page->chunkSize);
+
+    if (!pageHasSpace(page))
+        pageUnlinkWithSpace(pages, page);
 
     memset(chunk, 0, page->chunkSize);
     chunk->refCnt = 1;
@@ -730,7 +969,6 @@ static FORCE_INLINE void *chunkAlloc(HeapPages *pages, int64_t size, const Type
     chunk->ip = pages->fiber->ip;
     chunk->isStack = isStack;
 
-    page->numOccupiedChunks++;
     if (onFree)
         page->numChunksWithOnFree++;
 
@@ -779,6 +1017,144 @@ static FORCE_INLINE int chunkRefCnt(HeapPages *pages, HeapPage *page, void *ptr,
 }
 
 
+static FORCE_INLINE void stackFreeSegment(HeapPages *pages, Slot *stack)
+{
+    HeapPage *page = pageFind(pages, stack);
+    if (UNLIKELY(!page))
+        pages->error->runtimeHandler(pages->error->context, ERR_RUNTIME, "No fiber stack");
+
+    chunkRefCnt(pages, page, stack, -1);
+}
+
+
+static void stackGrow(Fiber *fiber, HeapPages *pages, int64_t movedSlots, int64_t frameSlots, Error *error)
+{
+    // Pointers to stack slots may be stored anywhere, so the stack cannot be relocated. Instead, a new segment is started,
+    // and the return address and parameters already pushed by the caller are moved there. Nothing refers to them yet
+    const int64_t minStackSize = sizeof(StackSegment) / sizeof(Slot) + movedSlots + frameSlots + 2 * MEM_MIN_FREE_STACK;
+    const int64_t maxStackSize = fiber->maxStackSize - fiber->totalStackSize;
+
+    if (minStackSize > maxStackSize)
+    {
+        // Use the rest of the current segment, if possible
+        if (UNLIKELY(fiber->top - frameSlots - fiber->stack < MEM_MIN_FREE_STACK))
+            error->runtimeHandler(error->context, ERR_RUNTIME, "Stack overflow");
+        return;
+    }
+
+    Slot *stack = NULL;
+    int64_t stackSize = 0;
+
+    if (fiber->spareStack && fiber->spareStackSize >= minStackSize && fiber->spareStackSize <= maxStackSize)
+    {
+        stack = fiber->spareStack;
+        stackSize = fiber->spareStackSize;
+    }
+    else
+    {
+        if (fiber->spareStack)
+            stackFreeSegment(pages, fiber->spareStack);
+
+        stackSize = 2 * fiber->stackSize;
+        if (stackSize < minStackSize)
+            stackSize = minStackSize;
+        if (stackSize > maxStackSize)
+            stackSize = maxStackSize;
+
+        stack = chunkAlloc(pages, stackSize * sizeof(Slot), NULL, NULL, true, error);
+    }
+
+    fiber->spareStack = NULL;
+    fiber->spareStackSize = 0;
+
+    StackSegment *segment = (StackSegment *)(stack + stackSize) - 1;
+    segment->prevStack = fiber->stack;
+    segment->prevStackSize = fiber->stackSize;
+    segment->prevTop = fiber->top + movedSlots;
+
+    Slot *top = (Slot *)segment - movedSlots;
+    memcpy(top, fiber->top, movedSlots * sizeof(Slot));
+
+    fiber->stack = stack;
+    fiber->stackSize = stackSize;
+    fiber->totalStackSize += stackSize;
+    fiber->top = top;
+}
+
+
+static void stackShrink(Fiber *fiber, HeapPages *pages)
+{
+    const StackSegment *segment = stackGetSegment(fiber, fiber->stack, fiber->stackSize);
+    if (!segment)
+        return;
+
+    Slot *spareStack = fiber->spareStack;
+
+    // Keep the released segment, so that calls repeatedly crossing the segment boundary do not allocate
+    fiber->spareStack = fiber->stack;
+    fiber->spareStackSize = fiber->stackSize;
+    fiber->totalStackSize -= fiber->stackSize;
+
+    fiber->stack = segment->prevStack;
+    fiber->stackSize = segment->prevStackSize;
+    fiber->top = segment->prevTop;
+
+    // The fiber must be consistent before freeing, as freeing involves stack scanning
+    if (spareStack)
+        stackFreeSegment(pages, spareStack);
+}
+
+
+static void stackFree(HeapPages *pages, Fiber *fiber)
+{
+    Slot *stack = fiber->stack;
+    int64_t stackSize = fiber->stackSize;
+
+    while (stack)
+    {
+        // Read the header before the segment is freed
+        const StackSegment *segment = stackGetSegment(fiber, stack, stackSize);
+        Slot *prevStack = segment ? segment->prevStack : NULL;
+        const int64_t prevStackSize = segment ? segment->prevStackSize : 0;
+
+        stackFreeSegment(pages, stack);
+
+        stack = prevStack;
+        stackSize = prevStackSize;
+    }
+
+    if (fiber->spareStack)
+        stackFreeSegment(pages, fiber->spareStack);
+}
+
+
+static FORCE_INLINE void fiberRefCnt(HeapPages *pages, Fiber *fiber, TokenKind tokKind)
+{
+    HeapPage *page = pageFind(pages, fiber);
+    if (!page)
+        return;
+
+    if (tokKind == TOK_PLUSPLUS)
+        chunkRefCnt(pages, page, fiber, 1);
+    else
+    {
+        const HeapChunk *chunk = pageGetChunk(page, fiber);
+        if (chunk->refCnt > 1)
+        {
+            chunkRefCnt(pages, page, fiber, -1);
+            return;
+        }
+
+        if (UNLIKELY(fiber->alive))
+            pages->error->runtimeHandler(pages->error->context, ERR_RUNTIME, "Cannot destroy a busy fiber");
+
+        // Only one ref is left. Free the stack before removing the ref
+        stackFree(pages, fiber);
+        chunkRefCnt(pages, page, fiber, -1);
+    }
+}
+
+
 // Helper functions
 
 static FORCE_INLINE int fsgetc(FILE *file, char *string, int *len)
@@ -843,10 +1219,10 @@ static FORCE_INLINE char *fsscanfString(Storage *storage, FILE *file, char *stri
 }
 
 
-typedef int (*QSortCompareFn)(const void *a, const void *b, void *context);
+typedef int (*SortCompareFn)(const void *a, const void *b, void *context);
 
 
-FORCE_INLINE void qsortSwap(void *a, void *b, void *temp, int itemSize)
+static FORCE_INLINE void sortSwap(void *a, void *b, void *temp, int itemSize)
 {
     memcpy(temp, a, itemSize);
     memcpy(a, b, itemSize);
@@ -854,40 +1230,205 @@ FORCE_INLINE void qsortSwap(void *a, void *b, void *temp, int itemSize)
 }
 
 
-FORCE_INLINE char *qsortPartition(char *first, char *last, int itemSize, QSortCompareFn compare, void *context, void *temp)
+static void sortInsertion(char *data, int64_t len, int itemSize, SortCompareFn compare, void *context, void *temp)
+{
+    // Items are swapped rather than shifted, so that only array items are ever passed to compare(). Stable
+    for (int64_t i = 1; i < len; i++)
+        for (char *item = data + i * itemSize; item > data && compare(item - itemSize, item, context) > 0; item -= itemSize)
+            sortSwap(item - itemSize, item, temp, itemSize);
+}
+
+
+static bool sortPartialInsertion(char *data, int64_t len, int itemSize, SortCompareFn compare, void *context, void *temp)
 {
-    char *i = first;
-    char *j = last;
+    // Gives up after a few moves. Nearly sorted partitions are finished without further partitioning
+    int numMoves = 0;
+
+    for (int64_t i = 1; i < len; i++)
+    {
+        for (char *item = data + i * itemSize; item > data && compare(item - itemSize, item, context) > 0; item -= itemSize)
+        {
+            if (++numMoves > SORT_MAX_PARTIAL_INSERTION_MOVES)
+                return false;
+
+            sortSwap(item - itemSize, item, temp, itemSize);
+        }
+    }
+
+    return true;
+}
 
-    char *pivot = first;
 
-    while (i < j)
+static void sortHeap(char *data, int64_t len, int itemSize, SortCompareFn compare, void *context, void *temp)
+{
+    for (int64_t end = len, start = len / 2; end > 1;)
     {
-        while (compare(i, pivot, context) <= 0 && i < last)
-            i += itemSize;
+        // First build the heap, then move the largest items to the end one by one
+        if (start > 0)
+            start--;
+        else
+            sortSwap(data, data + --end * itemSize, temp, itemSize);
+
+        for (int64_t parent = start; ;)
+        {
+            int64_t child = 2 * parent + 1;
+            if (child >= end)
+                break;
 
-        while (compare(j, pivot, context) > 0 && j > first)
+            if (child + 1 < end && compare(data + child * itemSize, data + (child + 1) * itemSize, context) < 0)
+                child++;
+
+            if (compare(data + parent * itemSize, data + child * itemSize, context) >= 0)
+                break;
+
+            sortSwap(data + parent * itemSize, data + child * itemSize, temp, itemSize);
+            parent = child;
+        }
+    }
+}
+
+
+static void sortIntro(char *data, int64_t len, int itemSize, SortCompareFn compare, void *context, void *temp, int depthLimit)
+{
+    while (len > SORT_MAX_INSERTION_LEN)
+    {
+        // Too many bad partitions, switch to the guaranteed O(n log n)
+        if (depthLimit-- == 0)
+        {
+            sortHeap(data, len, itemSize, compare, context, temp);
+            return;
+        }
+
+        char *first = data;
+        char *middle = data + (len / 2) * itemSize;
+        char *last = data + (len - 1) * itemSize;
+
+        // Median of three becomes the pivot at the first position
+        if (compare(middle, first, context) < 0)
+            sortSwap(middle, first, temp, itemSize);
+        if (compare(last, middle, context) < 0)
+        {
+            sortSwap(last, middle, temp, itemSize);
+            if (compare(middle, first, context) < 0)
+                sortSwap(middle, first, temp, itemSize);
+        }
+        sortSwap(first, middle, temp, itemSize);
+
+        // Hoare partition. Items equal to the pivot stop both scans, so that many equal items are spread evenly
+        char *pivot = first;
+        char *i = first + itemSize;
+        char *j = last;
+        bool alreadyPartitioned = true;
+
+        while (true)
+        {
+            while (i < last && compare(i, pivot, context) < 0)
+                i += itemSize;
+
+            while (j > first && compare(j, pivot, context) > 0)
+                j -= itemSize;
+
+            if (i >= j)
+                break;
+
+            sortSwap(i, j, temp, itemSize);
+            alreadyPartitioned = false;
+
+            i += itemSize;
             j -= itemSize;
+        }
+
+        sortSwap(pivot, j, temp, itemSize);
 
-        if (i < j)
-            qsortSwap(i, j, temp, itemSize);
+        const int64_t leftLen = (j - data) / itemSize;
+        const int64_t rightLen = len - leftLen - 1;
+
+        // Sorted or nearly sorted input needs no further partitioning
+        if (alreadyPartitioned &&
+            sortPartialInsertion(data, leftLen, itemSize, compare, context, temp) &&
+            sortPartialInsertion(j + itemSize, rightLen, itemSize, compare, context, temp))
+            return;
+
+        // Recursion for the smaller part only, so that the stack depth is O(log n)
+        if (leftLen < rightLen)
+        {
+            sortIntro(data, leftLen, itemSize, compare, context, temp, depthLimit);
+            data = j + itemSize;
+            len = rightLen;
+        }
+        else
+        {
+            sortIntro(j + itemSize, rightLen, itemSize, compare, context, temp, depthLimit);
+            len = leftLen;
+        }
     }
 
-    qsortSwap(pivot, j, temp, itemSize);
+    sortInsertion(data, len, itemSize, compare, context, temp);
+}
+
+
+static void sortUnstable(char *data, int64_t len, int itemSize, SortCompareFn compare, void *context, void *temp)
+{
+    // Introsort. Only array items are ever passed to compare()
+    int depthLimit = 0;
+    for (int64_t i = len; i > 1; i >>= 1)
+        depthLimit += 2;
 
-    return j;
+    sortIntro(data, len, itemSize, compare, context, temp, depthLimit);
 }
 
 
-void qsortEx(char *first, char *last, int itemSize, QSortCompareFn compare, void *context, void *temp)
+static void sortMerge(char *data, int64_t len, int itemSize, SortCompareFn compare, void *context, void *temp, char *buffer)
 {
-    if (first >= last)
+    if (len <= SORT_MAX_INSERTION_LEN)
+    {
+        sortInsertion(data, len, itemSize, compare, context, temp);
+        return;
+    }
+
+    const int64_t leftLen = len / 2;
+    char *right = data + leftLen * itemSize;
+    char *end = data + len * itemSize;
+
+    sortMerge(data, leftLen, itemSize, compare, context, temp, buffer);
+    sortMerge(right, len - leftLen, itemSize, compare, context, temp, buffer);
+
+    // Already ordered halves need no merging
+    if (compare(right - itemSize, right, context) <= 0)
         return;
 
-    char *partition = qsortPartition(first, last, itemSize, compare, context, temp);
+    // Merge the left half moved to the buffer with the right half in place. Equal items are taken from the left half first
+    memcpy(buffer, data, leftLen * itemSize);
+
+    char *left = buffer;
+    char *leftEnd = buffer + leftLen * itemSize;
+    char *dest = data;
+
+    while (left < leftEnd && right < end)
+    {
+        if (compare(left, right, context) <= 0)
+        {
+            memcpy(dest, left, itemSize);
+            left += itemSize;
+        }
+        else
+        {
+            memcpy(dest, right, itemSize);
+            right += itemSize;
+        }
+        dest += itemSize;
+    }
+
+    memcpy(dest, left, leftEnd - left);
+}
+
 
-    qsortEx(first, partition - itemSize, itemSize, compare, context, temp);
-    qsortEx(partition + itemSize, last, itemSize, compare, context, temp);
+static void sortStable(char *data, int64_t len, int itemSize, SortCompareFn compare, void *context, void *temp, Storage *storage)
+{
+    // Merge sort. Items in the temporary buffer are also passed to compare()
+    char *buffer = storageAdd(storage, (len / 2 + 1) * itemSize);
+    sortMerge(data, len, itemSize, compare, context, temp, buffer);
+    storageRemove(storage, buffer);
 }
 
 
@@ -904,10 +1445,18 @@ void vmInit(VM *vm, Storage *storage, int stackSize, bool fileSystemEnabled, Err
 
     pageInit(&vm->pages, vm->fiber, vm->storage, error);
 
+    // The main fiber stack is never extended
     vm->fiber->stack = chunkAlloc(&vm->pages, stackSize * sizeof(Slot), NULL, NULL, true, error);
-    vm->fiber->stackSize = stackSize;
+    vm->fiber->stackSize = vm->fiber->totalStackSize = vm->fiber->maxStackSize = stackSize;
+    vm->fiber->stackBottom = vm->fiber->stack + stackSize - 1;
+    vm->fiber->spareStack = NULL;
+    vm->fiber->spareStackSize = 0;
 
+    memset(&vm->sched, 0, sizeof(vm->sched));
+    memset(&vm->profiler, 0, sizeof(vm->profiler));
     memset(&vm->hooks, 0, sizeof(vm->hooks));
+    vm->dispatch = NULL;
+    vm->sortContext = NULL;
     vm->terminatedNormally = false;
     vm->error = error;
 
@@ -915,28 +1464,103 @@ void vmInit(VM *vm, Storage *storage, int stackSize, bool fileSystemEnabled, Err
 }
 
 
-void vmFree(VM *vm)
+#ifdef UMKA_VM_PAIR_STATS
+
+enum
 {
-    HeapPage *page = pageFind(&vm->pages, vm->mainFiber->stack);
-    if (UNLIKELY(!page))
-       vm->error->runtimeHandler(vm->error->context, ERR_RUNTIME, "No fiber stack");
+    NUM_OPCODES         = OP_HALT + 1,
+    MAX_REPORTED_PAIRS  = 50
+};
 
-    chunkRefCnt(&vm->pages, page, vm->mainFiber->stack, -1);
+
+static int64_t opcodePairCount[NUM_OPCODES][NUM_OPCODES];
+static Opcode prevOpcode = OP_NOP;
+
+
+static int opcodePairCompare(const void *a, const void *b)
+{
+    const int64_t countA = *(const int64_t *)(*(const int64_t **)a);
+    const int64_t countB = *(const int64_t *)(*(const int64_t **)b);
+    return (countA < countB) - (countA > countB);
+}
+
+
+static void vmPrintOpcodePairStats(void)
+{
+    // Dynamic opcode pair frequencies, to be used for choosing new superinstructions in the code generator
+    static const int64_t *pairs[NUM_OPCODES * NUM_OPCODES];
+    int64_t totalCount = 0;
+
+    for (int i = 0; i < NUM_OPCODES * NUM_OPCODES; i++)
+    {
+        pairs[i] = &opcodePairCount[0][0] + i;
+        totalCount += *pairs[i];
+    }
+
+    qsort(pairs, NUM_OPCODES * NUM_OPCODES, sizeof(pairs[0]), opcodePairCompare);
+
+    fprintf(stderr, "\nOpcode pair frequencies (%lld pairs):\n", (long long int)totalCount);
+
+    for (int i = 0; i < MAX_REPORTED_PAIRS && *pairs[i] > 0; i++)
+    {
+        const int index = pairs[i] - &opcodePairCount[0][0];
+        fprintf(stderr, "%28s %28s %15lld %6.2lf%%\n",
+                opcodeSpelling[index / NUM_OPCODES], opcodeSpelling[index % NUM_OPCODES], (long long int)*pairs[i], 100.0 * *pairs[i] / totalCount);
+    }
+}
+
+#endif
+
+
+void vmFree(VM *vm)
+{
+#ifdef UMKA_VM_PAIR_STATS
+    vmPrintOpcodePairStats();
+#endif
+
+    if (vm->sched.timers)
+        storageRemove(vm->storage, vm->sched.timers);
+
+    if (vm->sched.ioWaits)
+        storageRemove(vm->storage, vm->sched.ioWaits);
+
+    if (vm->sched.pollFds)
+        storageRemove(vm->storage, vm->sched.pollFds);
+
+    // The current fiber may be allocated on one of the pages to be freed, e.g., after a runtime error in a child fiber
+    vm->fiber = vm->pages.fiber = vm->mainFiber;
+
+    stackFree(&vm->pages, vm->mainFiber);
     pageFree(&vm->pages, vm->storage);
 }
 
 
-void vmReset(VM *vm, const Instruction *code, const DebugInfo *debugPerInstr)
+static const void *const *vmLoop(VM *vm);
+
+
+void vmReset(VM *vm, const Instruction *code, int codeSize, const DebugInfo *debugPerInstr)
 {
     vm->fiber = vm->pages.fiber = vm->mainFiber;
     vm->fiber->code = code;
     vm->fiber->debugPerInstr = debugPerInstr;
     vm->fiber->ip = 0;
-    vm->fiber->top = vm->fiber->base = vm->fiber->stack + vm->fiber->stackSize - 1;
-}
+    vm->fiber->top = vm->fiber->base = vm->fiber->stackBottom;
 
+    // Pre-resolve instruction handler addresses, if supported
+    if (vm->dispatch)
+    {
+        storageRemove(vm->storage, vm->dispatch);
+        vm->dispatch = NULL;
+    }
 
-static void vmLoop(VM *vm);
+    const void *const *handlers = vmLoop(NULL);
+    if (handlers && codeSize > 0)
+    {
+        vm->dispatch = storageAdd(vm->storage, codeSize * sizeof(void *));
+        for (int ip = 0; ip < codeSize; ip++)
+            vm->dispatch[ip] = handlers[code[ip].opcode];
+    }
+}
 
 
 static FORCE_INLINE void doCheckStr(const char *str, Error *error)
@@ -952,6 +1576,34 @@ static FORCE_INLINE void doCheckStr(const char *str, Error *error)
 }
 
 
+static FORCE_INLINE bool doStrEqual(const char *lhsStr, const char *rhsStr)
+{
+    if (lhsStr == rhsStr)
+        return true;
+
+    const StrDimensions *lhsDims = getStrDims(lhsStr);
+    const StrDimensions *rhsDims = getStrDims(rhsStr);
+
+    if (lhsDims->len != rhsDims->len)
+        return false;
+
+    // Hashes are only compared if both are already known
+    if (lhsDims->hash > STR_HASH_READ_ONLY && rhsDims->hash > STR_HASH_READ_ONLY && lhsDims->hash != rhsDims->hash)
+        return false;
+
+    return memcmp(lhsStr, rhsStr, lhsDims->len) == 0;
+}
+
+
+static FORCE_INLINE void doResetStrHash(char *str)
+{
+    // Called after modifying the string in place
+    StrDimensions *dims = getStrDims(str);
+    if (dims->hash != STR_HASH_READ_ONLY)
+        dims->hash = STR_HASH_NONE;
+}
+
+
 static FORCE_INLINE char *doGetEmptyStr(void);
 static FORCE_INLINE void doGetEmptyDynArray(DynArray *array, const Type *type);
 
@@ -1166,35 +1818,472 @@ static int64_t doCompare(Slot lhs, Slot rhs, const Type *type, Error *error)
 }
 
 
-static FORCE_INLINE void doAddPtrBaseRefCntCandidate(RefCntCandidates *candidates, void *ptr, const Type *type)
+static FORCE_INLINE int64_t doCompareInts(int64_t lhs, int64_t rhs)
 {
-    if (type->base->isGarbageCollected)
+    return (lhs == rhs) ? 0 : (lhs > rhs) ? 1 : -1;
+}
+
+
+static FORCE_INLINE int64_t doCompareUints(uint64_t lhs, uint64_t rhs)
+{
+    return (lhs == rhs) ? 0 : (lhs > rhs) ? 1 : -1;
+}
+
+
+static FORCE_INLINE int64_t doCompareReals(double lhs, double rhs)
+{
+    const double diff = lhs - rhs;
+    return (diff == 0.0) ? 0 : (diff > 0.0) ? 1 : -1;
+}
+
+
+static FORCE_INLINE int64_t doCompareByPlan(const void *lhs, const void *rhs, const ComparePlan *plan, int firstStep, Error *error)
+{
+    // Same as doCompare(), but for values stored in memory and without recursive type dispatch
+    for (int i = firstStep; i < plan->numSteps; i++)
     {
-        void *data = ptr;
-        if (type->base->kind == TYPE_PTR || type->base->kind == TYPE_STR || type->base->kind == TYPE_FIBER)
-            data = *(void **)data;
+        const CompareStep *step = &plan->step[i];
 
-        candidatePush(candidates, data, type->base);
+        const char *lhsItem = (const char *)lhs + step->offset;
+        const char *rhsItem = (const char *)rhs + step->offset;
+
+        int64_t itemDiff = 0;
+
+        switch (step->kind)
+        {
+            case COMPARE_INT8:      itemDiff = doCompareInts (*(const int8_t   *)lhsItem, *(const int8_t   *)rhsItem); break;
+            case COMPARE_INT16:     itemDiff = doCompareInts (*(const int16_t  *)lhsItem, *(const int16_t  *)rhsItem); break;
+            case COMPARE_INT32:     itemDiff = doCompareInts (*(const int32_t  *)lhsItem, *(const int32_t  *)rhsItem); break;
+            case COMPARE_INT:       itemDiff = doCompareInts (*(const int64_t  *)lhsItem, *(const int64_t  *)rhsItem); break;
+            case COMPARE_UINT8:     itemDiff = doCompareUints(*(const uint8_t  *)lhsItem, *(const uint8_t  *)rhsItem); break;
+            case COMPARE_UINT16:    itemDiff = doCompareUints(*(const uint16_t *)lhsItem, *(const uint16_t *)rhsItem); break;
+            case COMPARE_UINT32:    itemDiff = doCompareUints(*(const uint32_t *)lhsItem, *(const uint32_t *)rhsItem); break;
+            case COMPARE_UINT:      itemDiff = doCompareUints(*(const uint64_t *)lhsItem, *(const uint64_t *)rhsItem); break;
+            case COMPARE_REAL32:    itemDiff = doCompareReals(*(const float    *)lhsItem, *(const float    *)rhsItem); break;
+            case COMPARE_REAL:      itemDiff = doCompareReals(*(const double   *)lhsItem, *(const double   *)rhsItem); break;
+            case COMPARE_PTR:       itemDiff = doCompareUints(*(const uintptr_t *)lhsItem, *(const uintptr_t *)rhsItem); break;
+            case COMPARE_STR:
+            {
+                const char *lhsStr = *(const char **)lhsItem;
+                const char *rhsStr = *(const char **)rhsItem;
+
+                if (lhsStr == rhsStr)
+                    break;
+
+                if (!lhsStr)
+                    lhsStr = doGetEmptyStr();
+
+                if (!rhsStr)
+                    rhsStr = doGetEmptyStr();
+
+                doCheckStr(lhsStr, error);
+                doCheckStr(rhsStr, error);
+
+                itemDiff = strcmp(lhsStr, rhsStr);
+                break;
+            }
+            case COMPARE_GENERIC:
+            {
+                Slot lhsSlot = {.ptrVal = (void *)lhsItem};
+                Slot rhsSlot = {.ptrVal = (void *)rhsItem};
+
+                doDerefImpl(&lhsSlot, step->type->kind, error);
+                doDerefImpl(&rhsSlot, step->type->kind, error);
+
+                itemDiff = doCompare(lhsSlot, rhsSlot, step->type, error);
+                break;
+            }
+        }
+
+        if (itemDiff != 0)
+            return itemDiff;
     }
+    return 0;
 }
 
 
-static FORCE_INLINE void doAddArrayItemsRefCntCandidates(RefCntCandidates *candidates, void *ptr, const Type *type, int len)
+static FORCE_INLINE bool doEqualByPlan(const void *lhs, const void *rhs, const ComparePlan *plan, Error *error)
 {
-    if (type->base->isGarbageCollected)
+    if (plan->numSteps == 1 && plan->step[0].kind == COMPARE_STR)
     {
-        char *itemPtr = ptr;
-        const int itemSize = type->base->size;
+        // Single strings are the most frequent map keys
+        const char *lhsStr = *(const char **)((const char *)lhs + plan->step[0].offset);
+        const char *rhsStr = *(const char **)((const char *)rhs + plan->step[0].offset);
 
-        for (int i = 0; i < len; i++)
+        if (!lhsStr)
+            lhsStr = doGetEmptyStr();
+
+        if (!rhsStr)
+            rhsStr = doGetEmptyStr();
+
+        doCheckStr(lhsStr, error);
+        doCheckStr(rhsStr, error);
+
+        return doStrEqual(lhsStr, rhsStr);
+    }
+
+    if (plan->memEqualSize == sizeof(uint64_t))
+    {
+        // Single integers and pointers are the most frequent case
+        uint64_t lhsBits, rhsBits;
+        memcpy(&lhsBits, lhs, sizeof(uint64_t));
+        memcpy(&rhsBits, rhs, sizeof(uint64_t));
+
+        if (lhsBits != rhsBits)
+            return false;
+    }
+    else if (plan->memEqualSize > 0 && memcmp(lhs, rhs, plan->memEqualSize) != 0)
+        return false;
+
+    return doCompareByPlan(lhs, rhs, plan, plan->firstStepAfterMemEqual, error) == 0;
+}
+
+
+typedef struct
+{
+    const Type *itemType;
+    int64_t offset;
+    bool ascending;
+    Error *error;
+} FastCompareContext;
+
+
+static int sortFastCompare(const void *a, const void *b, void *context)
+{
+    FastCompareContext *fastCompareContext = (FastCompareContext *)context;
+
+    const Type *itemType = fastCompareContext->itemType;
+    const int sign = fastCompareContext->ascending ? 1 : -1;
+    Error *error = fastCompareContext->error;
+
+    const void *lhsItem = (const char *)a + fastCompareContext->offset;
+    const void *rhsItem = (const char *)b + fastCompareContext->offset;
+
+    const int64_t itemDiff = doCompareByPlan(lhsItem, rhsItem, itemType->comparePlan, 0, error);
+    return itemDiff == 0 ? 0 : itemDiff > 0 ? sign : -sign;
+}
+
+
+static int sortFastIntCompare(const void *a, const void *b, void *context)
+{
+    FastCompareContext *fastCompareContext = (FastCompareContext *)context;
+
+    const int64_t lhsItem = *(const int64_t *)((const char *)a + fastCompareContext->offset);
+    const int64_t rhsItem = *(const int64_t *)((const char *)b + fastCompareContext->offset);
+
+    const int64_t itemDiff = doCompareInts(lhsItem, rhsItem);
+    return fastCompareContext->ascending ? itemDiff : -itemDiff;
+}
+
+
+static int sortFastRealCompare(const void *a, const void *b, void *context)
+{
+    FastCompareContext *fastCompareContext = (FastCompareContext *)context;
+
+    const double lhsItem = *(const double *)((const char *)a + fastCompareContext->offset);
+    const double rhsItem = *(const double *)((const char *)b + fastCompareContext->offset);
+
+    const int64_t itemDiff = doCompareReals(lhsItem, rhsItem);
+    return fastCompareContext->ascending ? itemDiff : -itemDiff;
+}
+
+
+static SortCompareFn sortFastComparator(const Type *itemType)
+{
+    // Single integers and reals need no plan interpretation
+    const ComparePlan *plan = itemType->comparePlan;
+    if (plan->numSteps == 1)
+    {
+        switch (plan->step[0].kind)
         {
-            void *item = itemPtr;
-            if (type->base->kind == TYPE_PTR || type->base->kind == TYPE_STR || type->base->kind == TYPE_FIBER)
-                item = *(void **)item;
+            case COMPARE_INT:   return sortFastIntCompare;
+            case COMPARE_REAL:  return sortFastRealCompare;
+            default:            break;
+        }
+    }
+    return sortFastCompare;
+}
 
-            candidatePush(candidates, item, type->base);
-            itemPtr += itemSize;
+
+static FORCE_INLINE uint64_t doGetRadixSortKey(const char *item, CompareStepKind kind, bool ascending)
+{
+    // Unsigned integer keys ordered as the original values
+    uint64_t key = 0;
+
+    switch (kind)
+    {
+        case COMPARE_INT8:      key = (uint64_t)(int64_t)*(const int8_t  *)item ^ (1ULL << 63); break;
+        case COMPARE_INT16:     key = (uint64_t)(int64_t)*(const int16_t *)item ^ (1ULL << 63); break;
+        case COMPARE_INT32:     key = (uint64_t)(int64_t)*(const int32_t *)item ^ (1ULL << 63); break;
+        case COMPARE_INT:       key = (uint64_t)         *(const int64_t *)item ^ (1ULL << 63); break;
+        case COMPARE_UINT8:     key = *(const uint8_t  *)item; break;
+        case COMPARE_UINT16:    key = *(const uint16_t *)item; break;
+        case COMPARE_UINT32:    key = *(const uint32_t *)item; break;
+        case COMPARE_UINT:      key = *(const uint64_t *)item; break;
+        case COMPARE_REAL32:
+        case COMPARE_REAL:
+        {
+            double val = (kind == COMPARE_REAL32) ? *(const float *)item : *(const double *)item;
+
+            // Zeros of both signs are equal
+            if (val == 0.0)
+                val = 0.0;
+
+            memcpy(&key, &val, sizeof(key));
+            key = (key & (1ULL << 63)) ? ~key : (key | (1ULL << 63));
+            break;
         }
+        default: break;
+    }
+
+    return ascending ? key : ~key;
+}
+
+
+static void sortRadix(char *data, int64_t len, int itemSize, int64_t offset, CompareStepKind kind, bool ascending, Storage *storage)
+{
+    // Least significant digit first radix sort with 8-bit digits. Stable
+    enum {NUM_DIGITS = sizeof(uint64_t), NUM_DIGIT_VALS = 256};
+
+    int64_t (*counts)[NUM_DIGIT_VALS] = storageAdd(storage, NUM_DIGITS * NUM_DIGIT_VALS * sizeof(int64_t));
+
+    for (int64_t i = 0; i < len; i++)
+    {
+        const uint64_t key = doGetRadixSortKey(data + i * itemSize + offset, kind, ascending);
+        for (int digit = 0; digit < NUM_DIGITS; digit++)
+            counts[digit][(key >> (8 * digit)) & 0xFF]++;
+    }
+
+    char *buffer = storageAdd(storage, len * itemSize);
+
+    char *src = data;
+    char *dest = buffer;
+
+    for (int digit = 0; digit < NUM_DIGITS; digit++)
+    {
+        // Skip the digits that are the same for all items
+        const uint64_t firstKey = doGetRadixSortKey(src + offset, kind, ascending);
+        if (counts[digit][(firstKey >> (8 * digit)) & 0xFF] == len)
+            continue;
+
+        int64_t pos[NUM_DIGIT_VALS];
+        int64_t totalCount = 0;
+
+        for (int val = 0; val < NUM_DIGIT_VALS; val++)
+        {
+            pos[val] = totalCount;
+            totalCount += counts[digit][val];
+        }
+
+        for (int64_t i = 0; i < len; i++)
+        {
+            const char *item = src + i * itemSize;
+            const uint64_t key = doGetRadixSortKey(item + offset, kind, ascending);
+            memcpy(dest + pos[(key >> (8 * digit)) & 0xFF]++ * itemSize, item, itemSize);
+        }
+
+        char *swap = src;
+        src = dest;
+        dest = swap;
+    }
+
+    if (src != data)
+        memcpy(data, src, len * itemSize);
+
+    storageRemove(storage, buffer);
+    storageRemove(storage, counts);
+}
+
+
+static void doSortFast(char *data, int64_t len, const Type *itemType, int64_t offset, bool ascending, int itemSize, void *temp, Storage *storage, Error *error)
+{
+    // Integers and reals, or structures of them, are sorted by their bits, everything else by comparison. Stable in both cases
+    const ComparePlan *plan = itemType->comparePlan;
+
+    bool radix = len >= SORT_MIN_RADIX_LEN && plan->numSteps <= SORT_MAX_RADIX_STEPS;
+    for (int i = 0; radix && i < plan->numSteps; i++)
+        radix = plan->step[i].kind != COMPARE_PTR && plan->step[i].kind != COMPARE_STR && plan->step[i].kind != COMPARE_GENERIC;
+
+    if (radix)
+    {
+        // Since each sort is stable, sorting by the least significant step first gives the lexicographic order
+        for (int i = plan->numSteps - 1; i >= 0; i--)
+            sortRadix(data, len, itemSize, offset + plan->step[i].offset, plan->step[i].kind, ascending, storage);
+        return;
+    }
+
+    FastCompareContext context = {itemType, offset, ascending, error};
+    sortStable(data, len, itemSize, sortFastComparator(itemType), &context, temp, storage);
+}
+
+
+static FORCE_INLINE uint64_t doHashStr(const char *str, Error *error)
+{
+    if (!str)
+        str = doGetEmptyStr();
+
+    doCheckStr(str, error);
+
+    StrDimensions *dims = getStrDims(str);
+    if (dims->hash > STR_HASH_READ_ONLY)
+        return dims->hash;
+
+    const uint64_t hash = hashStr(str);
+    if (dims->hash == STR_HASH_NONE)
+        dims->hash = hash;
+
+    return hash;
+}
+
+
+static uint64_t doHash(Slot slot, const Type *type, Error *error)
+{
+    // Values equal according to doCompare() should have equal hashes
+    switch (type->kind)
+    {
+        case TYPE_INT8:
+        case TYPE_INT16:
+        case TYPE_INT32:
+        case TYPE_INT:
+        case TYPE_UINT8:
+        case TYPE_UINT16:
+        case TYPE_UINT32:
+        case TYPE_UINT:
+        case TYPE_BOOL:
+        case TYPE_CHAR:     return hashBits(slot.uintVal);
+        case TYPE_REAL32:
+        case TYPE_REAL:
+        {
+            // Zeros of both signs are equal
+            const double val = (slot.realVal == 0.0) ? 0.0 : slot.realVal;
+
+            uint64_t bits = 0;
+            memcpy(&bits, &val, sizeof(bits));
+            return hashBits(bits);
+        }
+        case TYPE_PTR:      return hashBits((uint64_t)(uintptr_t)slot.ptrVal);
+        case TYPE_WEAKPTR:  return hashBits(slot.weakPtrVal);
+        case TYPE_STR:      return doHashStr(slot.ptrVal, error);
+        case TYPE_ARRAY:
+        case TYPE_STRUCT:
+        {
+            uint64_t hash = 0;
+            for (int i = 0; i < type->numItems; i++)
+            {
+                const Type *itemType = (type->kind == TYPE_ARRAY) ? type->base : type->field[i]->type;
+                const int itemOffset = (type->kind == TYPE_ARRAY) ? (i * itemType->size) : type->field[i]->offset;
+
+                Slot item = {.ptrVal = (char *)slot.ptrVal + itemOffset};
+                doDerefImpl(&item, itemType->kind, error);
+
+                hash = hashBits(hash + doHash(item, itemType, error));
+            }
+            return hash;
+        }
+        case TYPE_DYNARRAY:
+        {
+            const DynArray *array = slot.ptrVal;
+            if (UNLIKELY(!array))
+                error->runtimeHandler(error->context, ERR_RUNTIME, "Dynamic array is null");
+
+            const int64_t len = array->data ? getDims(array)->len : 0;
+
+            uint64_t hash = 0;
+            for (int i = 0; i < len; i++)
+            {
+                Slot item = {.ptrVal = (char *)array->data + i * type->base->size};
+                doDerefImpl(&item, type->base->kind, error);
+
+                hash = hashBits(hash + doHash(item, type->base, error));
+            }
+            return hash;
+        }
+
+        default: error->runtimeHandler(error->context, ERR_RUNTIME, "Illegal type"); return 0;
+    }
+}
+
+
+static FORCE_INLINE uint64_t doHashByPlan(const void *ptr, const ComparePlan *plan, Error *error)
+{
+    // Should be consistent with doEqualByPlan()
+    uint64_t hash = 0;
+
+    int offset = 0;
+    for (; offset + (int)sizeof(uint64_t) <= plan->memEqualSize; offset += sizeof(uint64_t))
+    {
+        uint64_t bits;
+        memcpy(&bits, (const char *)ptr + offset, sizeof(uint64_t));
+        hash = hashBits(hash + bits);
+    }
+
+    if (offset < plan->memEqualSize)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, (const char *)ptr + offset, plan->memEqualSize - offset);
+        hash = hashBits(hash + bits);
+    }
+
+    for (int i = plan->firstStepAfterMemEqual; i < plan->numSteps; i++)
+    {
+        const CompareStep *step = &plan->step[i];
+        const char *item = (const char *)ptr + step->offset;
+
+        uint64_t itemHash = 0;
+
+        switch (step->kind)
+        {
+            case COMPARE_REAL32:
+            case COMPARE_REAL:
+            {
+                // Zeros of both signs are equal
+                double val = (step->kind == COMPARE_REAL32) ? *(const float *)item : *(const double *)item;
+                if (val == 0.0)
+                    val = 0.0;
+
+                uint64_t bits = 0;
+                memcpy(&bits, &val, sizeof(bits));
+                itemHash = hashBits(bits);
+                break;
+            }
+            case COMPARE_STR:
+            {
+                itemHash = doHashStr(*(const char **)item, error);
+                break;
+            }
+            case COMPARE_GENERIC:
+            {
+                Slot slot = {.ptrVal = (void *)item};
+                doDerefImpl(&slot, step->type->kind, error);
+                itemHash = doHash(slot, step->type, error);
+                break;
+            }
+            default:
+            {
+                // Integers and pointers separated by padding
+                Slot slot = {.ptrVal = (void *)item};
+                doDerefImpl(&slot, step->type->kind, error);
+                itemHash = hashBits(slot.uintVal);
+                break;
+            }
+        }
+
+        hash = hashBits(hash + itemHash);
+    }
+
+    return hash;
+}
+
+
+static FORCE_INLINE void doAddPtrBaseRefCntCandidate(RefCntCandidates *candidates, void *ptr, const Type *type)
+{
+    if (type->base->isGarbageCollected)
+    {
+        void *data = ptr;
+        if (type->base->kind == TYPE_PTR || type->base->kind == TYPE_STR || type->base->kind == TYPE_FIBER)
+            data = *(void **)data;
+
+        candidatePush(candidates, data, type->base);
     }
 }
 
@@ -1209,7 +2298,33 @@ static FORCE_INLINE void doAddStructFieldsRefCntCandidates(RefCntCandidates *can
             if (type->field[i]->type->kind == TYPE_PTR || type->field[i]->type->kind == TYPE_STR || type->field[i]->type->kind == TYPE_FIBER)
                 field = *(void **)field;
 
-            candidatePush(candidates, field, type->field[i]->type);
+            if (field)
+                candidatePush(candidates, field, type->field[i]->type);
+        }
+    }
+}
+
+
+static FORCE_INLINE void doAddArrayItemsRefCntCandidates(RefCntCandidates *candidates, void *ptr, const Type *type, int len)
+{
+    if (type->base->isGarbageCollected)
+    {
+        char *itemPtr = ptr;
+        const int itemSize = type->base->size;
+
+        for (int i = 0; i < len; i++)
+        {
+            void *item = itemPtr;
+            if (type->base->kind == TYPE_PTR || type->base->kind == TYPE_STR || type->base->kind == TYPE_FIBER)
+                item = *(void **)item;
+
+            // Structure items are expanded immediately to keep the candidate stack small for large arrays, e.g., map hash tables
+            if (type->base->kind == TYPE_STRUCT)
+                doAddStructFieldsRefCntCandidates(candidates, item, type->base);
+            else if (item)
+                candidatePush(candidates, item, type->base);
+
+            itemPtr += itemSize;
         }
     }
 }
@@ -1360,44 +2475,90 @@ static void doRefCntImpl(HeapPages *pages, void *ptr, const Type *type, TokenKin
                 break;
             }
 
-            case TYPE_CLOSURE:
-            {
-                doAddStructFieldsRefCntCandidates(candidates, ptr, type);
-                break;
-            }
+            case TYPE_CLOSURE:
+            {
+                doAddStructFieldsRefCntCandidates(candidates, ptr, type);
+                break;
+            }
+
+            case TYPE_FIBER:
+            {
+                fiberRefCnt(pages, ptr, tokKind);
+                break;
+            }
+
+            default: break;
+        }
+    }
+}
+
+
+static void doIncPtrsRefCnt(HeapPages *pages, char *ptrs, int64_t stride, int64_t len)
+{
+    // Increase ref counts for len pointers located stride bytes apart. Page ref counts are updated once per run of pointers to the same page
+    HeapPage *page = NULL;
+    int pageDelta = 0;
+
+    for (int64_t i = 0; i < len; i++)
+    {
+        void *ptr = *(void **)(ptrs + i * stride);
+        if (!ptr)
+            continue;
+
+        if (!page || ptr < (void *)page->data || ptr >= (void *)page->end)
+        {
+            if (page)
+                page->refCnt += pageDelta;
+
+            pageDelta = 0;
+            page = pageFind(pages, ptr);
+            if (!page)
+                continue;
+        }
+
+        HeapChunk *chunk = pageGetChunk(page, ptr);
 
-            case TYPE_FIBER:
-            {
-                HeapPage *page = pageFind(pages, ptr);
-                if (!page)
-                    break;
+        if (UNLIKELY(chunk->refCnt <= 0 || page->refCnt + pageDelta < chunk->refCnt))
+            pages->error->runtimeHandler(pages->error->context, ERR_RUNTIME, "Wrong reference count for pointer at %p", ptr);
 
-                if (tokKind == TOK_PLUSPLUS)
-                    chunkRefCnt(pages, page, ptr, 1);
-                else
-                {
-                    const HeapChunk *chunk = pageGetChunk(page, ptr);
-                    if (chunk->refCnt > 1)
-                    {
-                        chunkRefCnt(pages, page, ptr, -1);
-                        break;
-                    }
+        chunk->refCnt++;
+        pageDelta++;
 
-                    if (UNLIKELY(((Fiber *)ptr)->alive))
-                        pages->error->runtimeHandler(pages->error->context, ERR_RUNTIME, "Cannot destroy a busy fiber");
+        // Detect escaping refs
+        for (Fiber *fiber = pages->fiber; fiber; fiber = fiber->parent)
+            stackUpdateFrameRefCnt(fiber, pages, ptr, 1);
+    }
 
-                    // Only one ref is left. Defer processing the parent and traverse the children before removing the ref
-                    HeapPage *stackPage = pageFind(pages, ((Fiber *)ptr)->stack);
-                    if (UNLIKELY(!stackPage))
-                        pages->error->runtimeHandler(pages->error->context, ERR_RUNTIME, "No fiber stack");
+    if (page)
+        page->refCnt += pageDelta;
+}
 
-                    chunkRefCnt(pages, stackPage, ((Fiber *)ptr)->stack, -1);
-                    chunkRefCnt(pages, page, ptr, -1);
-                }
-                break;
-            }
 
-            default: break;
+static void doIncArrayItemsRefCnt(HeapPages *pages, void *data, const Type *itemType, int64_t len)
+{
+    // Bulk equivalent of doRefCntImpl() with TOK_PLUSPLUS for len array items
+    if (!itemType->isGarbageCollected)
+        return;
+
+    switch (itemType->kind)
+    {
+        case TYPE_PTR:
+        case TYPE_FIBER:    doIncPtrsRefCnt(pages, data, itemType->size, len); break;
+        case TYPE_STR:
+        {
+            for (int64_t i = 0; i < len; i++)
+                doCheckStr(((char **)data)[i], pages->error);
+
+            doIncPtrsRefCnt(pages, data, itemType->size, len);
+            break;
+        }
+        case TYPE_DYNARRAY: doIncPtrsRefCnt(pages, (char *)data + offsetof(DynArray, data), itemType->size, len); break;
+        case TYPE_MAP:      doIncPtrsRefCnt(pages, (char *)data + offsetof(Map, root), itemType->size, len); break;
+        default:
+        {
+            const Type staticArrayType = typeMakeDetachedArray(itemType, len);
+            doRefCntImpl(pages, data, &staticArrayType, TOK_PLUSPLUS);
+            break;
         }
     }
 }
@@ -1424,10 +2585,10 @@ static FORCE_INLINE char *doAllocStr(HeapPages *pages, int64_t len, Error *error
 
 static FORCE_INLINE char *doGetEmptyStr(void)
 {
-    StrDimensions dims = {.len = 0, .capacity = 1};
+    StrDimensions dims = {.hash = STR_HASH_READ_ONLY, .len = 0, .capacity = 1};
 
     static char dimsAndData[sizeof(StrDimensions) + 1];
-    *(DynArrayDimensions *)dimsAndData = dims;
+    *(StrDimensions *)dimsAndData = dims;
 
     char *data = dimsAndData + sizeof(StrDimensions);
     data[0] = 0;
@@ -1468,176 +2629,231 @@ static FORCE_INLINE void doGetEmptyDynArray(DynArray *array, const Type *type)
 }
 
 
+static FORCE_INLINE void doAllocMapEntries(HeapPages *pages, DynArray *entries, const Type *type, int64_t len, Error *error)
+{
+    // Hash tables are never resized in place, so no extra capacity is needed
+    entries->type     = type;
+    entries->itemSize = entries->type->base->size;
+
+    DynArrayDimensions dims = {.len = len, .capacity = len};
+
+    char *dimsAndData = chunkAlloc(pages, sizeof(DynArrayDimensions) + dims.capacity * entries->itemSize, entries->type, NULL, false, error);
+    *(DynArrayDimensions *)dimsAndData = dims;
+
+    entries->data = dimsAndData + sizeof(DynArrayDimensions);
+}
+
+
+static FORCE_INLINE MapEntry *doGetMapEntryAt(const DynArray *entries, int64_t index)
+{
+    return (MapEntry *)((char *)entries->data + index * entries->itemSize);
+}
+
+
 static FORCE_INLINE void doAllocMap(HeapPages *pages, Map *map, const Type *type, Error *error)
 {
+    const Type *nodeType = typeMapNodePtr(type)->base;
+
     map->type      = type;
-    map->root      = chunkAlloc(pages, type->base->size, type->base, NULL, false, error);
+    map->root      = chunkAlloc(pages, nodeType->size, nodeType, NULL, false, error);
     map->root->len = 0;
+
+    doAllocMapEntries(pages, &map->root->entries, typeMapEntries(type), MEM_MIN_MAP_ENTRIES, error);
 }
 
 
-static FORCE_INLINE void doRebalanceMapNodes(MapNode **parent, MapNode *child)
+static void doGrowMap(Map *map, HeapPages *pages, Error *error)
 {
-    // Rotate tree to swap parent and child nodes
-    if (child == (*parent)->right)
-    {
-        (*parent)->right = child->left;
-        child->left = (*parent);
-    }
-    else if (child == (*parent)->left)
+    const DynArray oldEntries = map->root->entries;
+    const int64_t numOldEntries = getDims(&oldEntries)->len;
+
+    doAllocMapEntries(pages, &map->root->entries, oldEntries.type, 2 * numOldEntries, error);
+
+    const uint64_t mask = 2 * numOldEntries - 1;
+
+    for (int64_t i = 0; i < numOldEntries; i++)
     {
-        (*parent)->left = child->right;
-        child->right = (*parent);      
+        const MapEntry *oldEntry = doGetMapEntryAt(&oldEntries, i);
+        if (!oldEntry->data)
+            continue;
+
+        uint64_t j = oldEntry->hash & mask;
+        while (doGetMapEntryAt(&map->root->entries, j)->data)
+            j = (j + 1) & mask;
+
+        memcpy(doGetMapEntryAt(&map->root->entries, j), oldEntry, oldEntries.itemSize);
     }
-    else
-        return;
 
-    (*parent) = child;
+    // Keys and items have been moved rather than copied, so only the old hash table chunk itself is released
+    HeapPage *page = pageFind(pages, oldEntries.data);
+    if (UNLIKELY(!page))
+        error->runtimeHandler(error->context, ERR_RUNTIME, "Map entries are not in the heap");
+
+    chunkRefCnt(pages, page, oldEntries.data, -1);
 }
 
 
-static FORCE_INLINE MapNode **doGetMapNode(Map *map, Slot key, bool createMissingNodes, HeapPages *pages, Error *error)
+static FORCE_INLINE MapEntry *doGetMapEntry(Map *map, Slot key, bool createMissingEntries, HeapPages *pages, Error *error)
 {
     if (UNLIKELY(!map || !map->root))
         error->runtimeHandler(error->context, ERR_RUNTIME, "Map is null");
 
-    MapNode **node = &map->root;
+    const Type *keyType = typeMapKey(map->type);
+
+    // Keys are hashed and compared as stored in the map entries
+    const void *keyPtr = key.ptrVal;
 
-    while (*node)
+    Slot keyBuf = {0};
+    if (!typeStructured(keyType))
     {
-        int64_t keyDiff = 1;
-        if ((*node)->key)
-        {
-            // Get key difference
-            Slot nodeKey = {.ptrVal = (*node)->key};
-            doDerefImpl(&nodeKey, typeMapKey(map->type)->kind, error);
-            keyDiff = doCompare(key, nodeKey, typeMapKey(map->type), error);
-        }
+        doAssignImpl(&keyBuf, key, keyType->kind, keyType->size, error);
+        keyPtr = &keyBuf;
+    }
 
-        MapNode **child = NULL;
+    const uint64_t hash = doHashByPlan(keyPtr, keyType->comparePlan, error);
 
-        if (keyDiff > 0)
-            child = &(*node)->right;
-        else if (keyDiff < 0)
-            child = &(*node)->left;
-        else
-            return node;
+    // Keep the load factor below 3/4
+    if (createMissingEntries && 4 * (map->root->len + 1) > 3 * getDims(&map->root->entries)->len)
+        doGrowMap(map, pages, error);
 
-        // Rebalance as a randomized binary search tree (treap)
-        if ((*node)->priority > 0 && (*child) && (*child)->priority > (*node)->priority)
-            doRebalanceMapNodes(node, *child);
-        else
-            node = child;
-    }
+    const uint64_t mask = getDims(&map->root->entries)->len - 1;
 
-    if (createMissingNodes)
+    for (uint64_t i = hash & mask; ; i = (i + 1) & mask)
     {
-        const Type *nodeType = map->type->base;
-        *node = chunkAlloc(pages, nodeType->size, nodeType, NULL, false, error);
-    }
+        MapEntry *entry = doGetMapEntryAt(&map->root->entries, i);
+
+        if (!entry->data)
+        {
+            if (!createMissingEntries)
+                return NULL;
 
-    return node;
+            const Type *itemType = typeMapItem(map->type);
+
+            // When allocating dynamic arrays, we mark with type the data chunk, not the header chunk
+            entry->hash = hash;
+            entry->data = chunkAlloc(pages, itemType->size, itemType->kind == TYPE_DYNARRAY ? NULL : itemType, NULL, false, error);
+
+            // Increase key ref count
+            if (keyType->isGarbageCollected)
+                doRefCntImpl(pages, key.ptrVal, keyType, TOK_PLUSPLUS);
+
+            doAssignImpl(entry->key, key, keyType->kind, keyType->size, error);
+            map->root->len++;
+            return entry;
+        }
+
+        // Compare cached hashes first to avoid comparing most keys
+        if (entry->hash == hash && doEqualByPlan(keyPtr, entry->key, keyType->comparePlan, error))
+            return entry;
+    }
 }
 
 
-static MapNode *doCopyMapNode(Map *map, MapNode *node, Fiber *fiber, HeapPages *pages, Error *error)
+static void doCopyMap(Map *result, const Map *map, HeapPages *pages, Error *error)
 {
-    if (!node)
-        return NULL;
+    const Type *nodeType = typeMapNodePtr(map->type)->base;
+    const Type *keyType = typeMapKey(map->type);
+    const Type *itemType = typeMapItem(map->type);
+
+    const DynArray *entries = &map->root->entries;
+    const int64_t numEntries = getDims(entries)->len;
 
-    const Type *nodeType = map->type->base;
-    MapNode *result = (MapNode *)chunkAlloc(pages, nodeType->size, nodeType, NULL, false, error);
+    result->type      = map->type;
+    result->root      = chunkAlloc(pages, nodeType->size, nodeType, NULL, false, error);
+    result->root->len = map->root->len;
 
-    result->len = node->len;
-    result->priority = node->priority;
+    // Keep the same hash table layout
+    doAllocMapEntries(pages, &result->root->entries, entries->type, numEntries, error);
 
-    if (node->key)
+    for (int64_t i = 0; i < numEntries; i++)
     {
-        const Type *keyType = typeMapKey(map->type);
+        const MapEntry *entry = doGetMapEntryAt(entries, i);
+        if (!entry->data)
+            continue;
 
-        Slot srcKey = {.ptrVal = node->key};
-        doDerefImpl(&srcKey, keyType->kind, error);
+        MapEntry *resultEntry = doGetMapEntryAt(&result->root->entries, i);
+        resultEntry->hash = entry->hash;
 
-        // When allocating dynamic arrays, we mark with type the data chunk, not the header chunk
-        result->key = chunkAlloc(pages, keyType->size, keyType->kind == TYPE_DYNARRAY ? NULL : keyType, NULL, false, error);
+        Slot srcKey = {.ptrVal = (void *)entry->key};
+        doDerefImpl(&srcKey, keyType->kind, error);
 
         if (keyType->isGarbageCollected)
             doRefCntImpl(pages, srcKey.ptrVal, keyType, TOK_PLUSPLUS);
 
-        doAssignImpl(result->key, srcKey, keyType->kind, keyType->size, error);
-    }
-
-    if (node->data)
-    {
-        const Type *itemType = typeMapItem(map->type);
+        doAssignImpl(resultEntry->key, srcKey, keyType->kind, keyType->size, error);
 
-        Slot srcItem = {.ptrVal = node->data};
+        Slot srcItem = {.ptrVal = entry->data};
         doDerefImpl(&srcItem, itemType->kind, error);
 
         // When allocating dynamic arrays, we mark with type the data chunk, not the header chunk
-        result->data = chunkAlloc(pages, itemType->size, itemType->kind == TYPE_DYNARRAY ? NULL : itemType, NULL, false, error);
+        resultEntry->data = chunkAlloc(pages, itemType->size, itemType->kind == TYPE_DYNARRAY ? NULL : itemType, NULL, false, error);
 
         if (itemType->isGarbageCollected)
             doRefCntImpl(pages, srcItem.ptrVal, itemType, TOK_PLUSPLUS);
 
-        doAssignImpl(result->data, srcItem, itemType->kind, itemType->size, error);
+        doAssignImpl(resultEntry->data, srcItem, itemType->kind, itemType->size, error);
     }
-
-    if (node->left)
-        result->left = doCopyMapNode(map, node->left, fiber, pages, error);
-
-    if (node->right)
-        result->right = doCopyMapNode(map, node->right, fiber, pages, error);
-
-    return result;
 }
 
 
-static void doGetMapKeysRecursively(const Map *map, const MapNode *node, void *keys, int *numKeys, Error *error)
+static FORCE_INLINE void doGetMapKeys(const Map *map, void *keys, void *temp, Storage *storage, Error *error)
 {
-    if (node->left)
-        doGetMapKeysRecursively(map, node->left, keys, numKeys, error);
+    const Type *keyType = typeMapKey(map->type);
+
+    const int64_t numEntries = getDims(&map->root->entries)->len;
 
-    if (node->key)
+    int64_t numKeys = 0;
+    for (int64_t i = 0; i < numEntries; i++)
     {
-        const Type *keyType = typeMapKey(map->type);
-        void *destKey = (char *)keys + keyType->size * (*numKeys);
+        const MapEntry *entry = doGetMapEntryAt(&map->root->entries, i);
+        if (!entry->data)
+            continue;
 
-        Slot srcKey = {.ptrVal = node->key};
+        void *destKey = (char *)keys + keyType->size * numKeys;
+
+        Slot srcKey = {.ptrVal = (void *)entry->key};
         doDerefImpl(&srcKey, keyType->kind, error);
         doAssignImpl(destKey, srcKey, keyType->kind, keyType->size, error);
 
-        (*numKeys)++;
+        numKeys++;
     }
 
-    if (node->right)
-        doGetMapKeysRecursively(map, node->right, keys, numKeys, error);
-}
-
-
-static FORCE_INLINE void doGetMapKeys(const Map *map, void *keys, Error *error)
-{
-    int numKeys = 0;
-    doGetMapKeysRecursively(map, map->root, keys, &numKeys, error);
     if (UNLIKELY(numKeys != map->root->len))
         error->runtimeHandler(error->context, ERR_RUNTIME, "Wrong number of map keys");
+
+    // The hash table order is arbitrary, while keys are expected in ascending order
+    doSortFast(keys, numKeys, keyType, 0, true, keyType->size, temp, storage, error);
 }
 
 
-static FORCE_INLINE Fiber *doAllocFiber(Fiber *parent, const Closure *childClosure, const Type *childClosureType, HeapPages *pages, Error *error)
+static FORCE_INLINE Fiber *doAllocFiber(Fiber *parent, const Closure *childClosure, const Type *childClosureType, int64_t stackSize, HeapPages *pages, Error *error)
 {
     if (UNLIKELY(!childClosure || childClosure->entryOffset <= 0))
         error->runtimeHandler(error->context, ERR_RUNTIME, "Called function is not defined");
 
-    // Copy whole fiber context
-    Fiber *child = chunkAlloc(pages, sizeof(Fiber), NULL, NULL, false, error);
+    if (stackSize <= 0)
+        stackSize = MEM_MIN_FIBER_STACK;
+    else if (stackSize < MEM_MIN_FREE_STACK)
+        stackSize = MEM_MIN_FREE_STACK;
+
+    if (UNLIKELY(stackSize > INT_MAX / sizeof(Slot)))
+        error->runtimeHandler(error->context, ERR_RUNTIME, "Illegal stack size");
 
-    *child = *parent;
-    child->stack = chunkAlloc(pages, child->stackSize * sizeof(Slot), NULL, NULL, true, error);
-    child->top = child->base = child->stack + child->stackSize - 1;
+    Fiber *child = chunkAlloc(pages, sizeof(Fiber), NULL, NULL, false, error);
 
+    child->code = parent->code;
+    child->debugPerInstr = parent->debugPerInstr;
+    child->vm = parent->vm;
+    child->alive = true;
+    child->fileSystemEnabled = parent->fileSystemEnabled;
     child->parent = parent;
 
+    // The stack grows on demand up to the main fiber stack size
+    child->stack = chunkAlloc(pages, stackSize * sizeof(Slot), NULL, NULL, true, error);
+    child->stackSize = child->totalStackSize = stackSize;
+    child->maxStackSize = (stackSize > parent->vm->mainFiber->maxStackSize) ? stackSize : parent->vm->mainFiber->maxStackSize;
+    child->top = child->base = child->stackBottom = child->stack + stackSize - 1;
+
     const Signature *childClosureSig = childClosureType->field[0]->type->sig;
 
     // Push upvalues
@@ -1655,6 +2871,250 @@ static FORCE_INLINE Fiber *doAllocFiber(Fiber *parent, const Closure *childClosu
 }
 
 
+// Fiber scheduler
+
+static FORCE_INLINE double schedGetTime(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+#endif
+}
+
+
+static FORCE_INLINE void schedEnqueue(Scheduler *sched, Fiber *fiber)
+{
+    fiber->nextScheduled = NULL;
+
+    if (sched->last)
+        sched->last->nextScheduled = fiber;
+    else
+        sched->first = fiber;
+
+    sched->last = fiber;
+}
+
+
+static FORCE_INLINE Fiber *schedDequeue(Scheduler *sched)
+{
+    Fiber *fiber = sched->first;
+
+    sched->first = fiber->nextScheduled;
+    if (!sched->first)
+        sched->last = NULL;
+
+    fiber->nextScheduled = NULL;
+    return fiber;
+}
+
+
+static FORCE_INLINE bool schedTimerEarlier(const SchedTimer *timer, const SchedTimer *other)
+{
+    return timer->time < other->time || (timer->time == other->time && timer->order < other->order);
+}
+
+
+static void schedAddTimer(Scheduler *sched, Fiber *fiber, double time, Storage *storage)
+{
+    if (sched->numTimers == sched->capacity)
+    {
+        sched->capacity = (sched->capacity > 0) ? 2 * sched->capacity : 16;
+        if (sched->timers)
+            sched->timers = storageRealloc(storage, sched->timers, sched->capacity * sizeof(SchedTimer));
+        else
+            sched->timers = storageAdd(storage, sched->capacity * sizeof(SchedTimer));
+    }
+
+    const SchedTimer timer = {time, sched->order++, fiber};
+
+    // Sift up
+    int64_t i = sched->numTimers++;
+    while (i > 0)
+    {
+        const int64_t parent = (i - 1) / 2;
+        if (!schedTimerEarlier(&timer, &sched->timers[parent]))
+            break;
+
+        sched->timers[i] = sched->timers[parent];
+        i = parent;
+    }
+
+    sched->timers[i] = timer;
+}
+
+
+static Fiber *schedRemoveTimer(Scheduler *sched)
+{
+    Fiber *fiber = sched->timers[0].fiber;
+    const SchedTimer last = sched->timers[--sched->numTimers];
+
+    // Sift down
+    int64_t i = 0;
+    while (2 * i + 1 < sched->numTimers)
+    {
+        int64_t child = 2 * i + 1;
+        if (child + 1 < sched->numTimers && schedTimerEarlier(&sched->timers[child + 1], &sched->timers[child]))
+            child++;
+
+        if (!schedTimerEarlier(&sched->timers[child], &last))
+            break;
+
+        sched->timers[i] = sched->timers[child];
+        i = child;
+    }
+
+    sched->timers[i] = last;
+    return fiber;
+}
+
+
+static void schedAddIOWait(Scheduler *sched, Fiber *fiber, int fd, bool writing, Storage *storage)
+{
+    if (sched->numIOWaits == sched->ioCapacity)
+    {
+        sched->ioCapacity = (sched->ioCapacity > 0) ? 2 * sched->ioCapacity : 16;
+        if (sched->ioWaits)
+            sched->ioWaits = storageRealloc(storage, sched->ioWaits, sched->ioCapacity * sizeof(SchedIOWait));
+        else
+            sched->ioWaits = storageAdd(storage, sched->ioCapacity * sizeof(SchedIOWait));
+
+#ifndef _WIN32
+        if (sched->pollFds)
+            storageRemove(storage, sched->pollFds);
+        sched->pollFds = storageAdd(storage, sched->ioCapacity * sizeof(struct pollfd));
+#endif
+    }
+
+    sched->ioWaits[sched->numIOWaits++] = (SchedIOWait){.fd = fd, .writing = writing, .fiber = fiber};
+}
+
+
+static void schedWait(Scheduler *sched, double timeout)
+{
+    // Wait until the timeout expires or any of the file descriptors gets ready. A negative timeout means no timeout
+    sched->numSwitchesSincePoll = 0;
+
+#ifdef _WIN32
+    if (timeout > 0)
+        Sleep((DWORD)ceil(timeout * 1000));
+#else
+    if (sched->numIOWaits == 0)
+    {
+        if (timeout > 0)
+        {
+            struct timespec t;
+            t.tv_sec = (time_t)timeout;
+            t.tv_nsec = (long)((timeout - t.tv_sec) * 1e9);
+            nanosleep(&t, NULL);
+        }
+        return;
+    }
+
+    struct pollfd *pollFds = sched->pollFds;
+    for (int64_t i = 0; i < sched->numIOWaits; i++)
+    {
+        pollFds[i].fd = sched->ioWaits[i].fd;
+        pollFds[i].events = sched->ioWaits[i].writing ? POLLOUT : POLLIN;
+        pollFds[i].revents = 0;
+    }
+
+    int timeoutMs = -1;
+    if (timeout >= 0)
+        timeoutMs = (timeout < INT_MAX / 1000) ? (int)ceil(timeout * 1000) : INT_MAX;
+
+    if (poll(pollFds, sched->numIOWaits, timeoutMs) <= 0)
+        return;
+
+    // Move the fibers whose file descriptors are ready, or have been closed or failed, to the run queue
+    int64_t numIOWaits = 0;
+    for (int64_t i = 0; i < sched->numIOWaits; i++)
+    {
+        if (pollFds[i].revents)
+            schedEnqueue(sched, sched->ioWaits[i].fiber);
+        else
+            sched->ioWaits[numIOWaits++] = sched->ioWaits[i];
+    }
+
+    sched->numIOWaits = numIOWaits;
+#endif
+}
+
+
+static Fiber *schedNext(Scheduler *sched)
+{
+    while (1)
+    {
+        // Move the fibers whose timers have expired to the run queue
+        double time = 0;
+        if (sched->numTimers > 0)
+        {
+            time = schedGetTime();
+            while (sched->numTimers > 0 && sched->timers[0].time <= time)
+                schedEnqueue(sched, schedRemoveTimer(sched));
+        }
+
+        if (sched->first)
+        {
+            // Check the file descriptors once in a while, so that busy fibers do not stall the fibers waiting for I/O
+            if (sched->numIOWaits > 0 && ++sched->numSwitchesSincePoll >= SCHED_IO_POLL_INTERVAL)
+                schedWait(sched, 0);
+
+            return schedDequeue(sched);
+        }
+
+        if (sched->numTimers == 0 && sched->numIOWaits == 0)
+            return NULL;
+
+        // Nothing to run until the earliest timer expires or any of the file descriptors gets ready
+        schedWait(sched, (sched->numTimers > 0) ? sched->timers[0].time - time : -1);
+    }
+}
+
+
+static FORCE_INLINE void schedSwitch(VM *vm, Fiber *fiber)
+{
+    vm->fiber = vm->pages.fiber = fiber;
+}
+
+
+static Fiber *schedFinish(VM *vm, Fiber *fiber, Error *error)
+{
+    // Wake up the joiners
+    while (fiber->firstJoiner)
+    {
+        Fiber *joiner = fiber->firstJoiner;
+        fiber->firstJoiner = joiner->nextScheduled;
+        joiner->joining = false;
+        schedEnqueue(&vm->sched, joiner);
+    }
+
+    if (!fiber->spawned)
+        return fiber->parent;
+
+    // If no spawned fibers are left to run, go back to the parent fiber, as if the fiber has been resumed manually
+    Fiber *next = schedNext(&vm->sched);
+    if (!next)
+    {
+        next = fiber->parent;
+        if (UNLIKELY(next->joining))
+            error->runtimeHandler(error->context, ERR_RUNTIME, "All fibers are waiting");
+    }
+
+    // Release the scheduler's reference only when the fiber is no longer current
+    schedSwitch(vm, next);
+    fiberRefCnt(&vm->pages, fiber, TOK_MINUSMINUS);
+    vm->sched.numSpawned--;
+
+    return next;
+}
+
+
 static FORCE_INLINE int doPrintIndented(char *buf, int maxLen, int depth, bool pretty, char ch)
 {
     enum {INDENT_WIDTH = 4};
@@ -1818,8 +3278,9 @@ static int doFillReprBuf(const Slot *slot, const Type *type, char *buf, int maxL
                 const Type *itemType = typeMapItem(map->type);
 
                 void *keys = storageAdd(storage, map->root->len * keyType->size);
+                void *temp = storageAdd(storage, keyType->size);
 
-                doGetMapKeys(map, keys, error);
+                doGetMapKeys(map, keys, temp, storage, error);
 
                 char *keyPtr = (char *)keys;
                 for (int i = 0; i < map->root->len; i++)
@@ -1830,11 +3291,11 @@ static int doFillReprBuf(const Slot *slot, const Type *type, char *buf, int maxL
 
                     len += snprintf(nonnull(buf, len), maxLen, ": ");
 
-                    const MapNode *node = *doGetMapNode(map, keySlot, false, NULL, error);
-                    if (UNLIKELY(!node))
-                        error->runtimeHandler(error->context, ERR_RUNTIME, "Map node is null");
+                    const MapEntry *entry = doGetMapEntry(map, keySlot, false, NULL, error);
+                    if (UNLIKELY(!entry))
+                        error->runtimeHandler(error->context, ERR_RUNTIME, "Map entry is null");
 
-                    Slot itemSlot = {.ptrVal = node->data};
+                    Slot itemSlot = {.ptrVal = entry->data};
                     doDerefImpl(&itemSlot, itemType->kind, error);
                     len += doFillReprBuf(&itemSlot, itemType, nonnull(buf, len), maxLen, depth + 1, pretty, dereferenced, storage, error);
 
@@ -1844,6 +3305,7 @@ static int doFillReprBuf(const Slot *slot, const Type *type, char *buf, int maxL
                     keyPtr += keyType->size;
                 }
 
+                storageRemove(storage, temp);
                 storageRemove(storage, keys);
             }
 
@@ -1941,6 +3403,22 @@ static FORCE_INLINE int doPrintSlot(FILE *file, char *string, int maxLen, const
 }
 
 
+static FORCE_INLINE void doCheckPrintfOverflow(TypeKind expectedTypeKind, const Type *type, Slot value, Error *error)
+{
+    if (expectedTypeKind == TYPE_VOID)
+        return;
+
+    Const arg;
+    if (typeKindReal(expectedTypeKind))
+        arg.realVal = value.realVal;
+    else
+        arg.intVal = value.intVal;
+
+    if (UNLIKELY(typeConvOverflow(expectedTypeKind, type->kind, arg)))
+        error->runtimeHandler(error->context, ERR_RUNTIME, "Overflow of %s", typeKindSpelling(expectedTypeKind));
+}
+
+
 enum
 {
     STACK_OFFSET_COUNT  = 3,
@@ -1950,6 +3428,62 @@ enum
 };
 
 
+static FORCE_INLINE char *doPrintfFillRepr(Slot *value, const Type *type, FormatStringTypeSize formatStringTypeSize, char *buf, int bufSize, Storage *storage, Error *error)
+{
+    // %v formatter - convert argument of any type to its string representation. Returns the buffer actually used, which is allocated in storage if buf is too small
+    const bool pretty = formatStringTypeSize == FORMAT_SIZE_LONG_LONG;
+    const bool dereferenced = formatStringTypeSize == FORMAT_SIZE_LONG || formatStringTypeSize == FORMAT_SIZE_LONG_LONG;
+
+    const int reprLen = doFillReprBuf(value, type, NULL, 0, 0, pretty, dereferenced, storage, error);  // Predict buffer length
+
+    char *dimsAndRepr = buf;
+    if ((int)sizeof(StrDimensions) + reprLen + 1 > bufSize)
+        dimsAndRepr = storageAdd(storage, sizeof(StrDimensions) + reprLen + 1);
+
+    StrDimensions dims = {.len = reprLen, .capacity = reprLen + 1};
+    *(StrDimensions *)dimsAndRepr = dims;
+
+    char *repr = dimsAndRepr + sizeof(StrDimensions);
+    repr[reprLen] = 0;
+
+    doFillReprBuf(value, type, repr, reprLen + 1, 0, pretty, dereferenced, storage, error);            // Fill buffer
+
+    value->ptrVal = repr;
+    return dimsAndRepr;
+}
+
+
+static FORCE_INLINE int doPrintfSlot(HeapPages *pages, FILE *file, char **string, int prevLen, const char *format, Slot value, TypeKind typeKind, Error *error)
+{
+    if (!*string)
+        return doPrintSlot(file, NULL, INT_MAX, format, value, typeKind, error);
+
+    // Predict buffer length for sprintf() and reallocate it if needed
+    const int len = doPrintSlot(NULL, *string, 0, format, value, typeKind, error);
+
+    const bool inPlace = getStrDims(*string)->capacity >= prevLen + len + 1;
+    if (inPlace)
+    {
+        getStrDims(*string)->len = prevLen + len;
+        doResetStrHash(*string);
+    }
+    else
+    {
+        char *newString = doAllocStr(pages, prevLen + len, error);
+        memcpy(newString, *string, prevLen);
+        newString[prevLen] = 0;
+
+        // Decrease old string ref count
+        const Type strType = {.kind = TYPE_STR};
+        doRefCntImpl(pages, *string, &strType, TOK_MINUSMINUS);
+
+        *string = newString;
+    }
+
+    return doPrintSlot(NULL, *string + prevLen, len + 1, format, value, typeKind, error);
+}
+
+
 static FORCE_INLINE void doBuiltinPrintf(Fiber *fiber, HeapPages *pages, bool isConsole, bool isString, Error *error)
 {
     FILE *file = NULL;
@@ -1998,18 +3532,7 @@ static FORCE_INLINE void doBuiltinPrintf(Fiber *fiber, HeapPages *pages, bool is
         error->runtimeHandler(error->context, ERR_RUNTIME, "Incompatible types %s and %s in printf", typeKindSpelling(expectedTypeKind), typeSpelling(type, typeBuf));
     }
 
-    // Check overflow
-    if (expectedTypeKind != TYPE_VOID)
-    {
-        Const arg;
-        if (typeKindReal(expectedTypeKind))
-            arg.realVal = value.realVal;
-        else
-            arg.intVal = value.intVal;
-
-        if (UNLIKELY(typeConvOverflow(expectedTypeKind, type->kind, arg)))
-            error->runtimeHandler(error->context, ERR_RUNTIME, "Overflow of %s", typeKindSpelling(expectedTypeKind));
-    }
+    doCheckPrintfOverflow(expectedTypeKind, type, value, error);
 
     char curFormatBuf[DEFAULT_STR_LEN + 1];
     char *curFormat = curFormatBuf;
@@ -2025,8 +3548,6 @@ static FORCE_INLINE void doBuiltinPrintf(Fiber *fiber, HeapPages *pages, bool is
     char reprBuf[sizeof(StrDimensions) + DEFAULT_STR_LEN + 1];
     char *dimsAndRepr = reprBuf;
 
-    bool isReprBufInHeap = false;
-
     const bool hasAnyTypeFormatter = expectedTypeKind == TYPE_INTERFACE && typeLetterPos >= 0 && typeLetterPos < formatLen;     // %v
     if (hasAnyTypeFormatter)
     {
@@ -2042,70 +3563,93 @@ static FORCE_INLINE void doBuiltinPrintf(Fiber *fiber, HeapPages *pages, bool is
         if ((formatStringTypeSize == FORMAT_SIZE_LONG_LONG || formatStringTypeSize == FORMAT_SIZE_SHORT_SHORT) && typeLetterPos - 2 >= 0)
             curFormat[typeLetterPos - 2] = ' ';
 
-        const bool pretty = formatStringTypeSize == FORMAT_SIZE_LONG_LONG;
-        const bool dereferenced = formatStringTypeSize == FORMAT_SIZE_LONG || formatStringTypeSize == FORMAT_SIZE_LONG_LONG;
+        dimsAndRepr = doPrintfFillRepr(&value, type, formatStringTypeSize, reprBuf, sizeof(reprBuf), fiber->vm->storage, error);
+        typeKind = TYPE_STR;
+    }
+
+    const int len = doPrintfSlot(pages, file, &string, prevLen, curFormat, value, typeKind, error);
+
+    fiber->top[STACK_OFFSET_FORMAT].ptrVal = (char *)fiber->top[STACK_OFFSET_FORMAT].ptrVal + formatLen;
+    fiber->top[STACK_OFFSET_COUNT].intVal += len;
+    if (isString)
+        fiber->top[STACK_OFFSET_STREAM].ptrVal = string;
 
-        const int reprLen = doFillReprBuf(&value, type, NULL, 0, 0, pretty, dereferenced, fiber->vm->storage, error);  // Predict buffer length
+    fiber->top++;   // Remove value
 
-        isReprBufInHeap = sizeof(StrDimensions) + reprLen + 1 > sizeof(reprBuf);
-        if (isReprBufInHeap)
-            dimsAndRepr = storageAdd(fiber->vm->storage, sizeof(StrDimensions) + reprLen + 1);
+    if (isCurFormatBufInHeap)
+        storageRemove(fiber->vm->storage, curFormat);
 
-        StrDimensions dims = {.len = reprLen, .capacity = reprLen + 1};
-        *(StrDimensions *)dimsAndRepr = dims;
+    if (dimsAndRepr != reprBuf)
+        storageRemove(fiber->vm->storage, dimsAndRepr);
+}
 
-        char *repr = dimsAndRepr + sizeof(StrDimensions);
-        repr[reprLen] = 0;
 
-        doFillReprBuf(&value, type, repr, reprLen + 1, 0, pretty, dereferenced, fiber->vm->storage, error);            // Fill buffer
+enum
+{
+    STACK_OFFSET_SEGMENT_COUNT  = 2,
+    STACK_OFFSET_SEGMENT_STREAM = 1,
+    STACK_OFFSET_SEGMENT_VALUE  = 0
+};
 
-        value.ptrVal = repr;
-        typeKind = TYPE_STR;
-    }
 
-    // Predict buffer length for sprintf() and reallocate it if needed
-    int len = 0;
-    if (string)
+static void doCallPrintf(Fiber *fiber, HeapPages *pages, Error *error)
+{
+    // Format string literal part with at most one value, already split and checked by the compiler. Parameters: count, stream, value
+    const FormatSegment *segment = fiber->code[fiber->ip].operand.ptrVal;
+
+    FILE *file = NULL;
+    char *string = NULL;
+    if (segment->builtin == BUILTIN_SPRINTF)
+    {
+        string = fiber->top[STACK_OFFSET_SEGMENT_STREAM].ptrVal;
+        if (!string)
+            string = doGetEmptyStr();
+    }
+    else if (segment->builtin == BUILTIN_PRINTF)
     {
-        len = doPrintSlot(NULL, string, 0, curFormat, value, typeKind, error);
+        file = stdout;
+    }
+    else if (fiber->fileSystemEnabled)
+    {
+        const File *umkaFile = fiber->top[STACK_OFFSET_SEGMENT_STREAM].ptrVal;
+        if (umkaFile)
+            file = umkaFile->stream;
+    }
 
-        const bool inPlace = getStrDims(string)->capacity >= prevLen + len + 1;
-        if (inPlace)
-        {
-            getStrDims(string)->len = prevLen + len;
-        }
-        else
-        {
-            char *newString = doAllocStr(pages, prevLen + len, error);
-            memcpy(newString, string, prevLen);
-            newString[prevLen] = 0;
+    if (UNLIKELY(!string && !file))
+        error->runtimeHandler(error->context, ERR_RUNTIME, "printf destination is null");
 
-            // Decrease old string ref count
-            const Type strType = {.kind = TYPE_STR};
-            doRefCntImpl(pages, string, &strType, TOK_MINUSMINUS);
+    const int prevLen = fiber->top[STACK_OFFSET_SEGMENT_COUNT].intVal;
 
-            string = newString;
-        }
+    Slot value = fiber->top[STACK_OFFSET_SEGMENT_VALUE];
+    TypeKind typeKind = segment->type ? segment->type->kind : TYPE_VOID;
 
-        len = doPrintSlot(NULL, string + prevLen, len + 1, curFormat, value, typeKind, error);
-    }
-    else
+    char reprBuf[sizeof(StrDimensions) + DEFAULT_STR_LEN + 1];
+    char *dimsAndRepr = reprBuf;
+
+    if (segment->type)
     {
-        len = doPrintSlot(file, NULL, INT_MAX, curFormat, value, typeKind, error);
+        doCheckPrintfOverflow(segment->expectedTypeKind, segment->type, value, error);
+
+        if (segment->expectedTypeKind == TYPE_INTERFACE)
+        {
+            dimsAndRepr = doPrintfFillRepr(&value, segment->type, segment->size, reprBuf, sizeof(reprBuf), fiber->vm->storage, error);
+            typeKind = TYPE_STR;
+        }
     }
 
-    fiber->top[STACK_OFFSET_FORMAT].ptrVal = (char *)fiber->top[STACK_OFFSET_FORMAT].ptrVal + formatLen;
-    fiber->top[STACK_OFFSET_COUNT].intVal += len;
-    if (isString)
-        fiber->top[STACK_OFFSET_STREAM].ptrVal = string;
+    const int len = doPrintfSlot(pages, file, &string, prevLen, segment->format, value, typeKind, error);
 
-    fiber->top++;   // Remove value
+    fiber->top[STACK_OFFSET_SEGMENT_COUNT].intVal += len;
+    if (segment->builtin == BUILTIN_SPRINTF)
+        fiber->top[STACK_OFFSET_SEGMENT_STREAM].ptrVal = string;
 
-    if (isCurFormatBufInHeap)
-        storageRemove(fiber->vm->storage, curFormat);
+    fiber->top++;   // Remove value
 
-    if (isReprBufInHeap)
+    if (dimsAndRepr != reprBuf)
         storageRemove(fiber->vm->storage, dimsAndRepr);
+
+    fiber->ip++;
 }
 
 
@@ -2242,9 +3786,10 @@ static FORCE_INLINE void doBuiltinMake(Fiber *fiber, HeapPages *pages, Error *er
     }
     else if (type->kind == TYPE_FIBER)
     {
+        const int64_t stackSize = (fiber->top++)->intVal;
         const Closure *childClosure = (fiber->top++)->ptrVal;
 
-        Fiber *result = doAllocFiber(fiber, childClosure, type->base, pages, error);
+        Fiber *result = doAllocFiber(fiber, childClosure, type->base, stackSize, pages, error);
         (--fiber->top)->ptrVal = result;
     }
     else
@@ -2265,8 +3810,7 @@ static FORCE_INLINE void doBuiltinMakeFromArr(Fiber *fiber, HeapPages *pages, Er
     memcpy(dest->data, src, getDims(dest)->len * dest->itemSize);
 
     // Increase result items' ref counts, as if they have been assigned one by one
-    const Type staticArrayType = typeMakeDetachedArray(dest->type->base, getDims(dest)->len);
-    doRefCntImpl(pages, dest->data, &staticArrayType, TOK_PLUSPLUS);
+    doIncArrayItemsRefCnt(pages, dest->data, dest->type->base, getDims(dest)->len);
 
     (--fiber->top)->ptrVal = dest;
 }
@@ -2393,8 +3937,7 @@ static FORCE_INLINE void doBuiltinCopyDynArray(Fiber *fiber, HeapPages *pages, E
         memmove((char *)result->data, (char *)array->data, getDims(array)->len * array->itemSize);
 
         // Increase result items' ref counts, as if they have been assigned one by one
-        const Type staticArrayType = typeMakeDetachedArray(result->type->base, getDims(result)->len);
-        doRefCntImpl(pages, result->data, &staticArrayType, TOK_PLUSPLUS);
+        doIncArrayItemsRefCnt(pages, result->data, result->type->base, getDims(result)->len);
     }
 
     (--fiber->top)->ptrVal = result;
@@ -2413,10 +3956,7 @@ static FORCE_INLINE void doBuiltinCopyMap(Fiber *fiber, HeapPages *pages, Error
     if (!map->root)
         *result = *map;
     else
-    {
-        result->type = map->type;
-        result->root = doCopyMapNode(map, map->root, fiber, pages, error);
-    }
+        doCopyMap(result, map, pages, error);
 
     (--fiber->top)->ptrVal = result;
 }
@@ -2478,8 +4018,7 @@ static FORCE_INLINE void doBuiltinAppend(Fiber *fiber, HeapPages *pages, Error *
         memmove((char *)result->data + getDims(array)->len * array->itemSize, (char *)rhs, rhsLen * array->itemSize);
 
         // Increase result items' ref counts, as if they have been assigned one by one
-        const Type staticArrayType = typeMakeDetachedArray(result->type->base, rhsLen);
-        doRefCntImpl(pages, (char *)result->data + getDims(array)->len * array->itemSize, &staticArrayType, TOK_PLUSPLUS);
+        doIncArrayItemsRefCnt(pages, (char *)result->data + getDims(array)->len * array->itemSize, result->type->base, rhsLen);
 
         getDims(result)->len = newLen;
     }
@@ -2491,8 +4030,7 @@ static FORCE_INLINE void doBuiltinAppend(Fiber *fiber, HeapPages *pages, Error *
         memmove((char *)result->data + getDims(array)->len * array->itemSize, (char *)rhs, rhsLen * array->itemSize);
 
         // Increase result items' ref counts, as if they have been assigned one by one
-        const Type staticArrayType = typeMakeDetachedArray(result->type->base, newLen);
-        doRefCntImpl(pages, result->data, &staticArrayType, TOK_PLUSPLUS);
+        doIncArrayItemsRefCnt(pages, result->data, result->type->base, newLen);
     }
 
     (--fiber->top)->ptrVal = result;
@@ -2527,8 +4065,7 @@ static FORCE_INLINE void doBuiltinInsert(Fiber *fiber, HeapPages *pages, Error *
         memmove((char *)result->data + index * result->itemSize, (char *)item, result->itemSize);
 
         // Increase result items' ref counts, as if they have been assigned one by one
-        const Type staticArrayType = typeMakeDetachedArray(result->type->base, 1);
-        doRefCntImpl(pages, (char *)result->data + index * result->itemSize, &staticArrayType, TOK_PLUSPLUS);
+        doIncArrayItemsRefCnt(pages, (char *)result->data + index * result->itemSize, result->type->base, 1);
 
         getDims(result)->len++;
     }
@@ -2541,8 +4078,7 @@ static FORCE_INLINE void doBuiltinInsert(Fiber *fiber, HeapPages *pages, Error *
         memmove((char *)result->data + index * result->itemSize, (char *)item, result->itemSize);
 
         // Increase result items' ref counts, as if they have been assigned one by one
-        const Type staticArrayType = typeMakeDetachedArray(result->type->base, getDims(result)->len);
-        doRefCntImpl(pages, result->data, &staticArrayType, TOK_PLUSPLUS);
+        doIncArrayItemsRefCnt(pages, result->data, result->type->base, getDims(result)->len);
     }
 
     (--fiber->top)->ptrVal = result;
@@ -2587,39 +4123,34 @@ static FORCE_INLINE void doBuiltinDeleteMap(Fiber *fiber, HeapPages *pages, Erro
     if (!map || !map->root)
         error->runtimeHandler(error->context, ERR_RUNTIME, "Map is null");
 
-    MapNode **nodeInParent = doGetMapNode(map, key, false, pages, error);
-    MapNode *node = *nodeInParent;
+    MapEntry *entry = doGetMapEntry(map, key, false, pages, error);
 
-    if (node)
+    if (entry)
     {
-        if (node->left && !node->right)
-            *nodeInParent = node->left;
-        else if (!node->left && node->right)
-            *nodeInParent = node->right;
-        else if (node->left && node->right)
-        {
-            MapNode **successorInParent = &node->right;
-            while ((*successorInParent)->left)
-                successorInParent = &(*successorInParent)->left;
+        // Release the key and the item before the entry is overwritten
+        doRefCntImpl(pages, entry, typeMapEntries(map->type)->base, TOK_MINUSMINUS);
 
-            MapNode *successor = *successorInParent;
-            *successorInParent = successor->right;
+        // Shift back the following entries, so that no entry becomes unreachable from its initial position
+        DynArray *entries = &map->root->entries;
+        const uint64_t mask = getDims(entries)->len - 1;
 
-            successor->left = node->left;
-            successor->right = node->right;
-
-            *nodeInParent = successor;
+        uint64_t i = ((char *)entry - (char *)entries->data) / entries->itemSize;
+        for (uint64_t j = (i + 1) & mask; doGetMapEntryAt(entries, j)->data; j = (j + 1) & mask)
+        {
+            const uint64_t initial = doGetMapEntryAt(entries, j)->hash & mask;
+            if (((j - initial) & mask) >= ((j - i) & mask))
+            {
+                memcpy(doGetMapEntryAt(entries, i), doGetMapEntryAt(entries, j), entries->itemSize);
+                i = j;
+            }
         }
-        else
-            *nodeInParent = NULL;
-
-        node->left = NULL;
-        node->right = NULL;
 
-        doRefCntImpl(pages, node, typeMapNodePtr(map->type), TOK_MINUSMINUS);
+        memset(doGetMapEntryAt(entries, i), 0, entries->itemSize);
 
         if (UNLIKELY(--map->root->len < 0))
             error->runtimeHandler(error->context, ERR_RUNTIME, "Map length is negative");
+
+        map->root->numDeleted++;
     }
 
     doRefCntImpl(pages, map->root, typeMapNodePtr(map->type), TOK_PLUSPLUS);
@@ -2699,8 +4230,7 @@ static FORCE_INLINE void doBuiltinSlice(Fiber *fiber, HeapPages *pages, Error *e
         memcpy((char *)result->data, (char *)array->data + startIndex * result->itemSize, getDims(result)->len * result->itemSize);
 
         // Increase result items' ref counts, as if they have been assigned one by one
-        const Type staticArrayType = typeMakeDetachedArray(result->type->base, getDims(result)->len);
-        doRefCntImpl(pages, result->data, &staticArrayType, TOK_PLUSPLUS);
+        doIncArrayItemsRefCnt(pages, result->data, result->type->base, getDims(result)->len);
 
         (--fiber->top)->ptrVal = result;
     }
@@ -2717,33 +4247,65 @@ static FORCE_INLINE void doBuiltinSlice(Fiber *fiber, HeapPages *pages, Error *e
 
 
 // fn sort(array: [] type, compare: fn (a, b: ^type): int)
-typedef struct
+typedef struct tagCompareContext
 {
     Fiber *fiber;
     Closure *compare;
-    const Type *compareType;
+    void *items;
+    HeapPage *itemsPage, *upvaluePage;      // Found once per sort, since all compared items belong to the same heap chunk
+    int numPrepaidCalls;
+    struct tagCompareContext *prev;         // Context of the sort() that called this one from its compare function
 } CompareContext;
 
 
-static int qsortCompare(const void *a, const void *b, void *context)
+static void sortChangePrepaidCompareRefCnt(CompareContext *context, int numCalls)
+{
+    // The callee decreases the ref counts of its parameters on return. Each call takes two references to the items chunk and one to the upvalue chunk
+    HeapPages *pages = &context->fiber->vm->pages;
+
+    if (context->itemsPage)
+        chunkRefCnt(pages, context->itemsPage, context->items, 2 * numCalls);
+
+    if (context->upvaluePage)
+        chunkRefCnt(pages, context->upvaluePage, context->compare->upvalue.self, numCalls);
+
+    context->numPrepaidCalls += numCalls;
+}
+
+
+static void sortReleasePrepaidCompareRefCnt(VM *vm)
+{
+    // A runtime error in the compare function leaves the references taken for the calls that have not been made
+    while (vm->sortContext)
+    {
+        CompareContext *context = vm->sortContext;
+        vm->sortContext = context->prev;
+
+        if (context->numPrepaidCalls > 0)
+            sortChangePrepaidCompareRefCnt(context, -context->numPrepaidCalls);
+    }
+}
+
+
+static int sortCompare(const void *a, const void *b, void *context)
 {
-    Fiber *fiber = ((CompareContext *)context)->fiber;
-    const Closure *compare  = ((CompareContext *)context)->compare;
-    const Type *compareType = ((CompareContext *)context)->compareType;
+    CompareContext *compareContext = (CompareContext *)context;
+    Fiber *fiber = compareContext->fiber;
+    const Closure *compare  = compareContext->compare;
 
-    const Signature *compareSig = compareType->field[0]->type->sig;
+    // Parameter references are taken in batches rather than per call
+    if (compareContext->numPrepaidCalls == 0)
+        sortChangePrepaidCompareRefCnt(compareContext, SORT_PREPAID_COMPARE_CALLS);
+
+    compareContext->numPrepaidCalls--;
 
     // Push upvalues
     fiber->top -= sizeof(Interface) / sizeof(Slot);
     *(Interface *)fiber->top = compare->upvalue;
-    doRefCntImpl(&fiber->vm->pages, fiber->top, compareSig->param[0]->type, TOK_PLUSPLUS);
 
     // Push pointers to values to be compared
     (--fiber->top)->ptrVal = (void *)a;
-    doRefCntImpl(&fiber->vm->pages, fiber->top->ptrVal, compareSig->param[1]->type, TOK_PLUSPLUS);
-
     (--fiber->top)->ptrVal = (void *)b;
-    doRefCntImpl(&fiber->vm->pages, fiber->top->ptrVal, compareSig->param[2]->type, TOK_PLUSPLUS);
 
     // Push 'return from VM' signal as return address
     (--fiber->top)->intVal = RETURN_FROM_VM;
@@ -2760,7 +4322,7 @@ static int qsortCompare(const void *a, const void *b, void *context)
 
 static FORCE_INLINE void doBuiltinSort(Fiber *fiber, Error *error)
 {
-    const Type *compareType = (fiber->top++)->ptrVal;
+    fiber->top++;   // Closure type
     Closure *compare = (fiber->top++)->ptrVal;
     DynArray *array = (fiber->top++)->ptrVal;
 
@@ -2772,47 +4334,31 @@ static FORCE_INLINE void doBuiltinSort(Fiber *fiber, Error *error)
 
     if (array->data && getDims(array)->len > 0)
     {
-        CompareContext context = {fiber, compare, compareType};
+        CompareContext context = {fiber, compare, array->data, pageFind(&fiber->vm->pages, array->data), pageFind(&fiber->vm->pages, compare->upvalue.self), 0, fiber->vm->sortContext};
 
         const int numTempSlots = align(array->itemSize, sizeof(Slot)) / sizeof(Slot);
-        fiber->top -= numTempSlots;
-
-        qsortEx((char *)array->data, (char *)array->data + array->itemSize * (getDims(array)->len - 1), array->itemSize, qsortCompare, &context, fiber->top);
-
-        fiber->top += numTempSlots;
-    }
-}
 
+        if (UNLIKELY(fiber->top - numTempSlots - fiber->stack < MEM_MIN_FREE_STACK))
+            error->runtimeHandler(error->context, ERR_RUNTIME, "Stack overflow");
 
-// fn sort(array: [] type, ascending: bool [, ident])
-typedef struct
-{
-    const Type *itemType;
-    int64_t offset;
-    bool ascending;
-    Error *error;
-} FastCompareContext;
-
+        fiber->top -= numTempSlots;
 
-static int qsortFastCompare(const void *a, const void *b, void *context)
-{
-    FastCompareContext *fastCompareContext = (FastCompareContext *)context;
+        fiber->vm->sortContext = &context;
 
-    const Type *itemType = fastCompareContext->itemType;
-    const int sign = fastCompareContext->ascending ? 1 : -1;
-    Error *error = fastCompareContext->error;
+        sortUnstable((char *)array->data, getDims(array)->len, array->itemSize, sortCompare, &context, fiber->top);
 
-    Slot lhsItem = {.ptrVal = (char *)a + fastCompareContext->offset};
-    Slot rhsItem = {.ptrVal = (char *)b + fastCompareContext->offset};
+        fiber->vm->sortContext = context.prev;
 
-    doDerefImpl(&lhsItem, itemType->kind, error);
-    doDerefImpl(&rhsItem, itemType->kind, error);
+        // Release the references taken for the calls that have not been made
+        if (context.numPrepaidCalls > 0)
+            sortChangePrepaidCompareRefCnt(&context, -context.numPrepaidCalls);
 
-    const int64_t itemDiff = doCompare(lhsItem, rhsItem, itemType, error); 
-    return itemDiff == 0 ? 0 : itemDiff > 0 ? sign : -sign;   
+        fiber->top += numTempSlots;
+    }
 }
 
 
+// fn sort(array: [] type, ascending: bool [, ident])
 static FORCE_INLINE void doBuiltinSortFast(Fiber *fiber, Error *error)
 {
     const int64_t offset = (fiber->top++)->intVal;
@@ -2825,12 +4371,14 @@ static FORCE_INLINE void doBuiltinSortFast(Fiber *fiber, Error *error)
 
     if (array->data && getDims(array)->len > 0)
     {
-        FastCompareContext context = {itemType, offset, ascending, error};
-
         const int numTempSlots = align(array->itemSize, sizeof(Slot)) / sizeof(Slot);
+
+        if (UNLIKELY(fiber->top - numTempSlots - fiber->stack < MEM_MIN_FREE_STACK))
+            error->runtimeHandler(error->context, ERR_RUNTIME, "Stack overflow");
+
         fiber->top -= numTempSlots;
 
-        qsortEx((char *)array->data, (char *)array->data + array->itemSize * (getDims(array)->len - 1), array->itemSize, qsortFastCompare, &context, fiber->top);
+        doSortFast((char *)array->data, getDims(array)->len, itemType, offset, ascending, array->itemSize, fiber->top, fiber->vm->storage, error);
 
         fiber->top += numTempSlots;
     }
@@ -3015,10 +4563,7 @@ static FORCE_INLINE void doBuiltinValidKey(Fiber *fiber, HeapPages *pages, Error
     bool isValid = false;
 
     if (map->root)
-    {
-        const MapNode *node = *doGetMapNode(map, key, false, pages, error);
-        isValid = node && node->data;
-    }
+        isValid = doGetMapEntry(map, key, false, pages, error) != NULL;
 
     (--fiber->top)->intVal = isValid;
 }
@@ -3039,21 +4584,132 @@ static FORCE_INLINE void doBuiltinKeys(Fiber *fiber, HeapPages *pages, Error *er
 
     if (map->root)
     {
-        doGetMapKeys(map, result->data, error);
+        // Sorting the keys requires temporary stack space for a single key
+        const int numTempSlots = align(result->itemSize, sizeof(Slot)) / sizeof(Slot);
+
+        if (UNLIKELY(fiber->top - numTempSlots - fiber->stack < MEM_MIN_FREE_STACK))
+            error->runtimeHandler(error->context, ERR_RUNTIME, "Stack overflow");
+
+        fiber->top -= numTempSlots;
+        doGetMapKeys(map, result->data, fiber->top, fiber->vm->storage, error);
+        fiber->top += numTempSlots;
 
         // Increase result items' ref counts, as if they have been assigned one by one
-        const Type staticArrayType = typeMakeDetachedArray(result->type->base, getDims(result)->len);
-        doRefCntImpl(pages, result->data, &staticArrayType, TOK_PLUSPLUS);
+        doIncArrayItemsRefCnt(pages, result->data, result->type->base, getDims(result)->len);
+    }
+
+    (--fiber->top)->ptrVal = result;
+}
+
+
+// fn mapiter(m: map [keyType] type): struct {#numdeleted: int; #items: []struct {#data: uint; #key: keyType}}
+static FORCE_INLINE void doBuiltinMapIter(Fiber *fiber, HeapPages *pages, Error *error)
+{
+    MapIterator *result = (fiber->top++)->ptrVal;
+    const Map *map = (fiber->top++)->ptrVal;
+
+    const Type *resultType = fiber->code[fiber->ip].type;
+    const Type *itemsType = resultType->field[1]->type;
+
+    if (UNLIKELY(!map))
+        error->runtimeHandler(error->context, ERR_RUNTIME, "Map is null");
+
+    result->numDeleted = map->root ? map->root->numDeleted : 0;
+    doAllocDynArray(pages, &result->items, itemsType, map->root ? map->root->len : 0, error);
+
+    if (map->root)
+    {
+        const Type *keyType = typeMapKey(map->type);
+
+        // Items are not moved by rehashing or deletion, so their addresses remain valid until they are deleted
+        const int64_t numEntries = getDims(&map->root->entries)->len;
+
+        int64_t numItems = 0;
+        for (int64_t i = 0; i < numEntries; i++)
+        {
+            const MapEntry *entry = doGetMapEntryAt(&map->root->entries, i);
+            if (!entry->data)
+                continue;
+
+            MapIteratorItem *item = (MapIteratorItem *)((char *)result->items.data + numItems * result->items.itemSize);
+            item->data = entry->data;
+            memcpy(item->key, entry->key, keyType->size);
+
+            numItems++;
+        }
+
+        if (UNLIKELY(numItems != map->root->len))
+            error->runtimeHandler(error->context, ERR_RUNTIME, "Wrong number of map keys");
+
+        // Sorting the items requires temporary stack space for a single item
+        const int numTempSlots = align(result->items.itemSize, sizeof(Slot)) / sizeof(Slot);
+
+        if (UNLIKELY(fiber->top - numTempSlots - fiber->stack < MEM_MIN_FREE_STACK))
+            error->runtimeHandler(error->context, ERR_RUNTIME, "Stack overflow");
+
+        fiber->top -= numTempSlots;
+        doSortFast(result->items.data, numItems, keyType, offsetof(MapIteratorItem, key), true, result->items.itemSize, fiber->top, fiber->vm->storage, error);
+        fiber->top += numTempSlots;
+
+        // Increase result keys' ref counts, as if they have been assigned one by one. Item addresses are not ref-counted
+        doIncArrayItemsRefCnt(pages, result->items.data, itemsType->base, numItems);
     }
 
     (--fiber->top)->ptrVal = result;
 }
 
 
+// fn mapnext(iter: ^struct {...}, index: ^int, m: map [keyType] type): bool
+static FORCE_INLINE void doBuiltinMapNext(Fiber *fiber, HeapPages *pages, Error *error)
+{
+    Map *map = (fiber->top++)->ptrVal;
+    int64_t *index = (fiber->top++)->ptrVal;
+    MapIterator *iter = (fiber->top++)->ptrVal;
+
+    const int64_t len = getDims(&iter->items)->len;
+    bool found = false;
+
+    for (; *index < len; (*index)++)
+    {
+        // No deletions since the iterator was created: the item address is valid
+        if (map->root->numDeleted == iter->numDeleted)
+        {
+            found = true;
+            break;
+        }
+
+        // Some items have been deleted: look up the key, as the item may have been deleted or deleted and added again
+        MapIteratorItem *item = (MapIteratorItem *)((char *)iter->items.data + *index * iter->items.itemSize);
+
+        const Type *keyType = typeMapKey(map->type);
+        Slot keySlot = {.ptrVal = item->key};
+        doDerefImpl(&keySlot, keyType->kind, error);
+
+        const MapEntry *entry = doGetMapEntry(map, keySlot, false, pages, error);
+        if (entry)
+        {
+            item->data = entry->data;
+            found = true;
+            break;
+        }
+    }
+
+    (--fiber->top)->intVal = found;
+}
+
+
 // fn resume([child: fiber])
 static FORCE_INLINE void doBuiltinResume(Fiber *fiber, Fiber **newFiber, Error *error)
 {
     Fiber *child = (fiber->top++)->ptrVal;
+
+    // Spawned fibers are switched by the scheduler only, otherwise they would never get back to the run queue
+    if (UNLIKELY(child && child->alive && child->spawned))
+        error->runtimeHandler(error->context, ERR_RUNTIME, "Cannot resume a spawned fiber");
+
+    if (UNLIKELY(!child && fiber->spawned))
+        error->runtimeHandler(error->context, ERR_RUNTIME, "Spawned fiber cannot resume its parent");
+
     if (child && child->alive)
         *newFiber = child;
     else if (!child && fiber->parent)
@@ -3388,6 +5044,101 @@ static FORCE_INLINE void doUnary(Fiber *fiber, Error *error)
 }
 
 
+// Specialized unary and binary operations for the most frequent operand types. The operator is always a compile-time constant
+
+static FORCE_INLINE void doUnaryInt(Fiber *fiber, TokenKind op)
+{
+    switch (op)
+    {
+        case TOK_MINUS:         fiber->top->intVal = -fiber->top->intVal; break;
+        case TOK_PLUSPLUS:      (*(int64_t *)(fiber->top++)->ptrVal)++; break;
+        case TOK_MINUSMINUS:    (*(int64_t *)(fiber->top++)->ptrVal)--; break;
+        default:                break;
+    }
+    fiber->ip++;
+}
+
+
+static FORCE_INLINE void doUnaryLocalInt(Fiber *fiber, TokenKind op)
+{
+    int64_t *ptr = (int64_t *)((int8_t *)fiber->base + fiber->code[fiber->ip].operand.intVal);
+
+    switch (op)
+    {
+        case TOK_PLUSPLUS:      (*ptr)++; break;
+        case TOK_MINUSMINUS:    (*ptr)--; break;
+        default:                break;
+    }
+    fiber->ip++;
+}
+
+
+static FORCE_INLINE void doUnaryReal(Fiber *fiber, TokenKind op)
+{
+    switch (op)
+    {
+        case TOK_MINUS:         fiber->top->realVal = -fiber->top->realVal; break;
+        default:                break;
+    }
+    fiber->ip++;
+}
+
+
+static FORCE_INLINE void doBinaryInt(Fiber *fiber, TokenKind op)
+{
+    const Slot rhs = *fiber->top++;
+    Slot *lhs = fiber->top;
+
+    switch (op)
+    {
+        case TOK_PLUS:          lhs->intVal += rhs.intVal; break;
+        case TOK_MINUS:         lhs->intVal -= rhs.intVal; break;
+        case TOK_MUL:           lhs->intVal *= rhs.intVal; break;
+
+        case TOK_EQEQ:          lhs->intVal = lhs->intVal == rhs.intVal; break;
+        case TOK_NOTEQ:         lhs->intVal = lhs->intVal != rhs.intVal; break;
+        case TOK_GREATER:       lhs->intVal = lhs->intVal >  rhs.intVal; break;
+        case TOK_LESS:          lhs->intVal = lhs->intVal <  rhs.intVal; break;
+        case TOK_GREATEREQ:     lhs->intVal = lhs->intVal >= rhs.intVal; break;
+        case TOK_LESSEQ:        lhs->intVal = lhs->intVal <= rhs.intVal; break;
+
+        default:                break;
+    }
+    fiber->ip++;
+}
+
+
+static FORCE_INLINE void doBinaryReal(Fiber *fiber, TokenKind op, Error *error)
+{
+    const Slot rhs = *fiber->top++;
+    Slot *lhs = fiber->top;
+
+    switch (op)
+    {
+        case TOK_PLUS:          lhs->realVal += rhs.realVal; break;
+        case TOK_MINUS:         lhs->realVal -= rhs.realVal; break;
+        case TOK_MUL:           lhs->realVal *= rhs.realVal; break;
+        case TOK_DIV:
+        {
+            if (UNLIKELY(rhs.realVal == 0))
+                error->runtimeHandler(error->context, ERR_RUNTIME, "Division by zero");
+            lhs->realVal /= rhs.realVal;
+            break;
+        }
+
+        case TOK_EQEQ:          lhs->intVal = lhs->realVal == rhs.realVal; break;
+        case TOK_NOTEQ:         lhs->intVal = lhs->realVal != rhs.realVal; break;
+        case TOK_GREATER:       lhs->intVal = lhs->realVal >  rhs.realVal; break;
+        case TOK_LESS:          lhs->intVal = lhs->realVal <  rhs.realVal; break;
+        case TOK_GREATEREQ:     lhs->intVal = lhs->realVal >= rhs.realVal; break;
+        case TOK_LESSEQ:        lhs->intVal = lhs->realVal <= rhs.realVal; break;
+
+        default:                break;
+    }
+    fiber->ip++;
+}
+
+
 static FORCE_INLINE void doBinary(Fiber *fiber, HeapPages *pages, Error *error)
 {
     const TokenKind op = fiber->code[fiber->ip].tokKind;
@@ -3462,13 +5213,14 @@ static FORCE_INLINE void doBinary(Fiber *fiber, HeapPages *pages, Error *error)
 
                 memmove(buf + lhsLen, rhsStr, rhsLen + 1);
                 getStrDims(buf)->len = lhsLen + rhsLen;
+                doResetStrHash(buf);
 
                 lhs->ptrVal = buf;
                 break;
             }
 
-            case TOK_EQEQ:      lhs->intVal = strcmp(lhsStr, rhsStr) == 0; break;
-            case TOK_NOTEQ:     lhs->intVal = strcmp(lhsStr, rhsStr) != 0; break;
+            case TOK_EQEQ:      lhs->intVal =  doStrEqual(lhsStr, rhsStr); break;
+            case TOK_NOTEQ:     lhs->intVal = !doStrEqual(lhsStr, rhsStr); break;
             case TOK_GREATER:   lhs->intVal = strcmp(lhsStr, rhsStr)  > 0; break;
             case TOK_LESS:      lhs->intVal = strcmp(lhsStr, rhsStr)  < 0; break;
             case TOK_GREATEREQ: lhs->intVal = strcmp(lhsStr, rhsStr) >= 0; break;
@@ -3600,10 +5352,46 @@ static FORCE_INLINE void doBinary(Fiber *fiber, HeapPages *pages, Error *error)
             case TOK_GREATEREQ: lhs->intVal = lhs->intVal >= rhs.intVal; break;
             case TOK_LESSEQ:    lhs->intVal = lhs->intVal <= rhs.intVal; break;
 
-            default:            error->runtimeHandler(error->context, ERR_RUNTIME, "Illegal instruction"); return;
-        }
+            default:            error->runtimeHandler(error->context, ERR_RUNTIME, "Illegal instruction"); return;
+        }
+    }
+
+    fiber->ip++;
+}
+
+
+static FORCE_INLINE void doStrConcatN(Fiber *fiber, HeapPages *pages, Error *error)
+{
+    // The first operand is the deepest one on the stack
+    const int64_t numOperands = fiber->code[fiber->ip].operand.intVal;
+
+    int64_t len = 0;
+    for (int64_t i = 0; i < numOperands; i++)
+    {
+        const char *str = (const char *)fiber->top[i].ptrVal;
+        if (!str)
+            str = doGetEmptyStr();
+
+        doCheckStr(str, error);
+        len += getStrDims(str)->len;
+    }
+
+    char *buf = doAllocStr(pages, len, error);
+
+    char *dest = buf;
+    for (int64_t i = numOperands - 1; i >= 0; i--)
+    {
+        const char *str = (const char *)fiber->top[i].ptrVal;
+        if (!str)
+            continue;
+
+        memcpy(dest, str, getStrDims(str)->len);
+        dest += getStrDims(str)->len;
     }
 
+    fiber->top += numOperands - 1;
+    fiber->top->ptrVal = buf;
+
     fiber->ip++;
 }
 
@@ -3676,27 +5464,9 @@ static FORCE_INLINE void doGetMapPtr(Fiber *fiber, HeapPages *pages, bool derefe
     if (!map->root)
         doAllocMap(pages, map, mapType, error);
 
-    const Type *keyType = typeMapKey(map->type);
-    const Type *itemType = typeMapItem(map->type);
-
-    MapNode *node = *doGetMapNode(map, key, true, pages, error);
-    if (!node->data)
-    {
-        node->priority = (int64_t)rand() + 1;
-        
-        // When allocating dynamic arrays, we mark with type the data chunk, not the header chunk
-        node->key  = chunkAlloc(pages, keyType->size,  keyType->kind  == TYPE_DYNARRAY ? NULL : keyType,  NULL, false, error);
-        node->data = chunkAlloc(pages, itemType->size, itemType->kind == TYPE_DYNARRAY ? NULL : itemType, NULL, false, error);
-
-        // Increase key ref count
-        if (keyType->isGarbageCollected)
-            doRefCntImpl(pages, key.ptrVal, keyType, TOK_PLUSPLUS);
-
-        doAssignImpl(node->key, key, keyType->kind, keyType->size, error);
-        map->root->len++;
-    }
+    const MapEntry *entry = doGetMapEntry(map, key, true, pages, error);
 
-    (--fiber->top)->ptrVal = node->data;    
+    (--fiber->top)->ptrVal = entry->data;    
 
     if (dereference)
         doDerefImpl(fiber->top, fiber->code[fiber->ip].typeKind, error);    
@@ -3721,6 +5491,21 @@ static FORCE_INLINE void doGetFieldPtr(Fiber *fiber, bool dereference, Error *er
 }
 
 
+static FORCE_INLINE void doGetMethod(Fiber *fiber, Error *error)
+{
+    // Save the interface method's receiver to the dedicated register and push the method's entry point from the interface table
+    const int64_t methodOffset = fiber->code[fiber->ip].operand.intVal;
+
+    const InterfaceWithMethods *interface = fiber->top->ptrVal;
+    if (UNLIKELY(!interface))
+        error->runtimeHandler(error->context, ERR_RUNTIME, "Array or structure is null");
+
+    fiber->reg[REG_SELF].ptrVal = interface->self;
+    fiber->top->intVal = interface->itable ? *(int64_t *)((char *)interface->itable + methodOffset) : 0;     // Null interfaces have no table, so the call fails
+    fiber->ip++;
+}
+
+
 static FORCE_INLINE void doAssertType(Fiber *fiber)
 {
     const Interface *interface = (fiber->top++)->ptrVal;
@@ -3749,6 +5534,44 @@ static FORCE_INLINE void doAssertRange(Fiber *fiber, Error *error)
 }
 
 
+static InterfaceTable *doDeriveItable(InterfaceTable *srcTable, const Type *destType, Storage *storage)
+{
+    // Tables derived from the same table are keyed by the destination interface type of the conversion instruction
+    for (InterfaceTable *itable = srcTable->firstDerived; itable; itable = itable->nextDerived)
+        if (itable->interfaceType == destType)
+            return itable;
+
+    const int numMethods = destType->numItems - INTERFACE_FIELD_FIRST_METHOD;
+
+    InterfaceTable *itable = storageAdd(storage, sizeof(InterfaceTable) + numMethods * sizeof(int64_t));
+    itable->selfType = srcTable->selfType;
+    itable->interfaceType = destType;
+
+    for (int i = 0; i < numMethods; i++)
+    {
+        const Field *srcMethod = typeFindField(srcTable->interfaceType, destType->field[INTERFACE_FIELD_FIRST_METHOD + i]->name, NULL);
+        itable->entryOffset[i] = *(int64_t *)((char *)srcTable + srcMethod->offset);
+    }
+
+    itable->nextDerived = srcTable->firstDerived;
+    srcTable->firstDerived = itable;
+
+    return itable;
+}
+
+
+static FORCE_INLINE void doConvertItable(Fiber *fiber, Storage *storage)
+{
+    InterfaceTable *srcTable = fiber->top->ptrVal;
+    const Type *destType = fiber->code[fiber->ip].type;
+
+    if (srcTable)
+        fiber->top->ptrVal = doDeriveItable(srcTable, destType, storage);
+
+    fiber->ip++;
+}
+
+
 static FORCE_INLINE void doWeakenPtr(Fiber *fiber, HeapPages *pages)
 {
     void *ptr = fiber->top->ptrVal;
@@ -3830,6 +5653,30 @@ static FORCE_INLINE void doGotoIfNot(Fiber *fiber)
 }
 
 
+static FORCE_INLINE void doGotoIfInt(Fiber *fiber, TokenKind op)
+{
+    const int64_t rhs = (fiber->top++)->intVal;
+    const int64_t lhs = (fiber->top++)->intVal;
+
+    bool cond = false;
+    switch (op)
+    {
+        case TOK_EQEQ:      cond = lhs == rhs; break;
+        case TOK_NOTEQ:     cond = lhs != rhs; break;
+        case TOK_GREATER:   cond = lhs >  rhs; break;
+        case TOK_LESS:      cond = lhs <  rhs; break;
+        case TOK_GREATEREQ: cond = lhs >= rhs; break;
+        case TOK_LESSEQ:    cond = lhs <= rhs; break;
+        default:            break;
+    }
+
+    if (cond)
+        fiber->ip = fiber->code[fiber->ip].operand.intVal;
+    else
+        fiber->ip++;
+}
+
+
 static FORCE_INLINE void doCall(Fiber *fiber, Error *error)
 {
     // For direct calls, entry point address is stored in the instruction
@@ -3966,6 +5813,8 @@ static FORCE_INLINE void doCallBuiltin(Fiber *fiber, Fiber **newFiber, HeapPages
         // Maps
         case BUILTIN_VALIDKEY:      doBuiltinValidKey(fiber, pages, error); break;
         case BUILTIN_KEYS:          doBuiltinKeys(fiber, pages, error); break;
+        case BUILTIN_MAPITER:       doBuiltinMapIter(fiber, pages, error); break;
+        case BUILTIN_MAPNEXT:       doBuiltinMapNext(fiber, pages, error); break;
 
         // Fibers
         case BUILTIN_RESUME:        doBuiltinResume(fiber, newFiber, error); break;
@@ -3988,15 +5837,19 @@ static FORCE_INLINE void doReturn(Fiber *fiber, Fiber **newFiber)
 
     if (returnOffset == RETURN_FROM_FIBER)
     {
-        // For fiber function, kill the fiber, extract the parent fiber pointer and switch to it
+        // For fiber function, kill the fiber and switch to the next fiber in the run queue, if the fiber has been spawned, or to the parent fiber
         fiber->alive = false;
-        *newFiber = fiber->parent;
+        *newFiber = schedFinish(fiber->vm, fiber, fiber->vm->error);
     }
     else
     {
         // For conventional function, remove parameters from the stack and go back
         fiber->top += fiber->code[fiber->ip].operand.intVal;
         fiber->ip = returnOffset;
+
+        // Go back to the previous stack segment if the function has been called from there
+        if (UNLIKELY(fiber->top == fiber->stack + fiber->stackSize - sizeof(StackSegment) / sizeof(Slot)))
+            stackShrink(fiber, &fiber->vm->pages);
     }
 }
 
@@ -4005,10 +5858,15 @@ static FORCE_INLINE void doEnterFrame(Fiber *fiber, const UmkaHookFunc *hooks, E
 {
     const StackFrameLayout *layout = fiber->code[fiber->ip].operand.ptrVal;
     const int64_t localVarSlots = getLocalVarLayout(layout)->localVarSlots;
+    const int64_t tempSlots = getLocalVarLayout(layout)->tempSlots;
 
-    // Allocate stack frame
-    if (UNLIKELY(fiber->top - localVarSlots - fiber->stack < MEM_MIN_FREE_STACK))
-        error->runtimeHandler(error->context, ERR_RUNTIME, "Stack overflow");
+    // Allocate stack frame, in a new stack segment if necessary. The frame is followed by at least MEM_MIN_FREE_STACK slots for temporaries, 
+    // as many slots for larger temporaries whose size is checked explicitly, and the slots for parameters and other large temporaries, 
+    // since the stack cannot switch to a new segment in the middle of a function
+    const int64_t frameSlots = localVarSlots + 3;     // + 3 for the base pointer, ref count and layout table pointer
+
+    if (UNLIKELY(fiber->top - frameSlots - tempSlots - fiber->stack < 2 * MEM_MIN_FREE_STACK))
+        stackGrow(fiber, &fiber->vm->pages, getParamLayout(layout)->numParamSlots + 1, frameSlots + tempSlots, error);     // + 1 for the return address
 
     // Push old stack frame base pointer, set new one
     (--fiber->top)->ptrVal = fiber->base;
@@ -4059,98 +5917,396 @@ static FORCE_INLINE void doHalt(VM *vm)
 }
 
 
-static void vmLoop(VM *vm)
+static void doProfilerAddStack(Profiler *profiler, const char **fnName, int depth, int64_t numSamples, Storage *storage)
 {
+    uint64_t hash = depth;
+    for (int i = 0; i < depth; i++)
+        hash = hashBits(hash ^ (uint64_t)fnName[i]);
+
+    // Grow the hash table, if necessary
+    if (2 * (profiler->numStacks + 1) > profiler->capacity)
+    {
+        ProfilerStack **oldStacks = profiler->stacks;
+        const int64_t oldCapacity = profiler->capacity;
+
+        profiler->capacity = oldCapacity ? 2 * oldCapacity : PROF_MIN_STACKS;
+        profiler->stacks = storageAdd(storage, profiler->capacity * sizeof(ProfilerStack *));
+
+        for (int64_t i = 0; i < oldCapacity; i++)
+        {
+            if (!oldStacks[i])
+                continue;
+
+            int64_t j = oldStacks[i]->hash & (profiler->capacity - 1);
+            while (profiler->stacks[j])
+                j = (j + 1) & (profiler->capacity - 1);
+
+            profiler->stacks[j] = oldStacks[i];
+        }
+
+        if (oldStacks)
+            storageRemove(storage, oldStacks);
+    }
+
+    // Find or add the stack
+    int64_t i = hash & (profiler->capacity - 1);
+    for (; profiler->stacks[i]; i = (i + 1) & (profiler->capacity - 1))
+    {
+        ProfilerStack *stack = profiler->stacks[i];
+        if (stack->hash == hash && stack->depth == depth && memcmp(stack->fnName, fnName, depth * sizeof(fnName[0])) == 0)
+        {
+            stack->numSamples += numSamples;
+            return;
+        }
+    }
+
+    ProfilerStack *stack = storageAdd(storage, sizeof(ProfilerStack) + depth * sizeof(fnName[0]));
+    stack->hash = hash;
+    stack->numSamples = numSamples;
+    stack->depth = depth;
+    memcpy(stack->fnName, fnName, depth * sizeof(fnName[0]));
+
+    profiler->stacks[i] = stack;
+    profiler->numStacks++;
+}
+
+
+static void doProfilerSafepoint(Profiler *profiler, Fiber *fiber, Storage *storage)
+{
+    // Checking the processor time is much more expensive than reaching a safepoint
+    if (--profiler->numSafepointsToCheck > 0)
+        return;
+
+    profiler->numSafepointsToCheck = PROF_CLOCK_CHECK_INTERVAL;
+
+    const double time = (double)clock() / CLOCKS_PER_SEC;
+    const int64_t numSamples = (time - profiler->lastSampleTime) / profiler->interval;
+    if (numSamples <= 0)
+        return;
+
+    // The time spent since the last sample, e.g., in a long built-in function call, is attributed to the current call stack
+    profiler->lastSampleTime += numSamples * profiler->interval;
+
+    const char *fnName[PROF_MAX_STACK_DEPTH];
+    int depth = 0;
+
+    const Slot *base = fiber->base;
+    int ip = fiber->ip;
+
+    do
+        fnName[depth++] = fiber->debugPerInstr[ip].fnName;
+    while (depth < PROF_MAX_STACK_DEPTH && stackUnwind(fiber, &base, &ip));
+
+    doProfilerAddStack(profiler, fnName, depth, numSamples, storage);
+}
+
+
+static int doProfilerReport(const Profiler *profiler, char *buf, int size)
+{
+    // Folded stacks: outermost function first, semicolon-separated, followed by the number of samples
+    int chars = 0;
+
+    for (int64_t i = 0; i < profiler->capacity; i++)
+    {
+        const ProfilerStack *stack = profiler->stacks[i];
+        if (!stack)
+            continue;
+
+        for (int j = stack->depth - 1; j >= 0; j--)
+            chars += snprintf(nonnull(buf, chars), nonneg(size - chars), (j > 0) ? "%s;" : "%s", stack->fnName[j]);
+
+        chars += snprintf(nonnull(buf, chars), nonneg(size - chars), " %lld\n", (long long)stack->numSamples);
+    }
+
+    return chars;
+}
+
+
+static FORCE_INLINE Opcode doFetchOpcode(Fiber *fiber)
+{
+    const Opcode opcode = fiber->code[fiber->ip].opcode;
+
+#ifdef UMKA_VM_PAIR_STATS
+    opcodePairCount[prevOpcode][opcode]++;
+    prevOpcode = opcode;
+#endif
+
+    return opcode;
+}
+
+
+#ifdef UMKA_VM_COMPUTED_GOTO
+    #define VM_DISPATCH         goto *dispatch[fiber->ip]
+    #define VM_CASE(opcode)     label_##opcode
+    #define VM_DEFAULT          label_default
+    #define VM_NEXT             VM_DISPATCH
+#else
+    #define VM_CASE(opcode)     case opcode
+    #define VM_DEFAULT          default
+    #define VM_NEXT             break
+#endif
+
+
+static const void *const *vmLoop(VM *vm)
+{
+#ifdef UMKA_VM_COMPUTED_GOTO
+    // When called with no VM, return the handler addresses to be pre-resolved by vmReset()
+    static const void *const handlers[] =
+    {
+        [OP_NOP]                    = &&label_default,
+        [OP_PUSH]                   = &&VM_CASE(OP_PUSH),
+        [OP_PUSH_GLOBAL]            = &&VM_CASE(OP_PUSH_GLOBAL),
+        [OP_PUSH_ZERO]              = &&VM_CASE(OP_PUSH_ZERO),
+        [OP_PUSH_LOCAL_PTR]         = &&VM_CASE(OP_PUSH_LOCAL_PTR),
+        [OP_PUSH_LOCAL_PTR_ZERO]    = &&VM_CASE(OP_PUSH_LOCAL_PTR_ZERO),
+        [OP_PUSH_LOCAL]             = &&VM_CASE(OP_PUSH_LOCAL),
+        [OP_PUSH_REG]               = &&VM_CASE(OP_PUSH_REG),
+        [OP_PUSH_UPVALUE]           = &&VM_CASE(OP_PUSH_UPVALUE),
+        [OP_POP]                    = &&VM_CASE(OP_POP),
+        [OP_POP_REG]                = &&VM_CASE(OP_POP_REG),
+        [OP_DUP]                    = &&VM_CASE(OP_DUP),
+        [OP_SWAP]                   = &&VM_CASE(OP_SWAP),
+        [OP_ZERO]                   = &&VM_CASE(OP_ZERO),
+        [OP_DEREF]                  = &&VM_CASE(OP_DEREF),
+        [OP_ASSIGN]                 = &&VM_CASE(OP_ASSIGN),
+        [OP_SWAP_ASSIGN]            = &&VM_CASE(OP_SWAP_ASSIGN),
+        [OP_ASSIGN_PARAM]           = &&VM_CASE(OP_ASSIGN_PARAM),
+        [OP_REF_CNT]                = &&VM_CASE(OP_REF_CNT),
+        [OP_REF_CNT_GLOBAL]         = &&VM_CASE(OP_REF_CNT_GLOBAL),
+        [OP_REF_CNT_LOCAL]          = &&VM_CASE(OP_REF_CNT_LOCAL),
+        [OP_REF_CNT_ASSIGN]         = &&VM_CASE(OP_REF_CNT_ASSIGN),
+        [OP_SWAP_REF_CNT_ASSIGN]    = &&VM_CASE(OP_SWAP_REF_CNT_ASSIGN),
+        [OP_UNARY]                  = &&VM_CASE(OP_UNARY),
+        [OP_NEG_INT]                = &&VM_CASE(OP_NEG_INT),
+        [OP_NEG_REAL]               = &&VM_CASE(OP_NEG_REAL),
+        [OP_INC_INT]                = &&VM_CASE(OP_INC_INT),
+        [OP_DEC_INT]                = &&VM_CASE(OP_DEC_INT),
+        [OP_INC_LOCAL_INT]          = &&VM_CASE(OP_INC_LOCAL_INT),
+        [OP_DEC_LOCAL_INT]          = &&VM_CASE(OP_DEC_LOCAL_INT),
+        [OP_BINARY]                 = &&VM_CASE(OP_BINARY),
+        [OP_ADD_INT]                = &&VM_CASE(OP_ADD_INT),
+        [OP_SUB_INT]                = &&VM_CASE(OP_SUB_INT),
+        [OP_MUL_INT]                = &&VM_CASE(OP_MUL_INT),
+        [OP_EQ_INT]                 = &&VM_CASE(OP_EQ_INT),
+        [OP_NOT_EQ_INT]             = &&VM_CASE(OP_NOT_EQ_INT),
+        [OP_GREATER_INT]            = &&VM_CASE(OP_GREATER_INT),
+        [OP_LESS_INT]               = &&VM_CASE(OP_LESS_INT),
+        [OP_GREATER_EQ_INT]         = &&VM_CASE(OP_GREATER_EQ_INT),
+        [OP_LESS_EQ_INT]            = &&VM_CASE(OP_LESS_EQ_INT),
+        [OP_ADD_REAL]               = &&VM_CASE(OP_ADD_REAL),
+        [OP_SUB_REAL]               = &&VM_CASE(OP_SUB_REAL),
+        [OP_MUL_REAL]               = &&VM_CASE(OP_MUL_REAL),
+        [OP_DIV_REAL]               = &&VM_CASE(OP_DIV_REAL),
+        [OP_EQ_REAL]                = &&VM_CASE(OP_EQ_REAL),
+        [OP_NOT_EQ_REAL]            = &&VM_CASE(OP_NOT_EQ_REAL),
+        [OP_GREATER_REAL]           = &&VM_CASE(OP_GREATER_REAL),
+        [OP_LESS_REAL]              = &&VM_CASE(OP_LESS_REAL),
+        [OP_GREATER_EQ_REAL]        = &&VM_CASE(OP_GREATER_EQ_REAL),
+        [OP_LESS_EQ_REAL]           = &&VM_CASE(OP_LESS_EQ_REAL),
+        [OP_STR_CONCAT_N]           = &&VM_CASE(OP_STR_CONCAT_N),
+        [OP_GET_ARRAY_PTR]          = &&VM_CASE(OP_GET_ARRAY_PTR),
+        [OP_GET_ARRAY]              = &&VM_CASE(OP_GET_ARRAY),
+        [OP_GET_DYNARRAY_PTR]       = &&VM_CASE(OP_GET_DYNARRAY_PTR),
+        [OP_GET_DYNARRAY]           = &&VM_CASE(OP_GET_DYNARRAY),
+        [OP_GET_MAP_PTR]            = &&VM_CASE(OP_GET_MAP_PTR),
+        [OP_GET_MAP]                = &&VM_CASE(OP_GET_MAP),
+        [OP_GET_FIELD_PTR]          = &&VM_CASE(OP_GET_FIELD_PTR),
+        [OP_GET_FIELD]              = &&VM_CASE(OP_GET_FIELD),
+        [OP_GET_METHOD]             = &&VM_CASE(OP_GET_METHOD),
+        [OP_ASSERT_TYPE]            = &&VM_CASE(OP_ASSERT_TYPE),
+        [OP_ASSERT_RANGE]           = &&VM_CASE(OP_ASSERT_RANGE),
+        [OP_CONVERT_ITABLE]         = &&VM_CASE(OP_CONVERT_ITABLE),
+        [OP_WEAKEN_PTR]             = &&VM_CASE(OP_WEAKEN_PTR),
+        [OP_STRENGTHEN_PTR]         = &&VM_CASE(OP_STRENGTHEN_PTR),
+        [OP_GOTO]                   = &&VM_CASE(OP_GOTO),
+        [OP_GOTO_IF]                = &&VM_CASE(OP_GOTO_IF),
+        [OP_GOTO_IF_NOT]            = &&VM_CASE(OP_GOTO_IF_NOT),
+        [OP_GOTO_IF_EQ_INT]         = &&VM_CASE(OP_GOTO_IF_EQ_INT),
+        [OP_GOTO_IF_NOT_EQ_INT]     = &&VM_CASE(OP_GOTO_IF_NOT_EQ_INT),
+        [OP_GOTO_IF_GREATER_INT]    = &&VM_CASE(OP_GOTO_IF_GREATER_INT),
+        [OP_GOTO_IF_LESS_INT]       = &&VM_CASE(OP_GOTO_IF_LESS_INT),
+        [OP_GOTO_IF_GREATER_EQ_INT] = &&VM_CASE(OP_GOTO_IF_GREATER_EQ_INT),
+        [OP_GOTO_IF_LESS_EQ_INT]    = &&VM_CASE(OP_GOTO_IF_LESS_EQ_INT),
+        [OP_CALL]                   = &&VM_CASE(OP_CALL),
+        [OP_CALL_INDIRECT]          = &&VM_CASE(OP_CALL_INDIRECT),
+        [OP_CALL_EXTERN]            = &&VM_CASE(OP_CALL_EXTERN),
+        [OP_CALL_BUILTIN]           = &&VM_CASE(OP_CALL_BUILTIN),
+        [OP_CALL_PRINTF]            = &&VM_CASE(OP_CALL_PRINTF),
+        [OP_RETURN]                 = &&VM_CASE(OP_RETURN),
+        [OP_ENTER_FRAME]            = &&VM_CASE(OP_ENTER_FRAME),
+        [OP_LEAVE_FRAME]            = &&VM_CASE(OP_LEAVE_FRAME),
+        [OP_HALT]                   = &&VM_CASE(OP_HALT)
+    };
+
+    if (!vm)
+        return handlers;
+#else
+    if (!vm)
+        return NULL;
+#endif
+
     Fiber *fiber = vm->fiber;
     HeapPages *pages = &vm->pages;
     const UmkaHookFunc *hooks = vm->hooks;
     Error *error = vm->error;
 
+    // Stack overflow is checked on entering a stack frame or pushing a variable number of slots, not on every instruction
+
+#ifdef UMKA_VM_COMPUTED_GOTO
+    const void *const *dispatch = vm->dispatch;
+    if (UNLIKELY(!dispatch))
+        error->runtimeHandler(error->context, ERR_RUNTIME, "Illegal instruction");
+
+    VM_DISPATCH;
+#else
     while (1)
+    switch (doFetchOpcode(fiber))
+#endif
     {
-        if (UNLIKELY(fiber->top - fiber->stack < MEM_MIN_FREE_STACK))
-            error->runtimeHandler(error->context, ERR_RUNTIME, "Stack overflow");
+        VM_CASE(OP_PUSH):                           doPush(fiber, error);                         VM_NEXT;
+        VM_CASE(OP_PUSH_GLOBAL):                    doPushGlobal(fiber, error);                   VM_NEXT;
+        VM_CASE(OP_PUSH_ZERO):                      doPushZero(fiber, error);                     VM_NEXT;
+        VM_CASE(OP_PUSH_LOCAL_PTR):                 doPushLocalPtr(fiber);                        VM_NEXT;
+        VM_CASE(OP_PUSH_LOCAL_PTR_ZERO):            doPushLocalPtrZero(fiber);                    VM_NEXT;
+        VM_CASE(OP_PUSH_LOCAL):                     doPushLocal(fiber, error);                    VM_NEXT;
+        VM_CASE(OP_PUSH_REG):                       doPushReg(fiber);                             VM_NEXT;
+        VM_CASE(OP_PUSH_UPVALUE):                   doPushUpvalue(fiber, error);                  VM_NEXT;
+        VM_CASE(OP_POP):                            doPop(fiber);                                 VM_NEXT;
+        VM_CASE(OP_POP_REG):                        doPopReg(fiber);                              VM_NEXT;
+        VM_CASE(OP_DUP):                            doDup(fiber);                                 VM_NEXT;
+        VM_CASE(OP_SWAP):                           doSwap(fiber);                                VM_NEXT;
+        VM_CASE(OP_ZERO):                           doZero(fiber);                                VM_NEXT;
+        VM_CASE(OP_DEREF):                          doDeref(fiber, error);                        VM_NEXT;
+        VM_CASE(OP_ASSIGN):                         doAssign(fiber, false, error);                VM_NEXT;
+        VM_CASE(OP_SWAP_ASSIGN):                    doAssign(fiber, true, error);                 VM_NEXT;
+        VM_CASE(OP_ASSIGN_PARAM):                   doAssignParam(fiber, error);                  VM_NEXT;
+        VM_CASE(OP_REF_CNT):                        doRefCnt(fiber, pages);                       VM_NEXT;
+        VM_CASE(OP_REF_CNT_GLOBAL):                 doRefCntGlobal(fiber, pages, error);          VM_NEXT;
+        VM_CASE(OP_REF_CNT_LOCAL):                  doRefCntLocal(fiber, pages, error);           VM_NEXT;
+        VM_CASE(OP_REF_CNT_ASSIGN):                 doRefCntAssign(fiber, pages, false, error);   VM_NEXT;
+        VM_CASE(OP_SWAP_REF_CNT_ASSIGN):            doRefCntAssign(fiber, pages, true, error);    VM_NEXT;
+        VM_CASE(OP_UNARY):                          doUnary(fiber, error);                        VM_NEXT;
+        VM_CASE(OP_NEG_INT):                        doUnaryInt(fiber, TOK_MINUS);                 VM_NEXT;
+        VM_CASE(OP_NEG_REAL):                       doUnaryReal(fiber, TOK_MINUS);                VM_NEXT;
+        VM_CASE(OP_INC_INT):                        doUnaryInt(fiber, TOK_PLUSPLUS);              VM_NEXT;
+        VM_CASE(OP_DEC_INT):                        doUnaryInt(fiber, TOK_MINUSMINUS);            VM_NEXT;
+        VM_CASE(OP_INC_LOCAL_INT):                  doUnaryLocalInt(fiber, TOK_PLUSPLUS);         VM_NEXT;
+        VM_CASE(OP_DEC_LOCAL_INT):                  doUnaryLocalInt(fiber, TOK_MINUSMINUS);       VM_NEXT;
+        VM_CASE(OP_BINARY):                         doBinary(fiber, pages, error);                VM_NEXT;
+        VM_CASE(OP_ADD_INT):                        doBinaryInt(fiber, TOK_PLUS);                 VM_NEXT;
+        VM_CASE(OP_SUB_INT):                        doBinaryInt(fiber, TOK_MINUS);                VM_NEXT;
+        VM_CASE(OP_MUL_INT):                        doBinaryInt(fiber, TOK_MUL);                  VM_NEXT;
+        VM_CASE(OP_EQ_INT):                         doBinaryInt(fiber, TOK_EQEQ);                 VM_NEXT;
+        VM_CASE(OP_NOT_EQ_INT):                     doBinaryInt(fiber, TOK_NOTEQ);                VM_NEXT;
+        VM_CASE(OP_GREATER_INT):                    doBinaryInt(fiber, TOK_GREATER);              VM_NEXT;
+        VM_CASE(OP_LESS_INT):                       doBinaryInt(fiber, TOK_LESS);                 VM_NEXT;
+        VM_CASE(OP_GREATER_EQ_INT):                 doBinaryInt(fiber, TOK_GREATEREQ);            VM_NEXT;
+        VM_CASE(OP_LESS_EQ_INT):                    doBinaryInt(fiber, TOK_LESSEQ);               VM_NEXT;
+        VM_CASE(OP_ADD_REAL):                       doBinaryReal(fiber, TOK_PLUS, error);         VM_NEXT;
+        VM_CASE(OP_SUB_REAL):                       doBinaryReal(fiber, TOK_MINUS, error);        VM_NEXT;
+        VM_CASE(OP_MUL_REAL):                       doBinaryReal(fiber, TOK_MUL, error);          VM_NEXT;
+        VM_CASE(OP_DIV_REAL):                       doBinaryReal(fiber, TOK_DIV, error);          VM_NEXT;
+        VM_CASE(OP_EQ_REAL):                        doBinaryReal(fiber, TOK_EQEQ, error);         VM_NEXT;
+        VM_CASE(OP_NOT_EQ_REAL):                    doBinaryReal(fiber, TOK_NOTEQ, error);        VM_NEXT;
+        VM_CASE(OP_GREATER_REAL):                   doBinaryReal(fiber, TOK_GREATER, error);      VM_NEXT;
+        VM_CASE(OP_LESS_REAL):                      doBinaryReal(fiber, TOK_LESS, error);         VM_NEXT;
+        VM_CASE(OP_GREATER_EQ_REAL):                doBinaryReal(fiber, TOK_GREATEREQ, error);    VM_NEXT;
+        VM_CASE(OP_LESS_EQ_REAL):                   doBinaryReal(fiber, TOK_LESSEQ, error);       VM_NEXT;
+        VM_CASE(OP_STR_CONCAT_N):                   doStrConcatN(fiber, pages, error);            VM_NEXT;
+        VM_CASE(OP_GET_ARRAY_PTR):                  doGetArrayPtr(fiber, false, error);           VM_NEXT;
+        VM_CASE(OP_GET_ARRAY):                      doGetArrayPtr(fiber, true, error);            VM_NEXT;
+        VM_CASE(OP_GET_DYNARRAY_PTR):               doGetDynArrayPtr(fiber, false, error);        VM_NEXT;
+        VM_CASE(OP_GET_DYNARRAY):                   doGetDynArrayPtr(fiber, true, error);         VM_NEXT;
+        VM_CASE(OP_GET_MAP_PTR):                    doGetMapPtr(fiber, pages, false, error);      VM_NEXT;
+        VM_CASE(OP_GET_MAP):                        doGetMapPtr(fiber, pages, true, error);       VM_NEXT;
+        VM_CASE(OP_GET_FIELD_PTR):                  doGetFieldPtr(fiber, false, error);           VM_NEXT;
+        VM_CASE(OP_GET_FIELD):                      doGetFieldPtr(fiber, true, error);            VM_NEXT;
+        VM_CASE(OP_GET_METHOD):                     doGetMethod(fiber, error);                    VM_NEXT;
+        VM_CASE(OP_ASSERT_TYPE):                    doAssertType(fiber);                          VM_NEXT;
+        VM_CASE(OP_ASSERT_RANGE):                   doAssertRange(fiber, error);                  VM_NEXT;
+        VM_CASE(OP_CONVERT_ITABLE):                 doConvertItable(fiber, vm->storage);          VM_NEXT;
+        VM_CASE(OP_WEAKEN_PTR):                     doWeakenPtr(fiber, pages);                    VM_NEXT;
+        VM_CASE(OP_STRENGTHEN_PTR):                 doStrengthenPtr(fiber, pages);                VM_NEXT;
+        VM_CASE(OP_GOTO):
+        {
+            doGoto(fiber);
+
+            // Loops always contain unconditional jumps, so these jumps and function entries are enough as profiler safepoints
+            if (UNLIKELY(vm->profiler.active))
+                doProfilerSafepoint(&vm->profiler, fiber, vm->storage);
 
-        switch (fiber->code[fiber->ip].opcode)
+            VM_NEXT;
+        }
+        VM_CASE(OP_GOTO_IF):                        doGotoIf(fiber);                              VM_NEXT;
+        VM_CASE(OP_GOTO_IF_NOT):                    doGotoIfNot(fiber);                           VM_NEXT;
+        VM_CASE(OP_GOTO_IF_EQ_INT):                 doGotoIfInt(fiber, TOK_EQEQ);                 VM_NEXT;
+        VM_CASE(OP_GOTO_IF_NOT_EQ_INT):             doGotoIfInt(fiber, TOK_NOTEQ);                VM_NEXT;
+        VM_CASE(OP_GOTO_IF_GREATER_INT):            doGotoIfInt(fiber, TOK_GREATER);              VM_NEXT;
+        VM_CASE(OP_GOTO_IF_LESS_INT):               doGotoIfInt(fiber, TOK_LESS);                 VM_NEXT;
+        VM_CASE(OP_GOTO_IF_GREATER_EQ_INT):         doGotoIfInt(fiber, TOK_GREATEREQ);            VM_NEXT;
+        VM_CASE(OP_GOTO_IF_LESS_EQ_INT):            doGotoIfInt(fiber, TOK_LESSEQ);               VM_NEXT;
+        VM_CASE(OP_CALL):                           doCall(fiber, error);                         VM_NEXT;
+        VM_CASE(OP_CALL_INDIRECT):                  doCallIndirect(fiber, error);                 VM_NEXT;
+        VM_CASE(OP_CALL_EXTERN):
         {
-            case OP_PUSH:                           doPush(fiber, error);                         break;
-            case OP_PUSH_GLOBAL:                    doPushGlobal(fiber, error);                   break;
-            case OP_PUSH_ZERO:                      doPushZero(fiber, error);                     break;
-            case OP_PUSH_LOCAL_PTR:                 doPushLocalPtr(fiber);                        break;
-            case OP_PUSH_LOCAL_PTR_ZERO:            doPushLocalPtrZero(fiber);                    break;
-            case OP_PUSH_LOCAL:                     doPushLocal(fiber, error);                    break;
-            case OP_PUSH_REG:                       doPushReg(fiber);                             break;
-            case OP_PUSH_UPVALUE:                   doPushUpvalue(fiber, error);                  break;
-            case OP_POP:                            doPop(fiber);                                 break;
-            case OP_POP_REG:                        doPopReg(fiber);                              break;
-            case OP_DUP:                            doDup(fiber);                                 break;
-            case OP_SWAP:                           doSwap(fiber);                                break;
-            case OP_ZERO:                           doZero(fiber);                                break;
-            case OP_DEREF:                          doDeref(fiber, error);                        break;
-            case OP_ASSIGN:                         doAssign(fiber, false, error);                break;
-            case OP_SWAP_ASSIGN:                    doAssign(fiber, true, error);                 break;
-            case OP_ASSIGN_PARAM:                   doAssignParam(fiber, error);                  break;
-            case OP_REF_CNT:                        doRefCnt(fiber, pages);                       break;
-            case OP_REF_CNT_GLOBAL:                 doRefCntGlobal(fiber, pages, error);          break;
-            case OP_REF_CNT_LOCAL:                  doRefCntLocal(fiber, pages, error);           break;
-            case OP_REF_CNT_ASSIGN:                 doRefCntAssign(fiber, pages, false, error);   break;
-            case OP_SWAP_REF_CNT_ASSIGN:            doRefCntAssign(fiber, pages, true, error);    break;
-            case OP_UNARY:                          doUnary(fiber, error);                        break;
-            case OP_BINARY:                         doBinary(fiber, pages, error);                break;
-            case OP_GET_ARRAY_PTR:                  doGetArrayPtr(fiber, false, error);           break;
-            case OP_GET_ARRAY:                      doGetArrayPtr(fiber, true, error);            break;
-            case OP_GET_DYNARRAY_PTR:               doGetDynArrayPtr(fiber, false, error);        break;
-            case OP_GET_DYNARRAY:                   doGetDynArrayPtr(fiber, true, error);         break;
-            case OP_GET_MAP_PTR:                    doGetMapPtr(fiber, pages, false, error);      break;
-            case OP_GET_MAP:                        doGetMapPtr(fiber, pages, true, error);       break;
-            case OP_GET_FIELD_PTR:                  doGetFieldPtr(fiber, false, error);           break;
-            case OP_GET_FIELD:                      doGetFieldPtr(fiber, true, error);            break;
-            case OP_ASSERT_TYPE:                    doAssertType(fiber);                          break;
-            case OP_ASSERT_RANGE:                   doAssertRange(fiber, error);                  break;
-            case OP_WEAKEN_PTR:                     doWeakenPtr(fiber, pages);                    break;
-            case OP_STRENGTHEN_PTR:                 doStrengthenPtr(fiber, pages);                break;
-            case OP_GOTO:                           doGoto(fiber);                                break;
-            case OP_GOTO_IF:                        doGotoIf(fiber);                              break;
-            case OP_GOTO_IF_NOT:                    doGotoIfNot(fiber);                           break;
-            case OP_CALL:                           doCall(fiber, error);                         break;
-            case OP_CALL_INDIRECT:                  doCallIndirect(fiber, error);                 break;
-            case OP_CALL_EXTERN:                    doCallExtern(fiber, error);                   break;
-            case OP_CALL_BUILTIN:
-            {
-                Fiber *newFiber = NULL;
-                doCallBuiltin(fiber, &newFiber, pages, error);
+            doCallExtern(fiber, error);
 
-                if (!fiber->alive)
-                    return;
+            // The scheduler may have switched to another fiber
+            if (UNLIKELY(vm->fiber != fiber))
+                fiber = vm->fiber;
+
+            VM_NEXT;
+        }
+        VM_CASE(OP_CALL_BUILTIN):
+        {
+            Fiber *newFiber = NULL;
+            doCallBuiltin(fiber, &newFiber, pages, error);
 
-                if (newFiber)
-                    fiber = vm->fiber = vm->pages.fiber = newFiber;
+            if (!fiber->alive)
+                return NULL;
 
-                break;
-            }
-            case OP_RETURN:
-            {
-                Fiber *newFiber = NULL;
-                doReturn(fiber, &newFiber);
+            if (newFiber)
+                fiber = vm->fiber = vm->pages.fiber = newFiber;
 
-                if (newFiber)
-                    fiber = vm->fiber = vm->pages.fiber = newFiber;
+            VM_NEXT;
+        }
+        VM_CASE(OP_CALL_PRINTF):                    doCallPrintf(fiber, pages, error);            VM_NEXT;
+        VM_CASE(OP_RETURN):
+        {
+            Fiber *newFiber = NULL;
+            doReturn(fiber, &newFiber);
 
-                if (!fiber->alive || fiber->ip == RETURN_FROM_VM)
-                    return;
+            if (newFiber)
+                fiber = vm->fiber = vm->pages.fiber = newFiber;
 
-                break;
-            }
-            case OP_ENTER_FRAME:                    doEnterFrame(fiber, hooks, error);            break;
-            case OP_LEAVE_FRAME:                    doLeaveFrame(fiber, hooks, error);            break;
-            case OP_HALT:                           doHalt(vm);                                   return;
+            if (!fiber->alive || fiber->ip == RETURN_FROM_VM)
+                return NULL;
 
-            default: error->runtimeHandler(error->context, ERR_RUNTIME, "Illegal instruction"); return;
-        } // switch
+            VM_NEXT;
+        }
+        VM_CASE(OP_ENTER_FRAME):
+        {
+            doEnterFrame(fiber, hooks, error);
+
+            if (UNLIKELY(vm->profiler.active))
+                doProfilerSafepoint(&vm->profiler, fiber, vm->storage);
+
+            VM_NEXT;
+        }
+        VM_CASE(OP_LEAVE_FRAME):                    doLeaveFrame(fiber, hooks, error);            VM_NEXT;
+        VM_CASE(OP_HALT):                           doHalt(vm);                                   return NULL;
+
+        VM_DEFAULT: error->runtimeHandler(error->context, ERR_RUNTIME, "Illegal instruction"); return NULL;
     }
 }
 
 
+#undef VM_DISPATCH
+#undef VM_CASE
+#undef VM_DEFAULT
+#undef VM_NEXT
+
+
 void vmCall(VM *vm, UmkaFuncContext *fn)
 {
     if (UNLIKELY(!vm->fiber->alive))
@@ -4197,6 +6353,19 @@ void vmCall(VM *vm, UmkaFuncContext *fn)
 }
 
 
+void vmRun(VM *vm, UmkaFuncContext *fn)
+{
+    vmCall(vm, fn);
+
+    // The program ends with the main function, so the suspended spawned fibers would never finish. Report the error at the main function entry
+    if (UNLIKELY(vm->sched.numSpawned > 0))
+    {
+        vm->fiber->ip = fn->entryOffset;
+        vm->error->runtimeHandler(vm->error->context, ERR_RUNTIME, "Spawned fibers have not finished");
+    }
+}
+
+
 void vmCleanup(VM *vm)
 {
     // Go to the entry point
@@ -4216,6 +6385,7 @@ bool vmAlive(VM *vm)
 void vmKill(VM *vm)
 {
     vm->mainFiber->alive = false;
+    sortReleasePrepaidCompareRefCnt(vm);
 }
 
 
@@ -4263,6 +6433,8 @@ int vmAsm(int ip, const Instruction *code, const DebugInfo *debugPerInstr, const
         case OP_PUSH_ZERO:
         case OP_PUSH_LOCAL_PTR:
         case OP_PUSH_LOCAL:
+        case OP_INC_LOCAL_INT:
+        case OP_DEC_LOCAL_INT:
         case OP_POP:
         case OP_ZERO:
         case OP_ASSIGN:
@@ -4271,9 +6443,17 @@ int vmAsm(int ip, const Instruction *code, const DebugInfo *debugPerInstr, const
         case OP_REF_CNT_LOCAL:
         case OP_GET_FIELD_PTR:
         case OP_GET_FIELD:
+        case OP_GET_METHOD:
         case OP_GOTO:
         case OP_GOTO_IF:
         case OP_GOTO_IF_NOT:
+        case OP_GOTO_IF_EQ_INT:
+        case OP_GOTO_IF_NOT_EQ_INT:
+        case OP_GOTO_IF_GREATER_INT:
+        case OP_GOTO_IF_LESS_INT:
+        case OP_GOTO_IF_GREATER_EQ_INT:
+        case OP_GOTO_IF_LESS_EQ_INT:
+        case OP_STR_CONCAT_N:
         case OP_CALL_INDIRECT:
         case OP_RETURN:                 
         {
@@ -4310,6 +6490,12 @@ int vmAsm(int ip, const Instruction *code, const DebugInfo *debugPerInstr, const
             chars += snprintf(nonnull(buf, chars), nonneg(size - chars), " %s", builtinSpelling[instr->operand.builtinVal]); 
             break;
         }
+        case OP_CALL_PRINTF:
+        {
+            const FormatSegment *segment = instr->operand.ptrVal;
+            chars += snprintf(nonnull(buf, chars), nonneg(size - chars), " %s", builtinSpelling[segment->builtin]);
+            break;
+        }
         default: 
             break;
     }
@@ -4330,12 +6516,111 @@ void vmSetHook(VM *vm, UmkaHookEvent event, UmkaHookFunc hook)
 }
 
 
+bool vmStartProfiler(VM *vm, double interval)
+{
+    if (vm->profiler.active || !(interval > 0))
+        return false;
+
+    memset(&vm->profiler, 0, sizeof(vm->profiler));
+    vm->profiler.active = true;
+    vm->profiler.interval = interval;
+    vm->profiler.lastSampleTime = (double)clock() / CLOCKS_PER_SEC;
+    vm->profiler.numSafepointsToCheck = PROF_CLOCK_CHECK_INTERVAL;
+    return true;
+}
+
+
+char *vmStopProfiler(VM *vm)
+{
+    if (!vm->profiler.active)
+        return NULL;
+
+    const int chars = doProfilerReport(&vm->profiler, NULL, 0);
+    char *buf = storageAdd(vm->storage, chars + 1);
+    doProfilerReport(&vm->profiler, buf, chars + 1);
+
+    for (int64_t i = 0; i < vm->profiler.capacity; i++)
+        if (vm->profiler.stacks[i])
+            storageRemove(vm->storage, vm->profiler.stacks[i]);
+
+    if (vm->profiler.stacks)
+        storageRemove(vm->storage, vm->profiler.stacks);
+
+    memset(&vm->profiler, 0, sizeof(vm->profiler));
+    return buf;
+}
+
+
 void *vmAllocData(VM *vm, int size, UmkaExternFunc onFree)
 {
     return chunkAlloc(&vm->pages, size, NULL, onFree, false, vm->error);
 }
 
 
+void vmSchedSpawn(VM *vm, Fiber *fiber)
+{
+    if (UNLIKELY(!fiber || !fiber->alive))
+        vm->error->runtimeHandler(vm->error->context, ERR_RUNTIME, "Cannot spawn a dead fiber");
+
+    if (UNLIKELY(fiber->spawned || fiber == vm->mainFiber))
+        vm->error->runtimeHandler(vm->error->context, ERR_RUNTIME, "Fiber is already scheduled");
+
+    // The scheduler keeps a reference until the fiber finishes. The creator of the fiber may finish earlier, so the main fiber becomes the parent
+    fiber->spawned = true;
+    fiber->parent = vm->mainFiber;
+    fiberRefCnt(&vm->pages, fiber, TOK_PLUSPLUS);
+    vm->sched.numSpawned++;
+
+    schedEnqueue(&vm->sched, fiber);
+}
+
+
+void vmSchedYield(VM *vm)
+{
+    schedEnqueue(&vm->sched, vm->fiber);
+    schedSwitch(vm, schedNext(&vm->sched));
+}
+
+
+void vmSchedSleep(VM *vm, double delay)
+{
+    schedAddTimer(&vm->sched, vm->fiber, schedGetTime() + delay, vm->storage);
+    schedSwitch(vm, schedNext(&vm->sched));
+}
+
+
+void vmSchedJoin(VM *vm, Fiber *fiber)
+{
+    if (!fiber || !fiber->alive)
+        return;
+
+    if (UNLIKELY(fiber == vm->fiber))
+        vm->error->runtimeHandler(vm->error->context, ERR_RUNTIME, "Fiber cannot join itself");
+
+    // Joiners are woken up in the order they started waiting
+    Fiber **joiner = &fiber->firstJoiner;
+    while (*joiner)
+        joiner = &(*joiner)->nextScheduled;
+
+    *joiner = vm->fiber;
+    vm->fiber->nextScheduled = NULL;
+    vm->fiber->joining = true;
+
+    Fiber *next = schedNext(&vm->sched);
+    if (UNLIKELY(!next))
+        vm->error->runtimeHandler(vm->error->context, ERR_RUNTIME, "All fibers are waiting");
+
+    schedSwitch(vm, next);
+}
+
+
+void vmSchedWaitIO(VM *vm, int fd, bool writing)
+{
+    schedAddIOWait(&vm->sched, vm->fiber, fd, writing, vm->storage);
+    schedSwitch(vm, schedNext(&vm->sched));
+}
+
+
 void vmIncRef(VM *vm, void *ptr, const Type *type)
 {
     doRefCntImpl(&vm->pages, ptr, type, TOK_PLUSPLUS);
@@ -4353,8 +6638,8 @@ void *vmGetMapNodeData(VM *vm, Map *map, Slot key)
     if (!map || !map->root)
         return NULL;
 
-    const MapNode *node = *doGetMapNode(map, key, false, NULL, vm->error);
-    return node ? node->data : NULL;
+    const MapEntry *entry = doGetMapEntry(map, key, false, NULL, vm->error);
+    return entry ? entry->data : NULL;
 }
 
 
@@ -4391,6 +6676,108 @@ int64_t vmGetMemUsage(VM *vm)
 }
 
 
+static uint64_t doHashHeapSite(const UmkaHeapSite *site)
+{
+    return hashBits((uint64_t)site->fileName ^ hashBits((uint64_t)site->type ^ site->line));
+}
+
+
+static int doCompareHeapSites(const void *a, const void *b)
+{
+    // Largest sites first
+    const UmkaHeapSite *siteA = a, *siteB = b;
+
+    if (siteA->size != siteB->size)
+        return (siteA->size < siteB->size) ? 1 : -1;
+
+    const int fileNameDiff = strcmp(siteA->fileName, siteB->fileName);
+    if (fileNameDiff != 0)
+        return fileNameDiff;
+
+    if (siteA->line != siteB->line)
+        return siteA->line - siteB->line;
+
+    // Different types allocated at the same line
+    char typeBufA[DEFAULT_STR_LEN + 1], typeBufB[DEFAULT_STR_LEN + 1];
+    const char *typeNameA = siteA->type ? typeSpelling(siteA->type, typeBufA) : "?";
+    const char *typeNameB = siteB->type ? typeSpelling(siteB->type, typeBufB) : "?";
+    return strcmp(typeNameA, typeNameB);
+}
+
+
+int vmGetHeapSnapshot(VM *vm, UmkaHeapSite *sites, int maxSites)
+{
+    // Aggregate live heap chunks by allocation site and type. Open addressing hash table with linear probing
+    int64_t numSites = 0, capacity = PROF_MIN_HEAP_SITES;
+    UmkaHeapSite *table = storageAdd(vm->storage, capacity * sizeof(UmkaHeapSite));
+
+    for (const HeapPage *page = vm->pages.first; page; page = page->next)
+    {
+        for (int i = 0; i < page->numOccupiedChunks; i++)
+        {
+            const HeapChunk *chunk = (const HeapChunk *)((char *)page->data + i * page->chunkSize);
+            if (chunk->refCnt == 0)
+                continue;
+
+            // Grow the hash table, if necessary
+            if (2 * (numSites + 1) > capacity)
+            {
+                UmkaHeapSite *oldTable = table;
+                const int64_t oldCapacity = capacity;
+
+                capacity *= 2;
+                table = storageAdd(vm->storage, capacity * sizeof(UmkaHeapSite));
+
+                for (int64_t j = 0; j < oldCapacity; j++)
+                {
+                    if (!oldTable[j].fileName)
+                        continue;
+
+                    int64_t k = doHashHeapSite(&oldTable[j]) & (capacity - 1);
+                    while (table[k].fileName)
+                        k = (k + 1) & (capacity - 1);
+
+                    table[k] = oldTable[j];
+                }
+
+                storageRemove(vm->storage, oldTable);
+            }
+
+            // Find or add the site
+            const DebugInfo *debug = &vm->mainFiber->debugPerInstr[chunk->ip];
+            const UmkaHeapSite key = {.fileName = debug->fileName, .fnName = debug->fnName, .line = debug->line, .type = chunk->type};
+
+            int64_t j = doHashHeapSite(&key) & (capacity - 1);
+            while (table[j].fileName && (table[j].fileName != key.fileName || table[j].line != key.line || table[j].type != key.type))
+                j = (j + 1) & (capacity - 1);
+
+            if (!table[j].fileName)
+            {
+                table[j] = key;
+                numSites++;
+            }
+
+            table[j].numChunks++;
+            table[j].size += chunk->size;
+        }
+    }
+
+    // Compact and sort the sites
+    int64_t numSortedSites = 0;
+    for (int64_t i = 0; i < capacity; i++)
+        if (table[i].fileName)
+            table[numSortedSites++] = table[i];
+
+    qsort(table, numSortedSites, sizeof(UmkaHeapSite), doCompareHeapSites);
+
+    if (sites && maxSites > 0)
+        memcpy(sites, table, ((numSites < maxSites) ? numSites : maxSites) * sizeof(UmkaHeapSite));
+
+    storageRemove(vm->storage, table);
+    return numSites;
+}
+
+
 const char *vmBuiltinSpelling(BuiltinFunc builtin)
 {
     return builtinSpelling[builtin];
@@ -21,11 +21,39 @@ typedef enum
 
 enum    // Memory manager settings
 {
-    MEM_MIN_FREE_STACK    = 1024,                   // Slots
+    MEM_MIN_FREE_STACK    = 256,                    // Slots
+    MEM_MIN_FIBER_STACK   = 4 * MEM_MIN_FREE_STACK, // Slots. Initial stack size for child fibers, unless specified
     MEM_MIN_FREE_HEAP     = 1024,                   // Bytes
     MEM_MIN_HEAP_CHUNK    = 64,                     // Bytes
     MEM_MIN_HEAP_PAGE     = 1024 * 1024,            // Bytes
-    MEM_MAX_BLACKLISTED   = 16 * 1024 * 1024        // Bytes   
+    MEM_MIN_MAP_ENTRIES   = 8,                      // Entries
+    MEM_MAX_BLACKLISTED   = 16 * 1024 * 1024,       // Bytes   
+    MEM_NUM_SIZE_CLASSES  = 64                      // Enough for any chunk size up to INT_MAX
+};
+
+
+enum    // Sorting settings
+{
+    SORT_MAX_INSERTION_LEN              = 16,       // Items
+    SORT_MAX_PARTIAL_INSERTION_MOVES    = 8,
+    SORT_MIN_RADIX_LEN                  = 256,      // Items
+    SORT_MAX_RADIX_STEPS                = 4,        // Comparison steps
+    SORT_PREPAID_COMPARE_CALLS          = 1024,     // Compare function calls whose parameter ref counts are increased at once
+};
+
+
+enum    // Scheduler settings
+{
+    SCHED_IO_POLL_INTERVAL              = 64,       // Fiber switches between non-blocking checks for ready file descriptors
+};
+
+
+enum    // Profiler settings
+{
+    PROF_CLOCK_CHECK_INTERVAL           = 256,      // Safepoints between processor time checks
+    PROF_MAX_STACK_DEPTH                = 256,      // Stack frames. Outer frames of deeper call stacks are not sampled
+    PROF_MIN_STACKS                     = 64,       // Initial hash table size
+    PROF_MIN_HEAP_SITES                 = 64,       // Initial hash table size
 };
 
 
@@ -74,7 +102,33 @@ typedef enum
     OP_REF_CNT_ASSIGN,
     OP_SWAP_REF_CNT_ASSIGN,
     OP_UNARY,
+    OP_NEG_INT,
+    OP_NEG_REAL,
+    OP_INC_INT,
+    OP_DEC_INT,
+    OP_INC_LOCAL_INT,
+    OP_DEC_LOCAL_INT,
     OP_BINARY,
+    OP_ADD_INT,
+    OP_SUB_INT,
+    OP_MUL_INT,
+    OP_EQ_INT,
+    OP_NOT_EQ_INT,
+    OP_GREATER_INT,
+    OP_LESS_INT,
+    OP_GREATER_EQ_INT,
+    OP_LESS_EQ_INT,
+    OP_ADD_REAL,
+    OP_SUB_REAL,
+    OP_MUL_REAL,
+    OP_DIV_REAL,
+    OP_EQ_REAL,
+    OP_NOT_EQ_REAL,
+    OP_GREATER_REAL,
+    OP_LESS_REAL,
+    OP_GREATER_EQ_REAL,
+    OP_LESS_EQ_REAL,
+    OP_STR_CONCAT_N,
     OP_GET_ARRAY_PTR,
     OP_GET_ARRAY,
     OP_GET_DYNARRAY_PTR,
@@ -83,17 +137,26 @@ typedef enum
     OP_GET_MAP,
     OP_GET_FIELD_PTR,
     OP_GET_FIELD,
+    OP_GET_METHOD,
     OP_ASSERT_TYPE,
     OP_ASSERT_RANGE,
+    OP_CONVERT_ITABLE,
     OP_WEAKEN_PTR,
     OP_STRENGTHEN_PTR,
     OP_GOTO,
     OP_GOTO_IF,
     OP_GOTO_IF_NOT,
+    OP_GOTO_IF_EQ_INT,
+    OP_GOTO_IF_NOT_EQ_INT,
+    OP_GOTO_IF_GREATER_INT,
+    OP_GOTO_IF_LESS_INT,
+    OP_GOTO_IF_GREATER_EQ_INT,
+    OP_GOTO_IF_LESS_EQ_INT,
     OP_CALL,
     OP_CALL_INDIRECT,
     OP_CALL_EXTERN,
     OP_CALL_BUILTIN,
+    OP_CALL_PRINTF,
     OP_RETURN,
     OP_ENTER_FRAME,
     OP_LEAVE_FRAME,
@@ -146,11 +209,20 @@ typedef struct tagHeapPage
     int refCnt;
     int numChunks, numOccupiedChunks, numChunksWithOnFree, chunkSize;
     struct tagHeapPage *prev, *next;
+    struct tagHeapPage *prevWithSpace, *nextWithSpace;                      // Pages of the same size class that have chunks to allocate
     char *end;
     int64_t data[];
 } HeapPage;
 
 
+typedef struct
+{
+    HeapPage **byAddress, **byId;       // Live pages sorted by data address and by ID
+    int numPages, capacity;
+    Storage *storage;
+} HeapPageIndex;
+
+
 typedef struct
 {
     HeapPage *first, *firstRecycled, *firstBlacklisted, *lastAccessed;
@@ -160,6 +232,9 @@ typedef struct
     struct tagFiber *fiber;
     int64_t leakSanLevel;
     RefCntCandidates refCntCandidates;
+    HeapPageIndex index;
+    HeapPage *firstWithSpace[MEM_NUM_SIZE_CLASSES];
+    uint64_t sizeClassesWithSpace;                      // Bit mask of non-empty firstWithSpace lists
     Error *error;
 } HeapPages;
 
@@ -176,27 +251,93 @@ typedef struct
 } HeapChunk;
 
 
+typedef struct              // Stored at the end of every stack segment except the first one
+{
+    Slot *prevStack;
+    Slot *prevTop;          // Stack top in the previous segment, not including the parameters moved to this segment
+    int64_t prevStackSize;
+} StackSegment;
+
+
 typedef struct tagFiber
 {
     // Must have 8 byte alignment
     const Instruction *code;
     int ip;
-    Slot *stack, *top, *base;
+    Slot *stack, *top, *base;               // Stack is the current stack segment
     int stackSize;
+    Slot *stackBottom;                      // Base pointer of the outermost stack frame, at the end of the first stack segment
+    Slot *spareStack;                       // Segment kept for reuse after returning from it
+    int spareStackSize, totalStackSize, maxStackSize;
     Slot reg[NUM_REGS];
     struct tagFiber *parent;
+    struct tagFiber *nextScheduled;         // Next fiber in the run queue or in the list of fibers joining the same fiber
+    struct tagFiber *firstJoiner;           // Fibers waiting for this fiber to finish
     const DebugInfo *debugPerInstr;
     struct tagVM *vm;
     bool alive;
+    bool spawned;                           // Owned by the scheduler until finished
+    bool joining;
     bool fileSystemEnabled;
 } Fiber;
 
 
+typedef struct
+{
+    double time;
+    int64_t order;                          // Fibers with equal wake-up times are woken up in the order they went to sleep
+    Fiber *fiber;
+} SchedTimer;
+
+
+typedef struct
+{
+    int fd;
+    bool writing;
+    Fiber *fiber;
+} SchedIOWait;
+
+
+typedef struct
+{
+    Fiber *first, *last;                    // Run queue
+    SchedTimer *timers;                     // Sleeping fibers. Binary heap ordered by wake-up time
+    int64_t numTimers, capacity, order;
+    SchedIOWait *ioWaits;                   // Fibers waiting for file descriptors to get ready
+    void *pollFds;                          // Buffer for the platform-specific poll() argument
+    int64_t numIOWaits, ioCapacity, numSwitchesSincePoll;
+    int64_t numSpawned;                     // Spawned fibers that have not finished
+} Scheduler;
+
+
+typedef struct
+{
+    uint64_t hash;
+    int64_t numSamples;
+    int depth;
+    const char *fnName[];                   // Innermost function first
+} ProfilerStack;
+
+
+typedef struct
+{
+    bool active;
+    double interval, lastSampleTime;        // Seconds of processor time
+    int64_t numSafepointsToCheck;           // Safepoints left before the processor time is checked
+    ProfilerStack **stacks;                 // Distinct sampled call stacks. Open addressing hash table with linear probing
+    int64_t numStacks, capacity;
+} Profiler;
+
+
 typedef struct tagVM
 {
     Fiber *fiber, *mainFiber;
     HeapPages pages;
+    Scheduler sched;
+    Profiler profiler;
     UmkaHookFunc hooks[UMKA_NUM_HOOKS];
+    const void **dispatch;                  // Pre-resolved instruction handler addresses (computed-goto dispatch only)
+    struct tagCompareContext *sortContext;  // Innermost sort() being executed, NULL if none
     bool terminatedNormally;
     Storage *storage;
     Error *error;
@@ -208,14 +349,17 @@ typedef struct tagIdents Idents;
 
 void vmInit                     (VM *vm, Storage *storage, int stackSize, bool fileSystemEnabled, Error *error);
 void vmFree                     (VM *vm);
-void vmReset                    (VM *vm, const Instruction *code, const DebugInfo *debugPerInstr);
+void vmReset                    (VM *vm, const Instruction *code, int codeSize, const DebugInfo *debugPerInstr);
 void vmCall                     (VM *vm, UmkaFuncContext *fn);
+void vmRun                      (VM *vm, UmkaFuncContext *fn);
 void vmCleanup                  (VM *vm);
 bool vmAlive                    (VM *vm);
 void vmKill                     (VM *vm);
 int vmAsm                       (int ip, const Instruction *code, const DebugInfo *debugPerInstr, const Idents *idents, char *buf, int size);
 bool vmUnwindCallStack          (VM *vm, const Slot **base, int *ip);
 void vmSetHook                  (VM *vm, UmkaHookEvent event, UmkaHookFunc hook);
+bool vmStartProfiler            (VM *vm, double interval);
+char *vmStopProfiler            (VM *vm);
 void *vmAllocData               (VM *vm, int size, UmkaExternFunc onFree);
 void vmIncRef                   (VM *vm, void *ptr, const Type *type);
 void vmDecRef                   (VM *vm, void *ptr, const Type *type);
@@ -224,6 +368,12 @@ char *vmMakeStr                 (VM *vm, const char *str);
 void vmMakeDynArray             (VM *vm, DynArray *array, const Type *type, int len);
 void *vmMakeStruct              (VM *vm, const Type *type);
 int64_t vmGetMemUsage           (VM *vm);
+int vmGetHeapSnapshot           (VM *vm, UmkaHeapSite *sites, int maxSites);
+void vmSchedSpawn               (VM *vm, Fiber *fiber);
+void vmSchedYield               (VM *vm);
+void vmSchedSleep               (VM *vm, double delay);
+void vmSchedJoin                (VM *vm, Fiber *fiber);
+void vmSchedWaitIO              (VM *vm, int fd, bool writing);
 const char *vmBuiltinSpelling   (BuiltinFunc builtin);
 
 
@@ -8,6 +8,10 @@ cd ..
 
 ../umka_linux/umka -warn all.um > actual.log
 ../umka_linux/umka -warn compare.um actual.log expected.log
+
+../umka_linux/umka -compile all.umc all.um
+../umka_linux/umka -warn all.umc > actual_image.log
+../umka_linux/umka -warn compare.um actual_image.log expected.log
 cd .. 
 
 cd benchmarks
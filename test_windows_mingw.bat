@@ -6,6 +6,10 @@ cd ..
 
 ..\umka_windows_mingw\umka -warn all.um > actual.log
 ..\umka_windows_mingw\umka -warn compare.um actual.log expected.log
+
+..\umka_windows_mingw\umka -compile all.umc all.um
+..\umka_windows_mingw\umka -warn all.umc > actual_image.log
+..\umka_windows_mingw\umka -warn compare.um actual_image.log expected.log
 cd ..
 
 cd benchmarks
@@ -109,4 +109,119 @@ UMKA_EXPORT void sum(UmkaStackSlot *params, UmkaStackSlot *result)
     }
 
     api->umkaGetResult(params, result)->intVal = sum;
+}
+
+
+UMKA_EXPORT void startProfiler(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    Umka *umka = umkaGetInstance(result);
+    UmkaAPI *api = umkaGetAPI(umka);
+
+    const double interval = api->umkaGetParam(params, 0)->realVal;
+    api->umkaGetResult(params, result)->intVal = api->umkaStartProfiler(umka, interval);
+}
+
+
+UMKA_EXPORT void stopProfiler(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    Umka *umka = umkaGetInstance(result);
+    UmkaAPI *api = umkaGetAPI(umka);
+
+    const char *folded = api->umkaStopProfiler(umka);
+    api->umkaGetResult(params, result)->ptrVal = api->umkaMakeStr(umka, folded ? folded : "");
+}
+
+
+UMKA_EXPORT void run(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    Umka *umka = umkaGetInstance(result);
+    UmkaAPI *api = umkaGetAPI(umka);
+
+    // Run the source in a separate instance, so that its errors do not stop the caller
+    const char *src = api->umkaGetParam(params, 0)->ptrVal;
+
+    Umka *other = api->umkaAlloc();
+    bool ok = api->umkaInit(other, "run.um", src, 1024 * 1024, NULL, 0, NULL, false, false, NULL);
+    if (ok)
+        ok = api->umkaCompile(other);
+    if (ok)
+        ok = api->umkaRun(other) == 0;
+
+    api->umkaGetResult(params, result)->ptrVal = api->umkaMakeStr(umka, ok ? "" : api->umkaGetError(other)->msg);
+    api->umkaFree(other);
+}
+
+
+UMKA_EXPORT void runClones(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    Umka *umka = umkaGetInstance(result);
+    UmkaAPI *api = umkaGetAPI(umka);
+
+    // Compile the source once, then run and free its clones one after another
+    const char *src = api->umkaGetParam(params, 0)->ptrVal;
+    const int numClones = api->umkaGetParam(params, 1)->intVal;
+
+    Umka *original = api->umkaAlloc();
+    bool ok = api->umkaInit(original, "clones.um", src, 1024 * 1024, NULL, 0, NULL, false, false, NULL);
+    if (ok)
+        ok = api->umkaCompile(original);
+
+    if (!ok)
+        api->umkaGetResult(params, result)->ptrVal = api->umkaMakeStr(umka, api->umkaGetError(original)->msg);
+
+    for (int i = 0; ok && i < numClones; i++)
+    {
+        Umka *clone = api->umkaAlloc();
+        ok = api->umkaClone(original, clone) && api->umkaRun(clone) == 0;
+
+        if (!ok)
+            api->umkaGetResult(params, result)->ptrVal = api->umkaMakeStr(umka, api->umkaGetError(clone)->msg);
+
+        api->umkaFree(clone);
+    }
+
+    if (ok)
+        api->umkaGetResult(params, result)->ptrVal = api->umkaMakeStr(umka, "");
+
+    api->umkaFree(original);
+}
+
+
+UMKA_EXPORT void saveImage(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    Umka *umka = umkaGetInstance(result);
+    UmkaAPI *api = umkaGetAPI(umka);
+
+    const char *src = api->umkaGetParam(params, 0)->ptrVal;
+    const char *path = api->umkaGetParam(params, 1)->ptrVal;
+
+    Umka *other = api->umkaAlloc();
+    bool ok = api->umkaInit(other, "image.um", src, 1024 * 1024, NULL, 0, NULL, false, false, NULL);
+    if (ok)
+        ok = api->umkaCompile(other);
+    if (ok)
+        ok = api->umkaSaveImage(other, path);
+
+    api->umkaGetResult(params, result)->ptrVal = api->umkaMakeStr(umka, ok ? "" : api->umkaGetError(other)->msg);
+    api->umkaFree(other);
+}
+
+
+UMKA_EXPORT void runImage(UmkaStackSlot *params, UmkaStackSlot *result)
+{
+    Umka *umka = umkaGetInstance(result);
+    UmkaAPI *api = umkaGetAPI(umka);
+
+    const char *path = api->umkaGetParam(params, 0)->ptrVal;
+
+    // The image replaces the empty source
+    Umka *other = api->umkaAlloc();
+    bool ok = api->umkaInit(other, path, "", 1024 * 1024, NULL, 0, NULL, false, false, NULL);
+    if (ok)
+        ok = api->umkaLoadImage(other, path);
+    if (ok)
+        ok = api->umkaRun(other) == 0;
+
+    api->umkaGetResult(params, result)->ptrVal = api->umkaMakeStr(umka, ok ? "" : api->umkaGetError(other)->msg);
+    api->umkaFree(other);
 }
\ No newline at end of file